@@ -0,0 +1,46 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include "sv/core/alloc.h"
+
+#include <cstdint>
+
+/// @brief Benchmark helpers \namespace sv::bench
+namespace sv::bench
+{
+    /**
+     * @brief Counts the allocations of a benchmark loop and reports them as allocs/op.
+     *
+     * Construct it right before the loop; it reads the AllocationTracker totals again when it
+     * goes out of scope. The benchmark links iec61850_sv_alloc_hook, so every allocation counts.
+     */
+    class AllocationCounter
+    {
+    public:
+        /**
+         * @brief Starts counting.
+         * @param state The benchmark state receiving the counter.
+         */
+        explicit AllocationCounter(benchmark::State& state) noexcept
+            : state_(state)
+            , start_(AllocationTracker::total().allocations)
+        {
+        }
+
+        /**
+         * @brief Sets the allocs/op counter.
+         */
+        ~AllocationCounter()
+        {
+            state_.counters["allocs/op"] = benchmark::Counter(
+                static_cast<double>(AllocationTracker::total().allocations - start_), benchmark::Counter::kAvgIterations);
+        }
+
+        AllocationCounter(const AllocationCounter&) = delete;
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    private:
+        benchmark::State& state_;
+        uint64_t start_;
+    };
+}
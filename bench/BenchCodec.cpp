@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include "Allocations.h"
+#include "sv/core/buffer.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/network/NetworkReceiver.h"
+#include "sv/network/NetworkSender.h"
+
+#include <vector>
+
+namespace
+{
+    sv::SampledValueControlBlock::Ptr makeSvcb()
+    {
+        auto svcb = sv::SampledValueControlBlock::create("MU01");
+        svcb->setAppId(0x4001);
+        svcb->setMulticastAddress("01:0C:CD:04:00:01");
+        svcb->setSmpSynch(sv::SmpSynch::Global);
+        return svcb;
+    }
+
+    sv::ASDU makeAsdu()
+    {
+        sv::ASDU asdu{};
+        asdu.svID = "MU01";
+        asdu.smpCnt = 0;
+        asdu.confRev = 1;
+        asdu.smpSynch = sv::SmpSynch::Global;
+        asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+        for (size_t n = 0; n < sv::VALUES_PER_ASDU; ++n)
+        {
+            asdu.dataSet[n].value = static_cast<int32_t>(1000 * n);
+        }
+        return asdu;
+    }
+
+    /// @brief Receive side: one full frame through EthernetNetworkReceiver::parseASDU
+    void BM_ParseASDU(benchmark::State& state)
+    {
+        sv::BufferWriter writer(sv::FrameCodec::MAX_FRAME_SIZE);
+        sv::FrameCodec::encode(writer, *makeSvcb(), makeAsdu(), {0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01},
+                               sv::FrameCodec::LOCAL_SRC_MAC);
+        const std::vector<uint8_t> frame(writer.data(), writer.data() + writer.size());
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(sv::EthernetNetworkReceiver::parseASDU(frame));
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frame.size()));
+    }
+
+    /// @brief Receive loop decoding: FrameCodec::decode into one reused ASDU, as the receivers do
+    void BM_FrameCodecDecodeInPlace(benchmark::State& state)
+    {
+        sv::BufferWriter writer(sv::FrameCodec::MAX_FRAME_SIZE);
+        sv::FrameCodec::encode(writer, *makeSvcb(), makeAsdu(), {0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01},
+                               sv::FrameCodec::LOCAL_SRC_MAC);
+        const std::vector<uint8_t> frame(writer.data(), writer.data() + writer.size());
+        sv::ASDU asdu{};
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(sv::FrameCodec::decode(frame, asdu));
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frame.size()));
+    }
+
+    /// @brief Send side encoding: one frame into a reused writer, as sendASDU does before sendto
+    void BM_FrameCodecEncode(benchmark::State& state)
+    {
+        const auto svcb = makeSvcb();
+        auto asdu = makeAsdu();
+        sv::BufferWriter writer(sv::FrameCodec::MAX_FRAME_SIZE);
+        const std::array<uint8_t, 6> destMac{0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01};
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            writer.clear();
+            sv::FrameCodec::encode(writer, *svcb, asdu, destMac, sv::FrameCodec::LOCAL_SRC_MAC);
+            benchmark::DoNotOptimize(writer.data());
+            ++asdu.smpCnt;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// @brief The full EthernetNetworkSender::sendASDU path onto the loopback interface
+    void BM_EthernetSendASDU(benchmark::State& state)
+    {
+        std::unique_ptr<sv::EthernetNetworkSender> sender;
+        try
+        {
+            sender = sv::EthernetNetworkSender::create("lo");
+        }
+        catch (const std::exception& e)
+        {
+            state.SkipWithError(e.what());
+            return;
+        }
+
+        const auto svcb = makeSvcb();
+        auto asdu = makeAsdu();
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            sender->sendASDU(svcb, asdu);
+            ++asdu.smpCnt;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_ParseASDU);
+BENCHMARK(BM_FrameCodecDecodeInPlace);
+BENCHMARK(BM_FrameCodecEncode);
+BENCHMARK(BM_EthernetSendASDU);
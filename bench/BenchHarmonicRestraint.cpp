@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+#include "sv/protection/HarmonicRestraint.h"
+#include "sv/protection/PhasorEstimator.h"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    /// @brief One cycle of three-phase currents with 2nd harmonic content for both line ends
+    std::vector<std::array<double, 3>> cycle(const size_t spp, const double amplitude)
+    {
+        std::vector<std::array<double, 3>> samples(spp);
+        for (size_t n = 0; n < spp; ++n)
+        {
+            for (size_t p = 0; p < 3; ++p)
+            {
+                const double angle = 2.0 * std::numbers::pi * (static_cast<double>(n) / static_cast<double>(spp) -
+                                                               static_cast<double>(p) / 3.0);
+                samples[n][p] = amplitude * (std::cos(angle) + 0.2 * std::cos(2.0 * angle));
+            }
+        }
+        return samples;
+    }
+
+    void BM_HarmonicRestraintUpdate(benchmark::State& state)
+    {
+        const auto spp = static_cast<sv::SamplesPerPeriod>(state.range(0));
+        const auto restraint = sv::HarmonicRestraint::create(spp);
+        const auto side1 = cycle(restraint->getSamplesPerPeriod(), 10.0);
+        const auto side2 = cycle(restraint->getSamplesPerPeriod(), 9.0);
+
+        size_t n = 0;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(restraint->update(side1[n], side2[n]));
+            n = n + 1 == side1.size() ? 0 : n + 1;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// @brief Baseline: the fundamental phasor estimator over all eight channels
+    void BM_PhasorEstimatorUpdate(benchmark::State& state)
+    {
+        const auto spp = static_cast<sv::SamplesPerPeriod>(state.range(0));
+        const auto estimator = sv::PhasorEstimator::create(spp);
+        const auto side1 = cycle(estimator->getSamplesPerPeriod(), 10.0);
+
+        size_t n = 0;
+        std::array<double, sv::PhasorEstimator::CHANNELS> samples{};
+        for (auto _ : state)
+        {
+            std::copy(side1[n].begin(), side1[n].end(), samples.begin());
+            estimator->update(samples);
+            benchmark::DoNotOptimize(estimator->getPhasor(0));
+            n = n + 1 == side1.size() ? 0 : n + 1;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_HarmonicRestraintUpdate)->Arg(80)->Arg(256);
+BENCHMARK(BM_PhasorEstimatorUpdate)->Arg(80)->Arg(256);
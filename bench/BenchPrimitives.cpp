@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+#include "Allocations.h"
+#include "sv/core/buffer.h"
+#include "sv/core/mac.h"
+#include "sv/core/pipeline.h"
+#include "sv/core/types.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// @brief The values of one SV dataset: eight value and quality pairs, big endian
+    void BM_BufferWriterDataset(benchmark::State& state)
+    {
+        sv::BufferWriter writer(sv::VALUES_PER_ASDU * 8);
+        int32_t value = 0;
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            writer.clear();
+            for (size_t n = 0; n < sv::VALUES_PER_ASDU; ++n)
+            {
+                writer.writeInt32(value + static_cast<int32_t>(n));
+                writer.writeUint32(0);
+            }
+            benchmark::DoNotOptimize(writer.data());
+            ++value;
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sv::VALUES_PER_ASDU * 8));
+    }
+
+    void BM_BufferReaderDataset(benchmark::State& state)
+    {
+        sv::BufferWriter writer(sv::VALUES_PER_ASDU * 8);
+        for (size_t n = 0; n < sv::VALUES_PER_ASDU; ++n)
+        {
+            writer.writeInt32(static_cast<int32_t>(1000 * n));
+            writer.writeUint32(0x2000);
+        }
+        const std::vector<uint8_t> bytes(writer.data(), writer.data() + writer.size());
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            sv::BufferReader reader(bytes);
+            int64_t sum = 0;
+            for (size_t n = 0; n < sv::VALUES_PER_ASDU; ++n)
+            {
+                sum += reader.readInt32();
+                sum += reader.readUint32();
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+    }
+
+    /// @brief Raw word to flags and back, as the codec does for every value
+    void BM_QualityRoundTrip(benchmark::State& state)
+    {
+        uint32_t raw = 0x2001;
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            const sv::Quality quality(raw);
+            benchmark::DoNotOptimize(quality.validity);
+            raw = quality.toRaw() ^ 0x1;
+            benchmark::DoNotOptimize(raw);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// @brief One pipeline stage record into the calling thread's shard
+    void BM_PipelineRecord(benchmark::State& state)
+    {
+        uint64_t ns = 1000;
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            sv::PipelineLatency::record(sv::PipelineStage::PARSED, ns);
+            ns = (ns * 7 + 13) & 0xFFFFF;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// @brief What a receive loop pays per stage: clock read plus record against the frame origin
+    void BM_PipelineMark(benchmark::State& state)
+    {
+        const sv::PipelineFrame frame(sv::PipelineLatency::nowNs());
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            sv::PipelineLatency::mark(sv::PipelineStage::CALLBACK);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_MacAddressTryParse(benchmark::State& state)
+    {
+        const std::array<std::string, 2> inputs{"01:0C:CD:04:00:01", "01:0c:cd:04:ff:ff"};
+        size_t n = 0;
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(sv::MacAddress::tryParse(inputs[n]));
+            n ^= 1;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    void BM_MacAddressToString(benchmark::State& state)
+    {
+        const sv::MacAddress mac(std::array<uint8_t, 6>{0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01});
+
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(mac.toString());
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_BufferWriterDataset);
+BENCHMARK(BM_BufferReaderDataset);
+BENCHMARK(BM_QualityRoundTrip);
+BENCHMARK(BM_PipelineRecord);
+BENCHMARK(BM_PipelineMark);
+BENCHMARK(BM_MacAddressTryParse);
+BENCHMARK(BM_MacAddressToString);
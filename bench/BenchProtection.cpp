@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+#include "Allocations.h"
+#include "sv/protection/Protection.h"
+
+#include <chrono>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    /// @brief One 80 sample cycle of rotating phasors of a magnitude
+    std::vector<std::complex<double>> cycle(const double magnitude, const double angleRad = 0.0)
+    {
+        std::vector<std::complex<double>> phasors(80);
+        for (size_t n = 0; n < phasors.size(); ++n)
+        {
+            phasors[n] = std::polar(magnitude, angleRad + 2.0 * std::numbers::pi * static_cast<double>(n) / 80.0);
+        }
+        return phasors;
+    }
+
+    /// @brief Arg 0: load, the impedance outside all zones; arg 1: a fault inside zone 1
+    void BM_DistanceProtectionUpdate(benchmark::State& state)
+    {
+        const auto protection = sv::DistanceProtection::create();
+        const auto voltages = cycle(6350.0);
+        const auto currents = state.range(0) == 0 ? cycle(100.0, -0.3) : cycle(1500.0, -1.0);
+        constexpr std::chrono::nanoseconds period(250'000);
+
+        size_t n = 0;
+        std::chrono::nanoseconds time{0};
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(protection->update(voltages[n], currents[n], time));
+            n = n + 1 == voltages.size() ? 0 : n + 1;
+            time += period;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    /// @brief Arg 0: through current; arg 1: an internal fault
+    void BM_DifferentialProtectionUpdate(benchmark::State& state)
+    {
+        const auto protection = sv::DifferentialProtection::create();
+        const auto side1 = cycle(100.0);
+        const auto side2 = state.range(0) == 0 ? cycle(100.0, std::numbers::pi) : cycle(2000.0);
+
+        size_t n = 0;
+        const sv::bench::AllocationCounter allocations(state);
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(protection->update(side1[n], side2[n]));
+            n = n + 1 == side1.size() ? 0 : n + 1;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(BM_DistanceProtectionUpdate)->Arg(0)->Arg(1);
+BENCHMARK(BM_DifferentialProtectionUpdate)->Arg(0)->Arg(1);
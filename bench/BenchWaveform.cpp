@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+#include "sv/sim/Waveform.h"
+
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <vector>
+
+namespace
+{
+    /// @brief Baseline: six sin() calls per sample and stream, as the demo publisher does
+    void BM_WaveformSin(benchmark::State& state)
+    {
+        const auto streams = static_cast<size_t>(state.range(0));
+        const double omega = 2.0 * std::numbers::pi * 50.0;
+        const double shift = 2.0 * std::numbers::pi / 3.0;
+        std::vector<int32_t> out(streams * sv::VALUES_PER_ASDU);
+
+        uint64_t n = 0;
+        for (auto _ : state)
+        {
+            const double time = static_cast<double>(n++) / 4000.0;
+            for (size_t stream = 0; stream < streams; ++stream)
+            {
+                // Each stream has its own phase, so no call is shared between streams
+                const double phase = static_cast<double>(stream) * 0.001;
+                const double angle = omega * time + phase;
+                int32_t* dataset = out.data() + stream * sv::VALUES_PER_ASDU;
+                dataset[0] = static_cast<int32_t>(141.4 * std::sin(angle) * 1000);
+                dataset[1] = static_cast<int32_t>(141.4 * std::sin(angle - shift) * 1000);
+                dataset[2] = static_cast<int32_t>(141.4 * std::sin(angle + shift) * 1000);
+                dataset[4] = static_cast<int32_t>(8980.3 * std::sin(angle) * 100);
+                dataset[5] = static_cast<int32_t>(8980.3 * std::sin(angle - shift) * 100);
+                dataset[6] = static_cast<int32_t>(8980.3 * std::sin(angle + shift) * 100);
+            }
+            benchmark::DoNotOptimize(out.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(streams));
+    }
+
+    void BM_WaveformGenerator(benchmark::State& state)
+    {
+        const auto streams = static_cast<size_t>(state.range(0));
+        const auto generator = sv::sim::WaveformGenerator::create();
+        for (size_t stream = 0; stream < streams; ++stream)
+        {
+            generator->addStream(sv::sim::WaveformDefinition::balanced(100.0, 6350.0));
+        }
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(generator->step().data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(streams));
+    }
+
+    /// @brief The generator with a 5th harmonic on every current channel
+    void BM_WaveformGeneratorHarmonics(benchmark::State& state)
+    {
+        const auto streams = static_cast<size_t>(state.range(0));
+        const auto generator = sv::sim::WaveformGenerator::create();
+        auto definition = sv::sim::WaveformDefinition::balanced(100.0, 6350.0);
+        for (size_t phase = 0; phase < 3; ++phase)
+        {
+            definition.channels[phase].harmonics = {{.order = 5, .rms = 10.0}};
+        }
+        for (size_t stream = 0; stream < streams; ++stream)
+        {
+            generator->addStream(definition);
+        }
+
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(generator->step().data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(streams));
+    }
+}
+
+BENCHMARK(BM_WaveformSin)->Arg(1)->Arg(64)->Arg(512);
+BENCHMARK(BM_WaveformGenerator)->Arg(1)->Arg(64)->Arg(512);
+BENCHMARK(BM_WaveformGeneratorHarmonics)->Arg(1)->Arg(64)->Arg(512);
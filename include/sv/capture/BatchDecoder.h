@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief Caller-provided columnar output of BatchDecoder. \struct SampleColumns
+     *
+     * Row i of every column belongs to input frame i. All spans must hold at least as many
+     * elements as frames are decoded; quality may be left empty to skip it.
+     */
+    struct SampleColumns
+    {
+        std::span<uint16_t> smpCnt;
+        std::span<int64_t> timestampNs;
+        std::array<std::span<int32_t>, VALUES_PER_ASDU> value;
+        std::array<std::span<uint32_t>, VALUES_PER_ASDU> quality;
+
+        /**
+         * @brief Gets the number of rows every column can hold.
+         * @return The smallest column size.
+         */
+        [[nodiscard]] size_t capacity() const noexcept;
+    };
+
+    /**
+     * @brief Identity of a contiguous run of frames from one stream. \struct StreamRun
+     *
+     * Rows not covered by any run belong to frames that could not be decoded.
+     */
+    struct StreamRun
+    {
+        std::string svID;
+        uint16_t appID{0};
+        uint32_t confRev{0};
+        SmpSynch smpSynch{SmpSynch::None};
+        uint16_t vlanID{0};
+        bool simulate{false};
+        std::array<uint8_t, 6> destMac{};
+        std::array<uint8_t, 6> srcMac{};
+        size_t firstRow{0};
+        size_t rowCount{0};
+    };
+
+    /// @brief Result of BatchDecoder::decode(). \struct BatchDecodeResult
+    struct BatchDecodeResult
+    {
+        size_t decoded{0};
+        size_t rejected{0};
+        std::vector<StreamRun> runs;
+    };
+
+    /**
+     * @brief Allocation-free SV frame decoder writing into columnar arrays. \class BatchDecoder
+     *
+     * Unlike FrameCodec::decode(), no ASDU objects are built: fixed-offset fields are read
+     * straight from the frame into the caller's columns and the stream identity (svID, APPID,
+     * confRev, addresses) is materialised once per run of frames instead of once per frame.
+     * Chunks of frames are decoded in parallel with std::execution::par and their runs merged.
+     */
+    class BatchDecoder
+    {
+    public:
+        /// @brief Number of frames decoded per parallel task.
+        static constexpr size_t DEFAULT_CHUNK_SIZE = 4096;
+
+        /**
+         * @brief Decodes frames into columns.
+         * @param frames The raw frames, each starting at the destination MAC.
+         * @param columns The output columns; row i receives frame i.
+         * @param chunkSize Frames per parallel task (0 decodes sequentially).
+         * @return Decode counters and the stream runs.
+         * @throws std::invalid_argument if the columns hold fewer rows than there are frames.
+         */
+        static BatchDecodeResult decode(std::span<const std::span<const uint8_t>> frames, const SampleColumns& columns,
+                                        size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+        /**
+         * @brief Owning column storage sized for a number of frames. \struct Storage
+         */
+        struct Storage
+        {
+            std::vector<uint16_t> smpCnt;
+            std::vector<int64_t> timestampNs;
+            std::array<std::vector<int32_t>, VALUES_PER_ASDU> value;
+            std::array<std::vector<uint32_t>, VALUES_PER_ASDU> quality;
+
+            /**
+             * @brief Allocates all columns.
+             * @param rows The number of rows.
+             */
+            explicit Storage(size_t rows);
+
+            /**
+             * @brief Gets span views of all columns.
+             * @return The SampleColumns.
+             */
+            [[nodiscard]] SampleColumns columns();
+        };
+    };
+}
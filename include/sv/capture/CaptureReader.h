@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief A frame read from a capture file. \struct CapturedFrame
+    struct CapturedFrame
+    {
+        std::span<const uint8_t> data;
+        uint64_t timestampNs{0};
+        uint32_t originalLength{0};
+    };
+
+    /// @brief Capture file format. \enum CaptureFormat
+    enum class CaptureFormat
+    {
+        Pcap,
+        Pcapng
+    };
+
+    /**
+     * @brief Memory-mapped reader for pcap and pcapng files. \class CaptureReader
+     *
+     * Frames are returned as views into the mapping, so iterating a capture never copies
+     * packet data. Both byte orders, microsecond/nanosecond pcap and per-interface pcapng
+     * timestamp resolutions are supported. Returned spans stay valid for the lifetime of the reader.
+     */
+    class CaptureReader
+    {
+    public:
+        /**
+         * @brief Opens and maps a capture file.
+         * @param path The capture file path.
+         * @return A unique pointer to the reader.
+         * @throws std::runtime_error if the file cannot be mapped or is not a pcap/pcapng file.
+         */
+        static std::unique_ptr<CaptureReader> open(const std::string& path);
+
+        /**
+         * @brief Destructor unmaps the file.
+         */
+        ~CaptureReader();
+
+        CaptureReader(const CaptureReader&) = delete;
+        CaptureReader& operator=(const CaptureReader&) = delete;
+
+        /**
+         * @brief Reads the next frame.
+         * @return The frame, or std::nullopt at the end of the file or on a truncated record.
+         */
+        [[nodiscard]] std::optional<CapturedFrame> next();
+
+        /**
+         * @brief Rewinds to the first frame.
+         */
+        void rewind();
+
+        /**
+         * @brief Reads all remaining frames.
+         * @return The frames in file order.
+         */
+        [[nodiscard]] std::vector<CapturedFrame> readAll();
+
+        /**
+         * @brief Gets the detected file format.
+         * @return The CaptureFormat.
+         */
+        [[nodiscard]] CaptureFormat getFormat() const noexcept;
+
+        /**
+         * @brief Gets the mapped file size.
+         * @return The size in bytes.
+         */
+        [[nodiscard]] size_t getFileSize() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use open() method.
+         * @param data The mapped file data.
+         * @param size The mapped size.
+         */
+        CaptureReader(const uint8_t* data, size_t size);
+
+        /**
+         * @brief Reads a 16-bit value in the file's byte order.
+         * @param offset The byte offset.
+         * @return The value.
+         */
+        [[nodiscard]] uint16_t read16(size_t offset) const noexcept;
+
+        /**
+         * @brief Reads a 32-bit value in the file's byte order.
+         * @param offset The byte offset.
+         * @return The value.
+         */
+        [[nodiscard]] uint32_t read32(size_t offset) const noexcept;
+
+        /**
+         * @brief Reads the next pcap record.
+         * @return The frame, or std::nullopt at the end.
+         */
+        [[nodiscard]] std::optional<CapturedFrame> nextPcap();
+
+        /**
+         * @brief Reads the next pcapng packet block, processing header blocks on the way.
+         * @return The frame, or std::nullopt at the end.
+         */
+        [[nodiscard]] std::optional<CapturedFrame> nextPcapng();
+
+        /**
+         * @brief Parses an Interface Description Block's timestamp resolution.
+         * @param offset Offset of the block.
+         * @param length Total block length.
+         */
+        void parseInterfaceDescription(size_t offset, uint32_t length);
+
+        /**
+         * @brief Converts a raw timestamp to nanoseconds for an interface.
+         * @param interfaceId The pcapng interface id.
+         * @param raw The raw timestamp in interface units.
+         * @return The timestamp in nanoseconds.
+         */
+        [[nodiscard]] uint64_t toNanoseconds(uint32_t interfaceId, uint64_t raw) const noexcept;
+
+        /// @brief Timestamp resolution of a pcapng interface. \struct Resolution
+        struct Resolution
+        {
+            uint8_t exponent{6};
+            bool base2{false};
+        };
+
+        const uint8_t* data_;
+        size_t size_;
+        size_t offset_{0};
+        size_t firstRecord_{0};
+        CaptureFormat format_{CaptureFormat::Pcap};
+        bool swapped_{false};
+        bool pcapNanoseconds_{false};
+        std::vector<Resolution> interfaces_;
+    };
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "sv/capture/CaptureReader.h"
+#include "sv/network/NetworkSender.h"
+#include "sv/network/NetworkReceiver.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Pacing mode of a capture replay. \enum ReplayTiming
+    enum class ReplayTiming
+    {
+        Original,           ///< Reproduce the captured inter-frame gaps
+        Scaled,             ///< Captured gaps divided by the speed factor
+        AsFastAsPossible    ///< No pacing
+    };
+
+    /// @brief Options for CaptureReplayer::replay(). \struct ReplayOptions
+    struct ReplayOptions
+    {
+        ReplayTiming timing{ReplayTiming::Original};
+        double speed{1.0};
+        size_t loops{1};
+    };
+
+    /// @brief Result of a capture replay. \struct ReplayStats
+    struct ReplayStats
+    {
+        uint64_t frames{0};
+        uint64_t bytes{0};
+        uint64_t rejected{0};
+        uint64_t lateFrames{0};
+        uint64_t maxLatenessNs{0};
+        double elapsedSeconds{0.0};
+
+        /**
+         * @brief Gets the achieved frame rate.
+         * @return Frames per second.
+         */
+        [[nodiscard]] double framesPerSecond() const noexcept;
+    };
+
+    /**
+     * @brief Replays a pcap/pcapng capture into a sender or the SV parser. \class CaptureReplayer
+     *
+     * The capture is memory mapped and indexed once, so the replay loop only walks spans into
+     * the mapping. Pacing uses absolute CLOCK_MONOTONIC deadlines so sleep overshoot does not
+     * accumulate; frames more than LATE_THRESHOLD_NS behind their deadline are counted as late.
+     */
+    class CaptureReplayer
+    {
+    public:
+        /**
+         * @brief Sink receiving each replayed frame.
+         * Returns false if the frame was rejected (counted in ReplayStats::rejected).
+         */
+        using FrameSink = std::function<bool(const CapturedFrame&)>;
+
+        /// @brief Lateness above which a frame counts as late.
+        static constexpr uint64_t LATE_THRESHOLD_NS = 1'000'000;
+
+        /**
+         * @brief Opens and indexes a capture file.
+         * @param path The pcap or pcapng file path.
+         * @return A unique pointer to the replayer.
+         * @throws std::runtime_error if the file cannot be read.
+         */
+        static std::unique_ptr<CaptureReplayer> create(const std::string& path);
+
+        /**
+         * @brief Replays all frames into a sink. Blocks until done or stop() is called.
+         * @param options The pacing options.
+         * @param sink The frame sink.
+         * @return The replay statistics.
+         */
+        ReplayStats replay(const ReplayOptions& options, const FrameSink& sink);
+
+        /**
+         * @brief Replays all frames unchanged through a NetworkSender.
+         * @param sender The sender.
+         * @param options The pacing options.
+         * @return The replay statistics.
+         */
+        ReplayStats replayTo(NetworkSender& sender, const ReplayOptions& options);
+
+        /**
+         * @brief Replays all frames through the SV frame parser.
+         * Frames that are not valid SV frames are counted as rejected.
+         * @param callback Called with every decoded ASDU.
+         * @param options The pacing options.
+         * @return The replay statistics.
+         */
+        ReplayStats replayToParser(const NetworkReceiver::Callback& callback, const ReplayOptions& options);
+
+        /**
+         * @brief Requests a running replay to stop. Safe to call from another thread.
+         */
+        void stop() noexcept;
+
+        /**
+         * @brief Gets the number of frames in the capture.
+         * @return The frame count.
+         */
+        [[nodiscard]] size_t getFrameCount() const noexcept;
+
+        /**
+         * @brief Gets the capture duration from first to last frame.
+         * @return The duration in nanoseconds.
+         */
+        [[nodiscard]] uint64_t getCaptureDurationNs() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param reader The opened capture reader.
+         */
+        explicit CaptureReplayer(std::unique_ptr<CaptureReader> reader);
+
+        std::unique_ptr<CaptureReader> reader_;
+        std::vector<CapturedFrame> frames_;
+        std::atomic<bool> stopRequested_{false};
+    };
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief pcapng block type and option constants.
+    namespace pcapng
+    {
+        constexpr uint32_t SECTION_HEADER_BLOCK = 0x0A0D0D0A;
+        constexpr uint32_t INTERFACE_DESCRIPTION_BLOCK = 0x00000001;
+        constexpr uint32_t ENHANCED_PACKET_BLOCK = 0x00000006;
+        constexpr uint32_t BYTE_ORDER_MAGIC = 0x1A2B3C4D;
+        constexpr uint16_t LINKTYPE_ETHERNET = 1;
+        constexpr uint16_t OPTION_END = 0;
+        constexpr uint16_t OPTION_IF_TSRESOL = 9;
+    }
+
+    /// @brief Capture counters of a PcapngWriter. \struct CaptureStats
+    struct CaptureStats
+    {
+        uint64_t capturedFrames{0};
+        uint64_t droppedFrames{0};
+        uint64_t bytesWritten{0};
+    };
+
+    /**
+     * @brief Asynchronous pcapng file writer for the receive path. \class PcapngWriter
+     *
+     * Frames are appended as Enhanced Packet Blocks with nanosecond timestamps into one of two
+     * large buffers. A full buffer is handed to a writer thread that flushes it with a single
+     * sequential write() while the receive thread keeps filling the other one. If the disk falls
+     * behind and both buffers are busy, frames are dropped and counted instead of stalling the
+     * receiver.
+     *
+     * capture() must only be called from one thread at a time.
+     */
+    class PcapngWriter
+    {
+    public:
+        /// @brief Default size of each of the two capture buffers.
+        static constexpr size_t DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+        /// @brief Default snapshot length (full Ethernet frames).
+        static constexpr uint32_t DEFAULT_SNAPLEN = 65535;
+
+        /// @brief Default time after which a partially filled buffer is flushed.
+        static constexpr uint64_t DEFAULT_FLUSH_INTERVAL_NS = 1'000'000'000;
+
+        /**
+         * @brief Creates a writer and writes the section and interface headers.
+         * @param path The output file path. An existing file is truncated.
+         * @param bufferSize Size of each of the two capture buffers in bytes.
+         * @return A unique pointer to the writer.
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        static std::unique_ptr<PcapngWriter> create(const std::string& path, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+        /**
+         * @brief Destructor flushes pending data and closes the file.
+         */
+        ~PcapngWriter();
+
+        PcapngWriter(const PcapngWriter&) = delete;
+        PcapngWriter& operator=(const PcapngWriter&) = delete;
+
+        /**
+         * @brief Appends a frame to the capture.
+         * @param frame The raw frame bytes, starting at the destination MAC.
+         * @param timestampNs Receive time in nanoseconds since the Unix epoch.
+         * @return false if the frame was dropped because the writer fell behind.
+         */
+        bool capture(std::span<const uint8_t> frame, uint64_t timestampNs);
+
+        /**
+         * @brief Hands the current buffer to the writer thread even if not full.
+         */
+        void flush();
+
+        /**
+         * @brief Flushes pending data, stops the writer thread and closes the file.
+         */
+        void close();
+
+        /**
+         * @brief Gets the capture counters.
+         * @return The current CaptureStats.
+         */
+        [[nodiscard]] CaptureStats getStats() const noexcept;
+
+        /**
+         * @brief Gets the output file path.
+         * @return The path.
+         */
+        [[nodiscard]] const std::string& getPath() const noexcept;
+
+    private:
+        /// @brief A capture buffer. \struct Buffer
+        struct Buffer
+        {
+            std::vector<uint8_t> data;
+            size_t used{0};
+        };
+
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param path The output file path.
+         * @param fd The open file descriptor.
+         * @param bufferSize Size of each capture buffer.
+         */
+        PcapngWriter(std::string path, int fd, size_t bufferSize);
+
+        /**
+         * @brief Appends the section header and interface description blocks.
+         */
+        void writeHeaders();
+
+        /**
+         * @brief Hands the active buffer to the writer thread if it is idle.
+         * @return false if the writer thread is still busy with the other buffer.
+         */
+        bool swapBuffers();
+
+        /**
+         * @brief Writer thread loop.
+         */
+        void writerLoop();
+
+        /**
+         * @brief Writes a whole buffer to the file.
+         * @param buffer The buffer to write.
+         */
+        void writeBuffer(const Buffer& buffer);
+
+        std::string path_;
+        int fd_;
+
+        Buffer buffers_[2];
+        Buffer* active_;
+        Buffer* pending_{nullptr};
+        uint64_t lastSwapNs_{0};
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stopping_{false};
+        std::thread writerThread_;
+
+        std::atomic<uint64_t> captured_{0};
+        std::atomic<uint64_t> dropped_{0};
+        std::atomic<uint64_t> bytesWritten_{0};
+    };
+}
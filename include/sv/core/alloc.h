@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "sv/core/ring.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Hot path an allocation is attributed to \enum AllocationScope
+    enum class AllocationScope : uint8_t
+    {
+        NONE,       ///< Outside every named scope
+        ENCODE,     ///< Building and sending a frame
+        PARSE,      ///< Decoding a received frame
+        DISPATCH,   ///< Receive loops and subscriber callbacks
+        PROTECT     ///< Protection element updates
+    };
+
+    /// @brief Number of AllocationScope values
+    inline constexpr size_t ALLOCATION_SCOPES = 5;
+
+    /// @brief Convert AllocationScope to string
+    inline const char* toString(const AllocationScope scope)
+    {
+        switch (scope)
+        {
+            case AllocationScope::NONE: return "none";
+            case AllocationScope::ENCODE: return "encode";
+            case AllocationScope::PARSE: return "parse";
+            case AllocationScope::DISPATCH: return "dispatch";
+            case AllocationScope::PROTECT: return "protect";
+            default: return "unknown";
+        }
+    }
+
+    /// @brief Allocation counters of one scope \struct AllocationCounts
+    struct AllocationCounts
+    {
+        uint64_t allocations{0};
+        uint64_t deallocations{0};
+        uint64_t bytes{0};
+    };
+
+    /**
+     * @brief Counts global operator new/delete calls per AllocationScope. \class AllocationTracker
+     *
+     * The counters always exist but only move when a binary links the opt-in
+     * iec61850_sv_alloc_hook object library, whose replacement global operators report here.
+     * Without it the library only pays for the thread-local scope stores of
+     * AllocationScopeGuard. Counting is a relaxed atomic increment on the current scope, so
+     * the numbers are exact once the threads under test are quiescent.
+     */
+    class AllocationTracker
+    {
+    public:
+        /**
+         * @brief Checks if the counting operators are linked into this binary.
+         * @return true if allocations are counted.
+         */
+        [[nodiscard]] static bool isInstalled() noexcept
+        {
+            return installed_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the scope allocations of the calling thread are attributed to.
+         * @return The innermost active scope.
+         */
+        [[nodiscard]] static AllocationScope current() noexcept
+        {
+            return current_;
+        }
+
+        /**
+         * @brief Gets the counters of one scope.
+         * @param scope The scope.
+         * @return The counts since the last reset.
+         */
+        [[nodiscard]] static AllocationCounts get(const AllocationScope scope) noexcept
+        {
+            const auto& counters = counters_[static_cast<size_t>(scope)];
+            return {counters.allocations.load(std::memory_order_relaxed),
+                    counters.deallocations.load(std::memory_order_relaxed),
+                    counters.bytes.load(std::memory_order_relaxed)};
+        }
+
+        /**
+         * @brief Gets the counters of all scopes together.
+         * @return The counts since the last reset.
+         */
+        [[nodiscard]] static AllocationCounts total() noexcept
+        {
+            AllocationCounts sum;
+            for (size_t n = 0; n < ALLOCATION_SCOPES; ++n)
+            {
+                const auto counts = get(static_cast<AllocationScope>(n));
+                sum.allocations += counts.allocations;
+                sum.deallocations += counts.deallocations;
+                sum.bytes += counts.bytes;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Clears all counters. Not synchronized with concurrent allocations.
+         */
+        static void reset() noexcept
+        {
+            for (auto& counters : counters_)
+            {
+                counters.allocations.store(0, std::memory_order_relaxed);
+                counters.deallocations.store(0, std::memory_order_relaxed);
+                counters.bytes.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Counts an allocation in the current scope. Called by the hook.
+         * @param bytes The requested size.
+         */
+        static void recordAllocation(const size_t bytes) noexcept
+        {
+            auto& counters = counters_[static_cast<size_t>(current_)];
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Counts a deallocation in the current scope. Called by the hook.
+         */
+        static void recordDeallocation() noexcept
+        {
+            counters_[static_cast<size_t>(current_)].deallocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Marks the counting operators as linked. Called by the hook.
+         */
+        static void install() noexcept
+        {
+            installed_.store(true, std::memory_order_relaxed);
+        }
+
+    private:
+        friend class AllocationScopeGuard;
+
+        /// @brief Counters of one scope, on their own cache line; std::atomic value-initializes to zero \struct Counters
+        struct alignas(CACHE_LINE_SIZE) Counters
+        {
+            std::atomic<uint64_t> allocations;
+            std::atomic<uint64_t> deallocations;
+            std::atomic<uint64_t> bytes;
+        };
+
+        inline static std::array<Counters, ALLOCATION_SCOPES> counters_{};
+        inline static std::atomic<bool> installed_{false};
+        inline static thread_local AllocationScope current_{AllocationScope::NONE};
+    };
+
+    /**
+     * @brief Attributes the calling thread's allocations to a scope while alive. \class AllocationScopeGuard
+     *
+     * Guards nest; the innermost one wins and the previous scope is restored on destruction.
+     */
+    class AllocationScopeGuard
+    {
+    public:
+        /**
+         * @brief Enters a scope.
+         * @param scope The scope.
+         */
+        explicit AllocationScopeGuard(const AllocationScope scope) noexcept
+            : previous_(std::exchange(AllocationTracker::current_, scope))
+        {
+        }
+
+        /**
+         * @brief Restores the enclosing scope.
+         */
+        ~AllocationScopeGuard()
+        {
+            AllocationTracker::current_ = previous_;
+        }
+
+        AllocationScopeGuard(const AllocationScopeGuard&) = delete;
+        AllocationScopeGuard& operator=(const AllocationScopeGuard&) = delete;
+
+    private:
+        AllocationScope previous_;
+    };
+}
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
 #include <span>
@@ -375,6 +376,30 @@ namespace sv
             return str;
         }
 
+        /**
+         * @brief Reads a fixed-size string field without copying, trimming at the first null byte.
+         * @param fixedSize The fixed size of the string field.
+         * @return A view into the underlying buffer, valid as long as the buffer.
+         */
+        std::string_view readFixedStringView(size_t fixedSize)
+        {
+            if (pos_ + fixedSize > length_)
+            {
+                fixedSize = length_ - pos_;
+            }
+
+            std::string_view str(reinterpret_cast<const char*>(data_ + pos_), fixedSize);
+            pos_ += fixedSize;
+
+            const size_t null_pos = str.find('\0');
+            if (null_pos != std::string_view::npos)
+            {
+                str = str.substr(0, null_pos);
+            }
+
+            return str;
+        }
+
         /**
          * @brief Reads raw bytes into a buffer.
          * @param dest Destination buffer.
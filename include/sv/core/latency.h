@@ -0,0 +1,220 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief Lock-free log-linear latency histogram. \class LatencyHistogram
+     *
+     * Values are binned by their power of two and then split into 8 linear sub-buckets, so
+     * every bucket is at most 12.5 % wide across the full 64-bit range. Recording is a handful
+     * of relaxed atomic increments and never allocates, so it can be called from hot paths on
+     * any number of threads; readers get a consistent view once writers are quiescent.
+     */
+    class LatencyHistogram
+    {
+    public:
+        /// @brief Sub-bucket resolution in bits per power of two
+        static constexpr unsigned SUB_BUCKET_BITS = 3;
+        static constexpr uint64_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+        /**
+         * @brief Records one value.
+         * @param ns The latency in nanoseconds.
+         */
+        void record(const uint64_t ns) noexcept
+        {
+            buckets_[bucketFor(ns)].fetch_add(1, std::memory_order_relaxed);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(ns, std::memory_order_relaxed);
+
+            uint64_t max = max_.load(std::memory_order_relaxed);
+            while (ns > max && !max_.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /**
+         * @brief Records one value from the only thread that writes this histogram.
+         * Plain relaxed loads and stores instead of read-modify-writes, so no locked
+         * instructions; concurrent readers still see whole values.
+         * @param ns The latency in nanoseconds.
+         */
+        void recordExclusive(const uint64_t ns) noexcept
+        {
+            auto& bucket = buckets_[bucketFor(ns)];
+            bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            count_.store(count_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            sum_.store(sum_.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+            if (ns > max_.load(std::memory_order_relaxed))
+            {
+                max_.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Adds the counts of another histogram to this one.
+         * @param other The histogram to add.
+         */
+        void merge(const LatencyHistogram& other) noexcept
+        {
+            for (size_t i = 0; i < BUCKETS; ++i)
+            {
+                const uint64_t n = other.buckets_[i].load(std::memory_order_relaxed);
+                if (n != 0)
+                {
+                    buckets_[i].fetch_add(n, std::memory_order_relaxed);
+                }
+            }
+            count_.fetch_add(other.count(), std::memory_order_relaxed);
+            sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            const uint64_t otherMax = other.maxNs();
+            uint64_t max = max_.load(std::memory_order_relaxed);
+            while (otherMax > max && !max_.compare_exchange_weak(max, otherMax, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /**
+         * @brief Getter for the number of recorded values.
+         * @return The count.
+         */
+        [[nodiscard]] uint64_t count() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Getter for the largest recorded value.
+         * @return The maximum in nanoseconds.
+         */
+        [[nodiscard]] uint64_t maxNs() const noexcept
+        {
+            return max_.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Getter for the mean of the recorded values.
+         * @return The mean in nanoseconds, 0 if empty.
+         */
+        [[nodiscard]] double meanNs() const noexcept
+        {
+            const uint64_t n = count();
+            return n == 0 ? 0.0 : static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(n);
+        }
+
+        /**
+         * @brief Estimates a percentile as the upper bound of the bucket that contains it.
+         * @param percent The percentile in [0, 100].
+         * @return The value in nanoseconds, 0 if empty.
+         */
+        [[nodiscard]] uint64_t percentileNs(const double percent) const noexcept
+        {
+            const uint64_t n = count();
+            if (n == 0)
+            {
+                return 0;
+            }
+
+            const double clamped = percent < 0.0 ? 0.0 : (percent > 100.0 ? 100.0 : percent);
+            uint64_t target = static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(n) + 0.999999);
+            target = target == 0 ? 1 : target;
+
+            uint64_t cumulative = 0;
+            for (size_t i = 0; i < BUCKETS; ++i)
+            {
+                cumulative += buckets_[i].load(std::memory_order_relaxed);
+                if (cumulative >= target)
+                {
+                    const uint64_t upper = bucketUpperBound(i);
+                    return upper < maxNs() ? upper : maxNs();
+                }
+            }
+            return maxNs();
+        }
+
+        /**
+         * @brief Getter for the count of one bucket.
+         * @param index The bucket index.
+         * @return The count.
+         */
+        [[nodiscard]] uint64_t bucketCount(const size_t index) const noexcept
+        {
+            return index < BUCKETS ? buckets_[index].load(std::memory_order_relaxed) : 0;
+        }
+
+        /**
+         * @brief Clears all counters. Not synchronized with concurrent record() calls.
+         */
+        void reset() noexcept
+        {
+            for (auto& bucket : buckets_)
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            count_.store(0, std::memory_order_relaxed);
+            sum_.store(0, std::memory_order_relaxed);
+            max_.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Maps a value to its bucket.
+         * @param ns The value.
+         * @return The bucket index.
+         */
+        [[nodiscard]] static constexpr size_t bucketFor(const uint64_t ns) noexcept
+        {
+            if (ns < SUB_BUCKETS)
+            {
+                return static_cast<size_t>(ns);
+            }
+            const unsigned exponent = static_cast<unsigned>(std::bit_width(ns)) - 1;
+            const uint64_t sub = (ns >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+            return static_cast<size_t>((exponent - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub);
+        }
+
+        /**
+         * @brief Smallest value that maps to a bucket.
+         * @param index The bucket index.
+         * @return The lower bound in nanoseconds.
+         */
+        [[nodiscard]] static constexpr uint64_t bucketLowerBound(const size_t index) noexcept
+        {
+            if (index < SUB_BUCKETS)
+            {
+                return index;
+            }
+            const unsigned exponent = static_cast<unsigned>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+            return (SUB_BUCKETS + index % SUB_BUCKETS) << (exponent - SUB_BUCKET_BITS);
+        }
+
+        /**
+         * @brief Largest value that maps to a bucket.
+         * @param index The bucket index.
+         * @return The upper bound in nanoseconds.
+         */
+        [[nodiscard]] static constexpr uint64_t bucketUpperBound(const size_t index) noexcept
+        {
+            if (index < SUB_BUCKETS)
+            {
+                return index;
+            }
+            const unsigned exponent = static_cast<unsigned>(index / SUB_BUCKETS) + SUB_BUCKET_BITS - 1;
+            return bucketLowerBound(index) + ((uint64_t{1} << (exponent - SUB_BUCKET_BITS)) - 1);
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, BUCKETS> buckets_{};
+        std::atomic<uint64_t> count_{0};
+        std::atomic<uint64_t> sum_{0};
+        std::atomic<uint64_t> max_{0};
+    };
+}
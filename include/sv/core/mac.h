@@ -81,34 +81,49 @@ namespace sv
 
         /**
          * @brief Tries to parse a MAC address from a string.
+         * Accepts exactly six groups of one or two hex digits separated by ':'. Does not allocate,
+         * so senders may call it for every frame.
          * @param str The string representation of the MAC address.
          * @return Optional containing MacAddress if parsing was successful, std::nullopt otherwise.
          */
-        [[nodiscard]] static std::optional<MacAddress> tryParse(std::string_view str)
+        [[nodiscard]] static constexpr std::optional<MacAddress> tryParse(std::string_view str)
         {
             std::array<uint8_t, LENGTH> bytes{};
-            std::istringstream iss{std::string(str)};
-            std::string segment;
-            size_t index = 0;
+            size_t pos = 0;
 
-            while (std::getline(iss, segment, ':') && index < LENGTH)
+            for (size_t index = 0; index < LENGTH; ++index)
             {
-                try
+                if (index > 0)
                 {
-                    const unsigned long value = std::stoul(segment, nullptr, 16);
-                    if (value > 0xFF)
+                    if (pos >= str.size() || str[pos] != ':')
                     {
                         return std::nullopt;
                     }
-                    bytes[index++] = static_cast<uint8_t>(value);
+                    ++pos;
                 }
-                catch (const std::exception&)
+
+                size_t digits = 0;
+                unsigned value = 0;
+                while (pos < str.size() && digits < 2)
+                {
+                    const int nibble = hexValue(str[pos]);
+                    if (nibble < 0)
+                    {
+                        break;
+                    }
+                    value = (value << 4) | static_cast<unsigned>(nibble);
+                    ++digits;
+                    ++pos;
+                }
+
+                if (digits == 0)
                 {
                     return std::nullopt;
                 }
+                bytes[index] = static_cast<uint8_t>(value);
             }
 
-            if (index != LENGTH)
+            if (pos != str.size())
             {
                 return std::nullopt;
             }
@@ -320,6 +335,19 @@ namespace sv
         }
 
     private:
+        /**
+         * @brief Converts one hex digit.
+         * @param c The character.
+         * @return The digit value, or -1 if c is not a hex digit.
+         */
+        [[nodiscard]] static constexpr int hexValue(const char c)
+        {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
         std::array<uint8_t, LENGTH> bytes_;
     };
 
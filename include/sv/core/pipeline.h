@@ -0,0 +1,317 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include "sv/core/latency.h"
+#include "sv/core/ring.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Point a received frame passes on its way to a trip \enum PipelineStage
+    enum class PipelineStage : uint8_t
+    {
+        KERNEL_RX,  ///< Receive queue: kernel timestamp (or loopback enqueue) to the receive loop
+        PARSED,     ///< Frame decoded
+        CALLBACK,   ///< Subscriber callback entered
+        DECISION,   ///< Protection element or engine evaluated the frame
+        TRIP        ///< Trip event delivered to the breaker subscribers
+    };
+
+    /// @brief Number of PipelineStage values
+    inline constexpr size_t PIPELINE_STAGES = 5;
+
+    /// @brief Convert PipelineStage to string
+    inline const char* toString(const PipelineStage stage)
+    {
+        switch (stage)
+        {
+            case PipelineStage::KERNEL_RX: return "KERNEL_RX";
+            case PipelineStage::PARSED: return "PARSED";
+            case PipelineStage::CALLBACK: return "CALLBACK";
+            case PipelineStage::DECISION: return "DECISION";
+            case PipelineStage::TRIP: return "TRIP";
+            default: return "UNKNOWN";
+        }
+    }
+
+    /// @brief Summary of one stage in a PipelineSnapshot \struct StageLatency
+    struct StageLatency
+    {
+        uint64_t count{0};
+        double meanNs{0.0};
+        uint64_t p50Ns{0};
+        uint64_t p99Ns{0};
+        uint64_t p999Ns{0};
+        uint64_t maxNs{0};
+    };
+
+    /// @brief Merged view of all recording threads at one point in time \struct PipelineSnapshot
+    struct PipelineSnapshot
+    {
+        std::array<StageLatency, PIPELINE_STAGES> stages{};
+        size_t threads{0};
+
+        /**
+         * @brief Gets the summary of one stage.
+         * @param stage The stage.
+         * @return The summary.
+         */
+        [[nodiscard]] const StageLatency& operator[](const PipelineStage stage) const noexcept
+        {
+            return stages[static_cast<size_t>(stage)];
+        }
+
+        /**
+         * @brief Formats the snapshot, one line per stage.
+         * @return The formatted text.
+         */
+        [[nodiscard]] std::string toString() const;
+    };
+
+    /**
+     * @brief Frame-to-trip latency histograms per PipelineStage. \class PipelineLatency
+     *
+     * Every value is the time from a frame's origin, the moment it reached the receive queue,
+     * to the stage. The receive loops stamp the origin with a PipelineFrame; the protection
+     * elements and the trip dispatcher read it back through frameOrigin() and TripEvent.
+     *
+     * Each recording thread owns a shard of histograms written with plain stores, so recording
+     * is a clock read plus a few uncontended cache lines and never allocates after the first
+     * call on a thread. snapshot() and merge() add up the shards of all threads, including
+     * threads that have exited. Always on; setEnabled(false) reduces recording to one load.
+     */
+    class PipelineLatency
+    {
+    public:
+        /**
+         * @brief Reads the clock all stages are measured with.
+         * @return steady_clock nanoseconds.
+         */
+        [[nodiscard]] static int64_t nowNs() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief Gets the origin of the frame the calling thread is processing.
+         * @return The nowNs() origin, 0 outside a PipelineFrame.
+         */
+        [[nodiscard]] static int64_t frameOrigin() noexcept
+        {
+            return origin_;
+        }
+
+        /**
+         * @brief Records a latency for a stage.
+         * @param stage The stage.
+         * @param ns The latency in nanoseconds.
+         */
+        static void record(const PipelineStage stage, const uint64_t ns) noexcept
+        {
+            if (!enabled_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            Shard* shard = shard_ != nullptr ? shard_ : acquireShard();
+            if (shard != nullptr)
+            {
+                shard->stages[static_cast<size_t>(stage)].recordExclusive(ns);
+            }
+        }
+
+        /**
+         * @brief Records the time from an origin to now. Ignored if the origin is unknown.
+         * @param stage The stage.
+         * @param originNs The nowNs() origin, 0 if unknown.
+         */
+        static void recordSince(const PipelineStage stage, const int64_t originNs) noexcept
+        {
+            if (originNs <= 0 || !enabled_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+            const int64_t now = nowNs();
+            record(stage, now > originNs ? static_cast<uint64_t>(now - originNs) : 0);
+        }
+
+        /**
+         * @brief Records the time from the current frame's origin to now.
+         * @param stage The stage.
+         */
+        static void mark(const PipelineStage stage) noexcept
+        {
+            recordSince(stage, origin_);
+        }
+
+        /**
+         * @brief Merges all threads into summaries.
+         * @return The snapshot.
+         */
+        [[nodiscard]] static PipelineSnapshot snapshot();
+
+        /**
+         * @brief Merges all threads' histograms of one stage into a histogram.
+         * @param stage The stage.
+         * @param out The histogram the counts are added to.
+         */
+        static void merge(PipelineStage stage, LatencyHistogram& out);
+
+        /**
+         * @brief Clears all histograms. Not synchronized with concurrent recording.
+         */
+        static void reset() noexcept;
+
+        /**
+         * @brief Turns recording on or off.
+         * @param enabled true to record.
+         */
+        static void setEnabled(const bool enabled) noexcept
+        {
+            enabled_.store(enabled, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Checks if recording is on.
+         * @return true if recording.
+         */
+        [[nodiscard]] static bool isEnabled() noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Histograms written by one thread \struct Shard
+        struct alignas(CACHE_LINE_SIZE) Shard
+        {
+            std::array<LatencyHistogram, PIPELINE_STAGES> stages;
+            std::atomic<bool> inUse{false};
+        };
+
+    private:
+        friend class PipelineFrame;
+
+        /**
+         * @brief Attaches a free or new shard to the calling thread.
+         * @return The shard, nullptr if none could be allocated.
+         */
+        static Shard* acquireShard() noexcept;
+
+        inline static std::atomic<bool> enabled_{true};
+        inline static thread_local Shard* shard_{nullptr};
+        inline static thread_local int64_t origin_{0};
+    };
+
+    /**
+     * @brief Sets the frame origin of the calling thread while alive. \class PipelineFrame
+     *
+     * Receive loops create one per frame before decoding; the previous origin is restored on
+     * destruction so unrelated work on the thread is not attributed to the frame.
+     */
+    class PipelineFrame
+    {
+    public:
+        /**
+         * @brief Enters a frame.
+         * @param originNs The nowNs() time the frame reached the receive queue.
+         */
+        explicit PipelineFrame(const int64_t originNs) noexcept
+            : previous_(std::exchange(PipelineLatency::origin_, originNs))
+        {
+        }
+
+        /**
+         * @brief Leaves the frame.
+         */
+        ~PipelineFrame()
+        {
+            PipelineLatency::origin_ = previous_;
+        }
+
+        PipelineFrame(const PipelineFrame&) = delete;
+        PipelineFrame& operator=(const PipelineFrame&) = delete;
+
+    private:
+        int64_t previous_;
+    };
+
+    /**
+     * @brief Periodically hands a PipelineSnapshot to a sink on its own thread. \class PipelineLatencyReporter
+     */
+    class PipelineLatencyReporter
+    {
+    public:
+        using Ptr = std::shared_ptr<PipelineLatencyReporter>;
+        using Sink = std::function<void(const PipelineSnapshot&)>;
+
+        /**
+         * @brief Creates a new reporter. The reporter thread is not started.
+         * @param period Time between two snapshots.
+         * @param sink Receives every snapshot; logs it with LOG_INFO if empty.
+         * @return A shared pointer to the created reporter.
+         * @throws std::invalid_argument if the period is not positive.
+         */
+        [[nodiscard]] static Ptr create(std::chrono::milliseconds period, Sink sink = {});
+
+        /**
+         * @brief Destructor. Stops the reporter thread.
+         */
+        ~PipelineLatencyReporter();
+
+        PipelineLatencyReporter(const PipelineLatencyReporter&) = delete;
+        PipelineLatencyReporter& operator=(const PipelineLatencyReporter&) = delete;
+
+        /**
+         * @brief Starts the reporter thread.
+         */
+        void start();
+
+        /**
+         * @brief Stops the reporter thread without a final report.
+         */
+        void stop();
+
+        /**
+         * @brief Checks if the reporter thread is running.
+         * @return true if running.
+         */
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        /**
+         * @brief Getter for the number of reports made.
+         * @return The count.
+         */
+        [[nodiscard]] uint64_t getReports() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param period Time between two snapshots.
+         * @param sink The snapshot sink.
+         */
+        PipelineLatencyReporter(std::chrono::milliseconds period, Sink sink);
+
+        /**
+         * @brief Reporter thread body.
+         */
+        void run();
+
+        const std::chrono::milliseconds period_;
+        const Sink sink_;
+
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::atomic<bool> running_{false};
+        std::atomic<uint64_t> reports_{0};
+        std::thread thread_;
+    };
+}
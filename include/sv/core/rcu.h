@@ -0,0 +1,235 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "sv/core/ring.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Number of RcuCell snapshots the calling thread currently has pinned
+    inline thread_local int rcuReadDepth = 0;
+
+    /**
+     * @brief Read-copy-update cell holding an immutable snapshot of a value. \class RcuCell
+     *
+     * Readers pin the current snapshot with read() and never block or take a lock: they
+     * register in one of two reader counters selected by the grace-period epoch and load the
+     * snapshot pointer with acquire semantics. Writers copy the new value into a fresh snapshot,
+     * publish it with a single pointer exchange and free the previous snapshot only after
+     * both reader counters have drained once (epoch-based reclamation with two grace periods),
+     * so a reader never sees a torn or freed value. If the writer itself has a snapshot pinned, or
+     * the readers do not drain within a short bounded wait, the old snapshot is kept on a retired
+     * list and freed by a later store or the destructor, so a writer never deadlocks. The retired
+     * list is capped: once it is full, a writer without a pin waits for the readers unbounded.
+     * @tparam T The snapshot type. Must be copy constructible.
+     */
+    template<typename T>
+    class RcuCell
+    {
+        struct alignas(CACHE_LINE_SIZE) ReaderCount
+        {
+            std::atomic<uint64_t> count{0};
+        };
+
+    public:
+        /// @brief Pins a snapshot for the lifetime of the guard. \class ReadGuard
+        class ReadGuard
+        {
+        public:
+            ReadGuard(ReadGuard&& other) noexcept
+                : value_(std::exchange(other.value_, nullptr))
+                , count_(std::exchange(other.count_, nullptr))
+            {
+            }
+
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+            ReadGuard& operator=(ReadGuard&&) = delete;
+
+            /**
+             * @brief Releases the snapshot.
+             */
+            ~ReadGuard()
+            {
+                if (count_)
+                {
+                    count_->fetch_sub(1, std::memory_order_release);
+                    --rcuReadDepth;
+                }
+            }
+
+            /**
+             * @brief Accesses the pinned snapshot.
+             * @return The snapshot.
+             */
+            [[nodiscard]] const T& operator*() const noexcept
+            {
+                return *value_;
+            }
+
+            /**
+             * @brief Accesses the pinned snapshot.
+             * @return Pointer to the snapshot.
+             */
+            [[nodiscard]] const T* operator->() const noexcept
+            {
+                return value_;
+            }
+
+        private:
+            friend class RcuCell;
+
+            ReadGuard(const T* value, std::atomic<uint64_t>* count) noexcept
+                : value_(value)
+                , count_(count)
+            {
+            }
+
+            const T* value_;
+            std::atomic<uint64_t>* count_;
+        };
+
+        /**
+         * @brief Constructs the cell with an initial snapshot.
+         * @param value The initial value.
+         */
+        explicit RcuCell(const T& value)
+            : current_(new T(value))
+        {
+        }
+
+        /**
+         * @brief Destroys the current snapshot. No reader may still hold a guard.
+         */
+        ~RcuCell()
+        {
+            reclaim();
+            delete current_.load(std::memory_order_acquire);
+        }
+
+        RcuCell(const RcuCell&) = delete;
+        RcuCell& operator=(const RcuCell&) = delete;
+
+        /**
+         * @brief Pins the current snapshot. Never blocks.
+         * @return A guard keeping the snapshot alive.
+         */
+        [[nodiscard]] ReadGuard read() const noexcept
+        {
+            // The counter increment must be ordered before the pointer load, hence seq_cst on both
+            std::atomic<uint64_t>& count = readers_[epoch_.load(std::memory_order_relaxed) & 1].count;
+            count.fetch_add(1, std::memory_order_seq_cst);
+            ++rcuReadDepth;
+            return ReadGuard(current_.load(std::memory_order_seq_cst), &count);
+        }
+
+        /**
+         * @brief Copies the current snapshot out.
+         * @return A copy of the current value.
+         */
+        [[nodiscard]] T load() const
+        {
+            return *read();
+        }
+
+        /**
+         * @brief Publishes a new snapshot and reclaims the previous one once no reader can hold it.
+         *
+         * Writers are serialized among themselves and briefly wait for in-flight readers; readers are never delayed.
+         * The previous snapshot joins the retired backlog, and every store retries reclamation of the whole backlog
+         * after one successful grace period. While the backlog holds at most MAX_RETIRED snapshots the wait for the
+         * readers is bounded and a timeout defers reclamation to a later store; past the cap the writer takes the
+         * backlog and blocks until the readers have drained, however long that takes. That wait happens outside the
+         * writer lock, so a reader that stores from within its read section is not held up behind it. A writer that
+         * has a snapshot pinned itself never waits, as its own pin would not drain; its backlog is reclaimed by the
+         * next store made without a pin.
+         * @param value The new value.
+         */
+        void store(const T& value)
+        {
+            const T* next = new T(value);
+
+            std::vector<const T*> backlog;
+            {
+                std::lock_guard<std::mutex> lock(writerMutex_);
+                retired_.reserve(retired_.size() + 1);
+                retired_.push_back(current_.exchange(next, std::memory_order_seq_cst));
+                if (rcuReadDepth != 0)
+                {
+                    return;
+                }
+                if (retired_.size() <= MAX_RETIRED)
+                {
+                    if (synchronize(true))
+                    {
+                        reclaim();
+                    }
+                    return;
+                }
+                backlog.swap(retired_);
+            }
+
+            // Every snapshot in the backlog was replaced before this point, so once each reader counter has been
+            // seen empty since, none of them can still be pinned
+            static_cast<void>(synchronize(false));
+            for (const T* retired : backlog)
+            {
+                delete retired;
+            }
+        }
+
+    private:
+        /// @brief Yields a writer spends waiting for one grace period before deferring reclamation
+        static constexpr int MAX_GRACE_YIELDS = 1000;
+
+        /// @brief Retired snapshots beyond which a writer waits for the readers without a yield limit
+        static constexpr size_t MAX_RETIRED = 64;
+
+        /**
+         * @brief Waits for two grace periods so every reader registered before the exchange has left.
+         * @param bounded Whether to give up after MAX_GRACE_YIELDS yields per grace period.
+         * @return false if the readers did not drain within the bounded wait
+         */
+        [[nodiscard]] bool synchronize(const bool bounded) const noexcept
+        {
+            for (int phase = 0; phase < 2; ++phase)
+            {
+                const uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+                int yields = 0;
+                while (readers_[epoch & 1].count.load(std::memory_order_seq_cst) != 0)
+                {
+                    if (bounded && ++yields > MAX_GRACE_YIELDS)
+                    {
+                        return false;
+                    }
+                    std::this_thread::yield();
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Frees every retired snapshot.
+         */
+        void reclaim() noexcept
+        {
+            for (const T* retired : retired_)
+            {
+                delete retired;
+            }
+            retired_.clear();
+        }
+
+        std::atomic<const T*> current_;
+        mutable std::atomic<uint64_t> epoch_{0};
+        mutable std::array<ReaderCount, 2> readers_{};
+        std::vector<const T*> retired_;
+        std::mutex writerMutex_;
+    };
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Cache line size used to keep producer and consumer indices apart.
+    constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief Bounded lock-free multi-producer/multi-consumer ring of fixed-size slots. \class LockFreeRing
+     *
+     * Each slot carries a sequence number that tells producers and consumers whose turn it is,
+     * so neither side ever takes a lock. Slots are filled and drained in place through callbacks,
+     * which lets large payloads (e.g. whole Ethernet frames) avoid an intermediate copy.
+     * @tparam T The slot type. Must be default constructible.
+     */
+    template<typename T>
+    class LockFreeRing
+    {
+        static_assert(std::is_default_constructible_v<T>, "LockFreeRing slot type must be default constructible");
+
+    public:
+        /**
+         * @brief Constructs the ring.
+         * @param capacity Number of slots, rounded up to the next power of two.
+         * @throws std::invalid_argument if capacity is zero.
+         */
+        explicit LockFreeRing(const size_t capacity)
+            : capacity_(std::bit_ceil(capacity))
+            , mask_(capacity_ - 1)
+            , slots_(std::make_unique<Slot[]>(capacity_))
+        {
+            if (capacity == 0)
+            {
+                throw std::invalid_argument("LockFreeRing capacity must be greater than zero");
+            }
+
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                slots_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        LockFreeRing(const LockFreeRing&) = delete;
+        LockFreeRing& operator=(const LockFreeRing&) = delete;
+
+        /**
+         * @brief Claims a free slot and fills it in place.
+         * @tparam F Callable with signature void(T&).
+         * @param fill Callback writing the payload into the slot.
+         * @return false if the ring is full.
+         */
+        template<typename F>
+        bool tryPushWith(F&& fill)
+        {
+            size_t pos = head_.load(std::memory_order_relaxed);
+            Slot* slot;
+
+            for (;;)
+            {
+                slot = &slots_[pos & mask_];
+                const size_t seq = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+            }
+
+            fill(slot->value);
+            slot->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Copies a value into a free slot.
+         * @param value The value to push.
+         * @return false if the ring is full.
+         */
+        bool tryPush(const T& value)
+        {
+            return tryPushWith([&value](T& slot) { slot = value; });
+        }
+
+        /**
+         * @brief Claims the oldest filled slot and drains it in place.
+         * @tparam F Callable with signature void(T&).
+         * @param consume Callback reading the payload from the slot.
+         * @return false if the ring is empty.
+         */
+        template<typename F>
+        bool tryPopWith(F&& consume)
+        {
+            size_t pos = tail_.load(std::memory_order_relaxed);
+            Slot* slot;
+
+            for (;;)
+            {
+                slot = &slots_[pos & mask_];
+                const size_t seq = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+
+            consume(slot->value);
+            slot->sequence.store(pos + capacity_, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Moves the oldest value out of the ring.
+         * @param out Destination for the value.
+         * @return false if the ring is empty.
+         */
+        bool tryPop(T& out)
+        {
+            return tryPopWith([&out](T& slot) { out = std::move(slot); });
+        }
+
+        /**
+         * @brief Getter for the number of slots.
+         * @return The ring capacity.
+         */
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        /**
+         * @brief Approximate number of filled slots (exact only when quiescent).
+         * @return The number of queued values.
+         */
+        [[nodiscard]] size_t sizeApprox() const noexcept
+        {
+            const size_t head = head_.load(std::memory_order_relaxed);
+            const size_t tail = tail_.load(std::memory_order_relaxed);
+            return head >= tail ? head - tail : 0;
+        }
+
+    private:
+        /// @brief A ring slot with its turn sequence. \struct Slot
+        struct alignas(CACHE_LINE_SIZE) Slot
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+
+        const size_t capacity_;
+        const size_t mask_;
+        std::unique_ptr<Slot[]> slots_;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_{0};
+    };
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief Deterministic time base derived from the SV sample counter. \class SampleClock
+     *
+     * smpCnt wraps once per second, at the number of samples per second. The clock unwraps it into a
+     * monotonic sample count and converts that count to nanoseconds with integer arithmetic, so
+     * protection timers advance by exactly one sample period per sample. Replay at any speed
+     * gives the same trip decisions as real time, and reading the time needs no system call.
+     * Lost samples advance the clock by the gap; a repeated counter value does not advance it.
+     */
+    class SampleClock
+    {
+    public:
+        /**
+         * @brief Constructs the clock for a stream's sample rate.
+         * @param samplesPerPeriod The samples per nominal cycle.
+         * @param frequency The nominal signal frequency.
+         */
+        explicit SampleClock(const SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                             const SignalFrequency frequency = SignalFrequency::FREQ_50_HZ) noexcept
+            : samplesPerTenSeconds_(static_cast<uint64_t>(samplesPerPeriod) * static_cast<uint64_t>(frequency))
+            , wrap_(static_cast<uint32_t>((samplesPerTenSeconds_ + 5) / 10))
+        {
+        }
+
+        /**
+         * @brief Advances the clock to a received sample counter.
+         * @param smpCnt The sample counter of the ASDU.
+         * @return The sample time since the first sample.
+         */
+        std::chrono::nanoseconds update(const uint16_t smpCnt) noexcept
+        {
+            const uint32_t counter = smpCnt % wrap_;
+            if (started_)
+            {
+                samples_ += (counter + wrap_ - last_) % wrap_;
+            }
+            started_ = true;
+            last_ = counter;
+            return now();
+        }
+
+        /**
+         * @brief Advances the clock by a number of samples.
+         * @param samples The number of samples.
+         * @return The sample time since the first sample.
+         */
+        std::chrono::nanoseconds advance(const uint64_t samples = 1) noexcept
+        {
+            samples_ += samples;
+            return now();
+        }
+
+        /**
+         * @brief Getter for the current sample time.
+         * @return The time of the last sample since the first sample.
+         */
+        [[nodiscard]] std::chrono::nanoseconds now() const noexcept
+        {
+            return toTime(samples_);
+        }
+
+        /**
+         * @brief Converts a sample count into time without accumulating rounding errors.
+         * @param samples The number of samples.
+         * @return The elapsed time.
+         */
+        [[nodiscard]] std::chrono::nanoseconds toTime(const uint64_t samples) const noexcept
+        {
+            constexpr uint64_t tenSecondsNs = 10'000'000'000;
+            const uint64_t whole = samples / samplesPerTenSeconds_;
+            const uint64_t rest = samples % samplesPerTenSeconds_;
+            return std::chrono::nanoseconds(static_cast<int64_t>(whole * tenSecondsNs + rest * tenSecondsNs / samplesPerTenSeconds_));
+        }
+
+        /**
+         * @brief Getter for the unwrapped sample count.
+         * @return The samples since the first sample.
+         */
+        [[nodiscard]] uint64_t getSampleCount() const noexcept
+        {
+            return samples_;
+        }
+
+        /**
+         * @brief Getter for the value at which smpCnt wraps.
+         * @return The samples per second.
+         */
+        [[nodiscard]] uint32_t getSamplesPerSecond() const noexcept
+        {
+            return wrap_;
+        }
+
+        /**
+         * @brief Restarts the clock at the next sample.
+         */
+        void reset() noexcept
+        {
+            samples_ = 0;
+            last_ = 0;
+            started_ = false;
+        }
+
+    private:
+        uint64_t samplesPerTenSeconds_;
+        uint32_t wrap_;
+        uint64_t samples_{0};
+        uint32_t last_{0};
+        bool started_{false};
+    };
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+/// @brief Internal helpers shared by the library sources, not part of the public API \namespace sv::detail
+namespace sv::detail
+{
+    /**
+     * @brief Converts seconds to a duration, rounded to the nearest nanosecond.
+     * @param seconds The time in seconds.
+     * @return The duration.
+     */
+    inline std::chrono::nanoseconds toDuration(const double seconds)
+    {
+        return std::chrono::nanoseconds(std::llround(seconds * 1e9));
+    }
+
+    /**
+     * @brief splitmix64: a well-mixed 64-bit value per input, used to derive independent random states from a seed.
+     * @param value The value to mix.
+     * @return The mixed value.
+     */
+    inline uint64_t mix(uint64_t value)
+    {
+        value += 0x9e3779b97f4a7c15ull;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return value ^ (value >> 31);
+    }
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "sv/core/ring.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief Fixed-size thread pool with per-worker task queues and work stealing. \class WorkStealingPool
+     *
+     * Tasks submitted from outside are dealt round-robin to the worker queues; tasks submitted
+     * from a worker go to its own queue. A worker takes from the back of its own queue and, when
+     * that is empty, steals from the front of the others, so uneven task durations do not leave
+     * cores idle. Each queue has its own lock, which only the owner and occasional thieves touch.
+     * The first exception thrown by a task is rethrown by wait().
+     */
+    class WorkStealingPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+        /**
+         * @brief Starts the workers.
+         * @param workers Number of worker threads, 0 for one per hardware thread.
+         */
+        explicit WorkStealingPool(size_t workers = 0)
+        {
+            if (workers == 0)
+            {
+                workers = std::max(1u, std::thread::hardware_concurrency());
+            }
+
+            queues_.reserve(workers);
+            for (size_t i = 0; i < workers; ++i)
+            {
+                queues_.push_back(std::make_unique<Queue>());
+            }
+            threads_.reserve(workers);
+            for (size_t i = 0; i < workers; ++i)
+            {
+                threads_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+            }
+        }
+
+        /**
+         * @brief Finishes the queued tasks and joins the workers.
+         */
+        ~WorkStealingPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stopping_ = true;
+            }
+            available_.notify_all();
+            for (auto& thread : threads_)
+            {
+                thread.join();
+            }
+        }
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        /**
+         * @brief Queues a task.
+         * @param task The task.
+         */
+        void submit(Task task)
+        {
+            const size_t index = currentWorker_.pool == this
+                                     ? currentWorker_.index
+                                     : next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+            {
+                std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+                queues_[index]->tasks.push_back(std::move(task));
+            }
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++queued_;
+                ++unfinished_;
+            }
+            available_.notify_one();
+        }
+
+        /**
+         * @brief Blocks until every submitted task has finished.
+         * @throws The first exception thrown by a task since the last wait().
+         */
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            finished_.wait(lock, [this] { return unfinished_ == 0; });
+            if (error_)
+            {
+                std::rethrow_exception(std::exchange(error_, nullptr));
+            }
+        }
+
+        /**
+         * @brief Getter for the number of workers.
+         * @return The worker count.
+         */
+        [[nodiscard]] size_t getWorkerCount() const noexcept
+        {
+            return threads_.size();
+        }
+
+        /**
+         * @brief Getter for the number of tasks taken from another worker's queue.
+         * @return The steal count.
+         */
+        [[nodiscard]] uint64_t getStealCount() const noexcept
+        {
+            return steals_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        /// @brief One worker's task queue. \struct Queue
+        struct alignas(CACHE_LINE_SIZE) Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /// @brief Identifies the pool and queue of the calling worker thread. \struct WorkerIdentity
+        struct WorkerIdentity
+        {
+            const WorkStealingPool* pool;
+            size_t index;
+        };
+
+        inline static thread_local WorkerIdentity currentWorker_;
+
+        /**
+         * @brief Takes a task from the own queue or steals one.
+         * @param index The worker index.
+         * @param task Receives the task.
+         * @return true if a task was taken.
+         */
+        bool take(const size_t index, Task& task)
+        {
+            {
+                auto& own = *queues_[index];
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if (!own.tasks.empty())
+                {
+                    task = std::move(own.tasks.back());
+                    own.tasks.pop_back();
+                    return true;
+                }
+            }
+
+            for (size_t offset = 1; offset < queues_.size(); ++offset)
+            {
+                auto& victim = *queues_[(index + offset) % queues_.size()];
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = std::move(victim.tasks.front());
+                    victim.tasks.pop_front();
+                    steals_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Worker thread loop.
+         * @param index The worker index.
+         */
+        void workerLoop(const size_t index)
+        {
+            currentWorker_ = {this, index};
+
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    available_.wait(lock, [this] { return queued_ > 0 || stopping_; });
+                    if (queued_ == 0)
+                    {
+                        return;
+                    }
+                    --queued_;
+                }
+
+                // A queued task exists in some queue; it may be taken by a thief first, so retry
+                Task task;
+                while (!take(index, task))
+                {
+                    std::this_thread::yield();
+                }
+
+                std::exception_ptr error;
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (error && !error_)
+                {
+                    error_ = error;
+                }
+                if (--unfinished_ == 0)
+                {
+                    finished_.notify_all();
+                }
+            }
+        }
+
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<size_t> next_{0};
+        std::atomic<uint64_t> steals_{0};
+
+        std::mutex mutex_;
+        std::condition_variable available_;
+        std::condition_variable finished_;
+        size_t queued_{0};
+        size_t unfinished_{0};
+        std::exception_ptr error_;
+        bool stopping_{false};
+    };
+}
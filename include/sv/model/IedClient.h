@@ -4,6 +4,7 @@
 #include <mutex>
 #include "sv/model/IedModel.h"
 #include "sv/network/NetworkReceiver.h"
+#include "sv/network/Transport.h"
 
 /// @brief sv namespace \namespace sv
 namespace sv
@@ -30,6 +31,14 @@ namespace sv
          */
         static Ptr create(IedModel::Ptr model, const std::string& interface = "");
 
+        /**
+         * @brief Creates a new IedClient on an explicit transport.
+         * @param model The IED model.
+         * @param transport The transport used to create the receiver.
+         * @return A shared pointer to the created IedClient.
+         */
+        static Ptr create(IedModel::Ptr model, TransportFactory::Ptr transport);
+
         /**
          * @brief Starts the client with a custom callback.
          * @param callback Function to call for each received ASDU.
@@ -62,12 +71,12 @@ namespace sv
         /**
          * @brief Constructor is private. Use create() method.
          * @param model The IED model.
-         * @param interface The network interface.
+         * @param transport The transport used to create the receiver.
          */
-        IedClient(IedModel::Ptr model, std::string  interface);
+        IedClient(IedModel::Ptr model, TransportFactory::Ptr transport);
 
         IedModel::Ptr model_;
-        std::string interface_;
+        TransportFactory::Ptr transport_;
         std::unique_ptr<NetworkReceiver> receiver_;
         std::vector<ASDU> receivedASDUs_;
         std::mutex receivedMutex_;
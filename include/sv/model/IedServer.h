@@ -5,6 +5,7 @@
 #include <thread>
 #include "sv/model/IedModel.h"
 #include "sv/network/NetworkSender.h"
+#include "sv/network/Transport.h"
 
 /// @brief sv namespace \namespace sv
 namespace sv
@@ -29,6 +30,14 @@ namespace sv
          */
         static Ptr create(IedModel::Ptr model, const std::string& interface = "");
 
+        /**
+         * @brief Creates a new IedServer on an explicit transport.
+         * @param model The IED model.
+         * @param transport The transport used to create the sender.
+         * @return A shared pointer to the created IedServer.
+         */
+        static Ptr create(IedModel::Ptr model, TransportFactory::Ptr transport);
+
         /**
          * @brief Starts the server.
          */
@@ -61,12 +70,12 @@ namespace sv
         /**
          * @brief Constructor is private. Use create() method.
          * @param model The IED model.
-         * @param interface The network interface.
+         * @param transport The transport used to create the sender.
          */
-        IedServer(IedModel::Ptr model, std::string  interface);
+        IedServer(IedModel::Ptr model, TransportFactory::Ptr transport);
 
         IedModel::Ptr model_;
-        std::string interface_;
+        TransportFactory::Ptr transport_;
         std::unique_ptr<NetworkSender> sender_;
         std::thread senderThread_;
         std::atomic<bool> running_;
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include "sv/core/types.h"
+#include "sv/core/buffer.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Forward declaration of SampledValueControlBlock \class SampledValueControlBlock
+    class SampledValueControlBlock;
+
+    /// @brief Layer-2 SV frame encoder/decoder shared by all transports. \class FrameCodec
+    class FrameCodec
+    {
+    public:
+        /// @brief Minimum size of an SV frame (Ethernet header + SV header).
+        static constexpr size_t MIN_FRAME_SIZE = 14 + 8;
+
+        /// @brief Maximum size of an encoded SV frame.
+        static constexpr size_t MAX_FRAME_SIZE = 1518;
+
+        /// @brief Locally administered source MAC used by transports without a NIC.
+        static constexpr std::array<uint8_t, 6> LOCAL_SRC_MAC = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+
+        /**
+         * @brief Encodes an ASDU into a complete Ethernet frame.
+         * @param writer The writer receiving the frame bytes.
+         * @param svcb The control block providing the frame parameters.
+         * @param asdu The ASDU to encode.
+         * @param destMac The destination MAC address.
+         * @param srcMac The source MAC address.
+         * @throws std::runtime_error if the dataset contains an unsupported value type.
+         */
+        static void encode(BufferWriter& writer, const SampledValueControlBlock& svcb, const ASDU& asdu,
+                           const std::array<uint8_t, 6>& destMac, const std::array<uint8_t, 6>& srcMac);
+
+        /**
+         * @brief Decodes the first ASDU of an Ethernet frame.
+         * @param frame The raw frame bytes, starting at the destination MAC.
+         * @param header Optional output for the frame header fields (asdus is left empty).
+         * @return An optional ASDU if decoding was successful.
+         */
+        [[nodiscard]] static std::optional<ASDU> decode(std::span<const uint8_t> frame, SVMessage* header = nullptr);
+
+        /**
+         * @brief Decodes the first ASDU of an Ethernet frame into an existing ASDU.
+         * Reuses the svID and dataset storage of asdu, so a receive loop decoding into the same
+         * ASDU does not allocate once it has seen its longest svID.
+         * @param frame The raw frame bytes, starting at the destination MAC.
+         * @param asdu The ASDU to overwrite; its content is unspecified if decoding fails.
+         * @param header Optional output for the frame header fields (asdus is left empty).
+         * @return true if decoding was successful.
+         */
+        [[nodiscard]] static bool decode(std::span<const uint8_t> frame, ASDU& asdu, SVMessage* header = nullptr);
+    };
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "sv/core/ring.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/network/Transport.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Raw Layer-2 frame stored in a loopback ring slot. \struct LoopbackFrame
+    struct LoopbackFrame
+    {
+        int64_t enqueueNs{0};   ///< PipelineLatency::nowNs() at publish, the frame's pipeline origin
+        uint16_t length{0};
+        std::array<uint8_t, FrameCodec::MAX_FRAME_SIZE> data{};
+    };
+
+    /// @brief Shared in-process medium connecting loopback senders and receivers. \class LoopbackChannel
+    class LoopbackChannel
+    {
+    public:
+        /**
+         * @brief Constructs the channel.
+         * @param capacity Number of frames the ring can hold.
+         */
+        explicit LoopbackChannel(size_t capacity);
+
+        /**
+         * @brief Publishes a frame. Drops it if the ring is full, like a NIC queue overflow.
+         * @param frame The frame bytes.
+         * @return true if the frame was queued.
+         */
+        bool publish(std::span<const uint8_t> frame);
+
+        /**
+         * @brief Blocks until a publish happened after the given signal value.
+         * @param seen The signal value observed before the ring was found empty.
+         */
+        void waitForFrames(uint32_t seen) const;
+
+        /**
+         * @brief Wakes all waiting receivers (used on shutdown).
+         */
+        void wakeAll();
+
+        /**
+         * @brief Gets the current signal value.
+         * @return The publish counter.
+         */
+        [[nodiscard]] uint32_t signal() const noexcept;
+
+        /**
+         * @brief Gets the number of frames dropped because the ring was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] uint64_t getDroppedFrames() const noexcept;
+
+        /**
+         * @brief Gets the underlying frame ring.
+         * @return Reference to the ring.
+         */
+        LockFreeRing<LoopbackFrame>& ring() noexcept;
+
+    private:
+        LockFreeRing<LoopbackFrame> ring_;
+        std::atomic<uint32_t> signal_{0};
+        std::atomic<uint64_t> dropped_{0};
+    };
+
+    /// @brief NetworkSender writing encoded frames into a loopback channel. \class LoopbackNetworkSender
+    class LoopbackNetworkSender : public NetworkSender
+    {
+    public:
+        /**
+         * @brief Constructs the sender.
+         * @param channel The channel to publish into.
+         * @param srcMac The source MAC written into every frame.
+         */
+        LoopbackNetworkSender(std::shared_ptr<LoopbackChannel> channel, const std::array<uint8_t, 6>& srcMac);
+
+        /**
+         * @brief Encodes and publishes an ASDU.
+         * @param svcb The control block.
+         * @param asdu The ASDU to send.
+         */
+        void sendASDU(std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu) override;
+
+        /**
+         * @brief Publishes an already encoded frame on the channel.
+         * @param frame The raw frame bytes.
+         * @return false if the frame is too large or the ring is full.
+         */
+        bool sendRawFrame(std::span<const uint8_t> frame) override;
+
+    private:
+        std::shared_ptr<LoopbackChannel> channel_;
+        std::array<uint8_t, 6> srcMac_;
+    };
+
+    /// @brief NetworkReceiver draining a loopback channel on its own thread. \class LoopbackNetworkReceiver
+    class LoopbackNetworkReceiver : public NetworkReceiver
+    {
+    public:
+        /**
+         * @brief Constructs the receiver.
+         * @param channel The channel to drain.
+         */
+        explicit LoopbackNetworkReceiver(std::shared_ptr<LoopbackChannel> channel);
+
+        /**
+         * @brief Destructor override.
+         */
+        ~LoopbackNetworkReceiver() override;
+
+        /**
+         * @brief Starts receiving frames.
+         * @param callback Function to call when an ASDU is received.
+         */
+        void start(Callback callback) override;
+
+        /**
+         * @brief Stops receiving.
+         */
+        void stop() override;
+
+    private:
+        std::shared_ptr<LoopbackChannel> channel_;
+        std::atomic<bool> running_{false};
+        std::thread receiveThread_;
+    };
+
+    /**
+     * @brief In-process transport backed by a lock-free frame ring. \class LoopbackTransport
+     *
+     * Frames carry the exact Layer-2 bytes produced by FrameCodec, so the full publish/parse
+     * pipeline runs without raw sockets or network privileges. Receivers share one ring and
+     * therefore split the traffic between them; use one receiver per transport for multicast-like
+     * delivery.
+     */
+    class LoopbackTransport : public TransportFactory
+    {
+    public:
+        /// @brief Default number of frames held by the ring.
+        static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+        /**
+         * @brief Creates a new LoopbackTransport.
+         * @param capacity Number of frames the ring can hold.
+         * @return A shared pointer to the transport.
+         */
+        static std::shared_ptr<LoopbackTransport> create(size_t capacity = DEFAULT_CAPACITY);
+
+        /**
+         * @brief Creates a sender publishing into the ring.
+         * @return A unique pointer to the sender.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkSender> createSender() override;
+
+        /**
+         * @brief Creates a receiver draining the ring.
+         * @return A unique pointer to the receiver.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkReceiver> createReceiver() override;
+
+        /**
+         * @brief Gets a human-readable description of the transport.
+         * @return The transport description.
+         */
+        [[nodiscard]] std::string describe() const override;
+
+        /**
+         * @brief Gets the number of frames dropped because the ring was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] uint64_t getDroppedFrames() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param capacity Number of frames the ring can hold.
+         */
+        explicit LoopbackTransport(size_t capacity);
+
+        std::shared_ptr<LoopbackChannel> channel_;
+    };
+}
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <thread>
 #include <atomic>
+#include <span>
 #include "sv/core/types.h"
 #include "sv/model/SampledValueControlBlock.h"
+#include "sv/capture/PcapngWriter.h"
+
+struct msghdr;
 
 /// @brief sv namespace \namespace sv
 namespace sv
@@ -97,6 +103,26 @@ namespace sv
      */
     std::string getFirstEthernetInterface();
 
+    /**
+     * @brief Reads CLOCK_REALTIME, the clock of the kernel receive timestamps.
+     * @return Nanoseconds since the Unix epoch.
+     */
+    uint64_t realtimeNs();
+
+    /**
+     * @brief Extracts the SO_TIMESTAMPNS receive time from a message.
+     * @param msg The received message header.
+     * @return The receive time in nanoseconds since the Unix epoch, or std::nullopt if the kernel attached none.
+     */
+    std::optional<uint64_t> kernelReceiveNs(const msghdr& msg);
+
+    /**
+     * @brief Records the time a frame spent in the receive queue and moves its origin onto the pipeline clock.
+     * @param kernelNs The kernel receive timestamp, if any.
+     * @return The PipelineLatency origin of the frame.
+     */
+    int64_t receiveOrigin(std::optional<uint64_t> kernelNs);
+
     /// @brief Ethernet-based network receiver for SV. \class EthernetNetworkReceiver
     class EthernetNetworkReceiver : public NetworkReceiver
     {
@@ -124,6 +150,27 @@ namespace sv
          */
         ~EthernetNetworkReceiver() override;
 
+        /**
+         * @brief Tees every received frame with its kernel timestamp into a pcapng file.
+         * Must be called while the receiver is stopped.
+         * @param path The capture file path.
+         * @throws std::runtime_error if the file cannot be opened.
+         */
+        void enableCapture(const std::string& path);
+
+        /**
+         * @brief Gets the capture counters.
+         * @return The CaptureStats, or std::nullopt if capture is disabled.
+         */
+        [[nodiscard]] std::optional<CaptureStats> getCaptureStats() const;
+
+        /**
+         * @brief Parses an ASDU from a received frame.
+         * @param frame The received frame bytes.
+         * @return An optional ASDU if parsing was successful.
+         */
+        [[nodiscard]] static std::optional<ASDU> parseASDU(std::span<const uint8_t> frame);
+
     private:
         /**
          * @brief Constructor is private. Use create() method.
@@ -142,25 +189,11 @@ namespace sv
          */
         void enablePromiscuousMode() const;
 
-        /**
-         * @brief Formats a MAC address as a string.
-         * @param mac The MAC address bytes.
-         * @return The formatted MAC address string.
-         */
-        [[nodiscard]] static std::string formatMacAddress(const std::array<uint8_t, 6>& mac);
-
-        /**
-         * @brief Parses an ASDU from a buffer.
-         * @param buffer The received data buffer.
-         * @param length The length of the data.
-         * @return An optional ASDU if parsing was successful.
-         */
-        [[nodiscard]] static std::optional<ASDU> parseASDU(const std::vector<uint8_t>& buffer, size_t length);
-
         std::string interface_;
         ReceiverSocketGuard socket_;
         int ifIndex_;
         std::atomic<bool> running_;
         std::thread receiveThread_;
+        std::unique_ptr<PcapngWriter> capture_;
     };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string>
 #include <unistd.h>
 #include "sv/core/types.h"
@@ -77,6 +78,29 @@ namespace sv
          * @param asdu The ASDU to send.
          */
         virtual void sendASDU(std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu) = 0;
+
+        /**
+         * @brief Sends an already encoded frame unchanged, e.g. for capture replay.
+         * @param frame The raw frame bytes, starting at the destination MAC.
+         * @return false if the frame was rejected or dropped.
+         */
+        virtual bool sendRawFrame(std::span<const uint8_t> frame) = 0;
+
+        /**
+         * @brief Sends a batch of already encoded frames in order.
+         * The default sends them one by one; transports with a batched system call override it.
+         * @param frames The raw frames, each starting at the destination MAC.
+         * @return The number of leading frames sent; sending stops at the first failure.
+         */
+        virtual size_t sendRawFrames(const std::span<const std::span<const uint8_t>> frames)
+        {
+            size_t sent = 0;
+            while (sent < frames.size() && sendRawFrame(frames[sent]))
+            {
+                ++sent;
+            }
+            return sent;
+        }
     };
 
     /// @brief Ethernet-based network sender for SV. \class EthernetNetworkSender
@@ -97,11 +121,28 @@ namespace sv
          */
         void sendASDU(std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu) override;
 
+        /**
+         * @brief Sends an already encoded frame to the destination MAC it carries.
+         * @param frame The raw frame bytes, starting at the destination MAC.
+         * @return false if the frame is too short or the send failed.
+         */
+        bool sendRawFrame(std::span<const uint8_t> frame) override;
+
+        /**
+         * @brief Sends a batch of frames with one sendmmsg() call per MAX_BATCH frames.
+         * @param frames The raw frames, each starting at the destination MAC.
+         * @return The number of leading frames sent; sending stops at the first failure.
+         */
+        size_t sendRawFrames(std::span<const std::span<const uint8_t>> frames) override;
+
         /**
          * @brief Destructor override.
          */
         ~EthernetNetworkSender() override = default;
 
+        /// @brief Maximum number of frames handed to the kernel in one system call.
+        static constexpr size_t MAX_BATCH = 64;
+
     private:
         /**
          * @brief Constructor is private. Use create() method.
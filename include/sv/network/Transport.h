@@ -0,0 +1,100 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "sv/network/NetworkSender.h"
+#include "sv/network/NetworkReceiver.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Factory for the sender/receiver pair of a transport. \class TransportFactory
+    class TransportFactory
+    {
+    public:
+        /**
+         * @brief Shared pointer type for TransportFactory.
+         */
+        using Ptr = std::shared_ptr<TransportFactory>;
+
+        /**
+         * @brief Virtual destructor.
+         */
+        virtual ~TransportFactory() = default;
+
+        /**
+         * @brief Creates a sender bound to this transport.
+         * @return A unique pointer to the sender.
+         */
+        [[nodiscard]] virtual std::unique_ptr<NetworkSender> createSender() = 0;
+
+        /**
+         * @brief Creates a receiver bound to this transport.
+         * @return A unique pointer to the receiver.
+         */
+        [[nodiscard]] virtual std::unique_ptr<NetworkReceiver> createReceiver() = 0;
+
+        /**
+         * @brief Gets a human-readable description of the transport.
+         * @return The transport description.
+         */
+        [[nodiscard]] virtual std::string describe() const = 0;
+    };
+
+    /// @brief Transport factory for raw Ethernet sockets. \class EthernetTransportFactory
+    class EthernetTransportFactory : public TransportFactory
+    {
+    public:
+        /**
+         * @brief Creates a new EthernetTransportFactory.
+         * @param interface The network interface name.
+         * @return A shared pointer to the factory.
+         */
+        static std::shared_ptr<EthernetTransportFactory> create(const std::string& interface);
+
+        /**
+         * @brief Creates an EthernetNetworkSender on the interface.
+         * @return A unique pointer to the sender.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkSender> createSender() override;
+
+        /**
+         * @brief Creates an EthernetNetworkReceiver on the interface.
+         * @return A unique pointer to the receiver.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkReceiver> createReceiver() override;
+
+        /**
+         * @brief Gets a human-readable description of the transport.
+         * @return The transport description.
+         */
+        [[nodiscard]] std::string describe() const override;
+
+        /**
+         * @brief Enables a pcapng capture tap on receivers created afterwards.
+         * @param path The capture file path (empty to disable).
+         */
+        void setCaptureFile(const std::string& path);
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param interface The network interface name.
+         */
+        explicit EthernetTransportFactory(std::string interface);
+
+        std::string interface_;
+        std::string captureFile_;
+    };
+
+    /**
+     * @brief Creates a transport from a command-line style specification.
+     *
+     * Supported forms: "unix:<path>" or "unix" (SOCK_SEQPACKET Unix socket), "loopback"
+     * (in-process ring), "eth:<interface>" or a plain interface name (raw Ethernet). An empty
+     * specification auto-detects the first Ethernet interface.
+     * @param spec The transport specification.
+     * @return A shared pointer to the transport, or nullptr if the specification is invalid.
+     */
+    [[nodiscard]] TransportFactory::Ptr createTransport(const std::string& spec);
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "sv/network/Transport.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief NetworkSender publishing Layer-2 frames over a SOCK_SEQPACKET Unix socket. \class UnixSocketNetworkSender
+     *
+     * The sender listens on the socket path and fans every frame out to all connected
+     * subscribers, mimicking multicast delivery. Subscribers that cannot keep up lose frames.
+     */
+    class UnixSocketNetworkSender : public NetworkSender
+    {
+    public:
+        /**
+         * @brief Creates a new UnixSocketNetworkSender.
+         * @param path The socket path to listen on. An existing socket file is replaced.
+         * @return A unique pointer to the sender.
+         */
+        static std::unique_ptr<UnixSocketNetworkSender> create(const std::string& path);
+
+        /**
+         * @brief Sends an ASDU to every connected subscriber.
+         * @param svcb The control block.
+         * @param asdu The ASDU to send.
+         */
+        void sendASDU(std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu) override;
+
+        /**
+         * @brief Sends an already encoded frame to every connected subscriber.
+         * @param frame The raw frame bytes.
+         * @return false if no subscriber received the frame.
+         */
+        bool sendRawFrame(std::span<const uint8_t> frame) override;
+
+        /**
+         * @brief Gets the number of frames dropped because a subscriber's socket buffer was full.
+         * @return The drop count.
+         */
+        [[nodiscard]] uint64_t getDroppedFrames() const noexcept;
+
+        /**
+         * @brief Gets the number of connected subscribers.
+         * @return The subscriber count.
+         */
+        [[nodiscard]] size_t getSubscriberCount() const;
+
+        /**
+         * @brief Destructor override. Removes the socket file.
+         */
+        ~UnixSocketNetworkSender() override;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param path The socket path to listen on.
+         */
+        explicit UnixSocketNetworkSender(std::string path);
+
+        /**
+         * @brief Accepts all pending subscriber connections without blocking.
+         */
+        void acceptPending();
+
+        /**
+         * @brief Fans a frame out to all subscribers, removing disconnected ones.
+         * @param frame The frame bytes.
+         * @return The number of subscribers that received the frame.
+         */
+        size_t publish(std::span<const uint8_t> frame);
+
+        std::string path_;
+        SocketGuard listenSocket_;
+        std::vector<SocketGuard> subscribers_;
+        mutable std::mutex subscribersMutex_;
+        std::atomic<uint64_t> dropped_{0};
+    };
+
+    /**
+     * @brief NetworkReceiver subscribing to a UnixSocketNetworkSender. \class UnixSocketNetworkReceiver
+     *
+     * The receiver (re)connects to the socket path in the background, so publisher and
+     * subscriber processes can be started in any order.
+     */
+    class UnixSocketNetworkReceiver : public NetworkReceiver
+    {
+    public:
+        /**
+         * @brief Creates a new UnixSocketNetworkReceiver.
+         * @param path The socket path to connect to.
+         * @return A unique pointer to the receiver.
+         */
+        static std::unique_ptr<UnixSocketNetworkReceiver> create(const std::string& path);
+
+        /**
+         * @brief Starts receiving frames.
+         * @param callback Function to call when an ASDU is received.
+         */
+        void start(Callback callback) override;
+
+        /**
+         * @brief Stops receiving.
+         */
+        void stop() override;
+
+        /**
+         * @brief Destructor override.
+         */
+        ~UnixSocketNetworkReceiver() override;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param path The socket path to connect to.
+         */
+        explicit UnixSocketNetworkReceiver(std::string path);
+
+        /**
+         * @brief Tries to connect to the publisher.
+         * @return A connected socket, or an invalid guard if the publisher is not available.
+         */
+        [[nodiscard]] ReceiverSocketGuard tryConnect() const;
+
+        std::string path_;
+        std::atomic<bool> running_{false};
+        std::thread receiveThread_;
+    };
+
+    /// @brief Transport factory for SOCK_SEQPACKET Unix-domain sockets. \class UnixSocketTransportFactory
+    class UnixSocketTransportFactory : public TransportFactory
+    {
+    public:
+        /// @brief Default socket path.
+        static constexpr const char* DEFAULT_PATH = "/tmp/iec61850_sv.sock";
+
+        /**
+         * @brief Creates a new UnixSocketTransportFactory.
+         * @param path The socket path shared by publisher and subscribers.
+         * @return A shared pointer to the factory.
+         */
+        static Ptr create(const std::string& path = DEFAULT_PATH);
+
+        /**
+         * @brief Creates a listening sender on the socket path.
+         * @return A unique pointer to the sender.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkSender> createSender() override;
+
+        /**
+         * @brief Creates a receiver connecting to the socket path.
+         * @return A unique pointer to the receiver.
+         */
+        [[nodiscard]] std::unique_ptr<NetworkReceiver> createReceiver() override;
+
+        /**
+         * @brief Gets a human-readable description of the transport.
+         * @return The transport description.
+         */
+        [[nodiscard]] std::string describe() const override;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         * @param path The socket path.
+         */
+        explicit UnixSocketTransportFactory(std::string path);
+
+        std::string path_;
+    };
+}
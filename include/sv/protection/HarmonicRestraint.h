@@ -0,0 +1,230 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Harmonic restraint and CT saturation settings \struct HarmonicRestraintSettings
+    struct HarmonicRestraintSettings
+    {
+        double secondHarmonicPercent{15.0};
+        double fifthHarmonicPercent{35.0};
+        bool fifthHarmonicEnabled{true};
+        bool crossBlocking{true};
+        bool saturationDetection{true};
+        double saturationRestraintA{2.0};
+        double externalFaultPercent{10.0};
+        double saturationDetectCycles{0.25};
+        double saturationBlockCycles{6.0};
+
+        /**
+         * @brief Validates the harmonic restraint settings
+         * @return true if settings are valid
+         */
+        constexpr bool isValid() const noexcept
+        {
+            return secondHarmonicPercent > 0.0 && secondHarmonicPercent <= 100.0 &&
+                   fifthHarmonicPercent > 0.0 && fifthHarmonicPercent <= 100.0 &&
+                   saturationRestraintA > 0.0 && externalFaultPercent > 0.0 && externalFaultPercent <= 100.0 &&
+                   saturationDetectCycles > 0.0 && saturationBlockCycles >= 0.0;
+        }
+    };
+
+    /// @brief Per-sample restraint decision \struct HarmonicRestraintResult
+    struct HarmonicRestraintResult
+    {
+        std::array<bool, 3> secondHarmonicBlocked{};
+        std::array<bool, 3> fifthHarmonicBlocked{};
+        bool saturationDetected{false};
+        std::array<bool, 3> blocked{};
+    };
+
+    /**
+     * @brief Streaming 2nd/5th harmonic restraint and CT saturation detector. \class HarmonicRestraint
+     *
+     * Takes the instantaneous phase currents of both line ends per sample and forms the operating
+     * current i1 - i2 and the restraint current (i1 + i2) / 2 per phase. Sliding Goertzel filters
+     * over a one-cycle window track the fundamental, 2nd and 5th harmonic of the operating current
+     * and the fundamental of the restraint current. Each sample costs a few multiply-adds per
+     * filter regardless of the samples per period. The filter states are recomputed from the window
+     * every RESYNC_CYCLES cycles.
+     *
+     * A phase is inrush-blocked when its 2nd harmonic exceeds secondHarmonicPercent of the
+     * fundamental, and overexcitation-blocked on the 5th harmonic. With cross-blocking one blocked
+     * phase blocks all three. The CT saturation detector flags an external fault when the
+     * restraint current exceeds saturationRestraintA for saturationDetectCycles while the operating
+     * current stays below externalFaultPercent of it. A differential current that then appears from a
+     * saturating CT is blocked for saturationBlockCycles after the external fault condition ends.
+     */
+    class HarmonicRestraint
+    {
+    public:
+        using Ptr = std::shared_ptr<HarmonicRestraint>;
+
+        /// @brief Number of phases.
+        static constexpr size_t PHASES = 3;
+
+        /// @brief Largest supported window.
+        static constexpr size_t MAX_SAMPLES_PER_PERIOD = static_cast<size_t>(SamplesPerPeriod::SPP_256);
+
+        /// @brief Number of cycles between exact recomputations of the filter states.
+        static constexpr size_t RESYNC_CYCLES = 64;
+
+        /**
+         * @brief Creates a new HarmonicRestraint
+         * @param samplesPerPeriod The window length (samples per nominal cycle)
+         * @param settings The restraint settings
+         * @return A shared pointer to the created HarmonicRestraint
+         * @throws std::invalid_argument if the settings are invalid
+         */
+        [[nodiscard]] static Ptr create(SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                                        const HarmonicRestraintSettings& settings = HarmonicRestraintSettings());
+
+        HarmonicRestraint(const HarmonicRestraint&) = delete;
+        HarmonicRestraint& operator=(const HarmonicRestraint&) = delete;
+
+        /**
+         * @brief Adds one sample per phase from both line ends
+         * @param current1A Instantaneous phase currents of side 1 in amperes
+         * @param current2A Instantaneous phase currents of side 2 in amperes
+         * @return The restraint decision after this sample
+         */
+        const HarmonicRestraintResult& update(std::span<const double, PHASES> current1A,
+                                              std::span<const double, PHASES> current2A) noexcept;
+
+        /**
+         * @brief Gets the decision of the last sample
+         * @return The restraint decision
+         */
+        [[nodiscard]] const HarmonicRestraintResult& getResult() const noexcept;
+
+        /**
+         * @brief Checks if the differential element of a phase is blocked
+         * @param phase The phase index (0 = A, 1 = B, 2 = C)
+         * @return true if blocked
+         */
+        [[nodiscard]] bool isBlocked(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets the RMS fundamental of the operating current
+         * @param phase The phase index
+         * @return The magnitude in amperes
+         */
+        [[nodiscard]] double getFundamental(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets the RMS 2nd harmonic of the operating current
+         * @param phase The phase index
+         * @return The magnitude in amperes
+         */
+        [[nodiscard]] double getSecondHarmonic(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets the RMS 5th harmonic of the operating current
+         * @param phase The phase index
+         * @return The magnitude in amperes
+         */
+        [[nodiscard]] double getFifthHarmonic(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets the RMS fundamental of the restraint current
+         * @param phase The phase index
+         * @return The magnitude in amperes
+         */
+        [[nodiscard]] double getRestraint(size_t phase) const noexcept;
+
+        /**
+         * @brief Checks whether a full cycle has been observed since the last reset
+         * @return true if the magnitudes cover a full window
+         */
+        [[nodiscard]] bool isValid() const noexcept;
+
+        /**
+         * @brief Clears the window, the filter states and the saturation detector
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Gets the restraint settings
+         * @return The settings
+         */
+        [[nodiscard]] const HarmonicRestraintSettings& getSettings() const noexcept;
+
+        /**
+         * @brief Gets the window length
+         * @return The samples per period
+         */
+        [[nodiscard]] size_t getSamplesPerPeriod() const noexcept;
+
+    private:
+        /// @brief Filters per phase group: operating 1st, 2nd, 5th and restraint 1st harmonic
+        static constexpr size_t FILTERS = 4 * PHASES;
+
+        /// @brief Window channels: operating and restraint current per phase
+        static constexpr size_t WINDOW_CHANNELS = 2 * PHASES;
+
+        /// @brief First filter of each group
+        static constexpr size_t FUNDAMENTAL = 0;
+        static constexpr size_t SECOND = PHASES;
+        static constexpr size_t FIFTH = 2 * PHASES;
+        static constexpr size_t RESTRAINT = 3 * PHASES;
+
+        /**
+         * @brief Constructor is private.
+         * @param samplesPerPeriod The window length
+         * @param settings The restraint settings
+         */
+        HarmonicRestraint(size_t samplesPerPeriod, const HarmonicRestraintSettings& settings);
+
+        /**
+         * @brief Squared DFT magnitude of one filter.
+         * @param filter The filter index
+         * @return |X|^2, unscaled
+         */
+        [[nodiscard]] double magnitudeSquared(size_t filter) const noexcept;
+
+        /**
+         * @brief RMS magnitude of one filter.
+         * @param filter The filter index
+         * @return The magnitude in amperes
+         */
+        [[nodiscard]] double rms(size_t filter) const noexcept;
+
+        /**
+         * @brief Recomputes the filter states exactly from the window.
+         */
+        void resync() noexcept;
+
+        /**
+         * @brief Evaluates the blocking logic on the current filter states.
+         */
+        void evaluate() noexcept;
+
+        HarmonicRestraintSettings settings_;
+        size_t samplesPerPeriod_;
+        double rmsScale_;
+        double secondRatioSquared_;
+        double fifthRatioSquared_;
+        double externalFaultRatioSquared_;
+        double saturationRestraintSquared_;
+        uint32_t saturationDetectSamples_;
+        uint32_t saturationBlockSamples_;
+
+        alignas(64) std::array<double, FILTERS> coefficient_{};
+        alignas(64) std::array<double, FILTERS> state1_{};
+        alignas(64) std::array<double, FILTERS> state2_{};
+        std::array<std::array<double, WINDOW_CHANNELS>, MAX_SAMPLES_PER_PERIOD> window_{};
+        size_t index_{0};
+        size_t filled_{0};
+        size_t sinceResync_{0};
+
+        std::array<uint32_t, PHASES> externalFaultSamples_{};
+        uint32_t saturationHold_{0};
+        HarmonicRestraintResult result_;
+    };
+}
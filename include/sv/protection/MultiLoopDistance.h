@@ -0,0 +1,329 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <span>
+#include "sv/core/rcu.h"
+#include "sv/protection/TripEvents.h"
+#include "sv/protection/SymmetricalComponents.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Distance measuring loop \enum FaultLoop
+    enum class FaultLoop : uint8_t
+    {
+        AB,
+        BC,
+        CA,
+        AG,
+        BG,
+        CG,
+        NONE
+    };
+
+    /// @brief Convert FaultLoop to string
+    inline const char* toString(const FaultLoop loop)
+    {
+        switch (loop)
+        {
+            case FaultLoop::AB: return "AB";
+            case FaultLoop::BC: return "BC";
+            case FaultLoop::CA: return "CA";
+            case FaultLoop::AG: return "AG";
+            case FaultLoop::BG: return "BG";
+            case FaultLoop::CG: return "CG";
+            default: return "NONE";
+        }
+    }
+
+    /// @brief Distance zone characteristic shape \enum ZoneCharacteristic
+    enum class ZoneCharacteristic : uint8_t
+    {
+        MHO,
+        QUADRILATERAL
+    };
+
+    /// @brief Multi-loop distance zone settings \struct LoopZone
+    struct LoopZone
+    {
+        ZoneCharacteristic characteristic{ZoneCharacteristic::MHO};
+        double reachOhm{10.0};
+        double resistiveReachOhm{10.0};
+        double lineAngleRad{1.2217};
+        std::chrono::microseconds delay{0};
+        bool enabled{true};
+
+        /**
+         * @brief Validates the zone settings
+         * @return true if settings are valid
+         */
+        constexpr bool isValid() const noexcept
+        {
+            return reachOhm > 0.0 && resistiveReachOhm > 0.0 && lineAngleRad > 0.0 &&
+                   lineAngleRad < std::numbers::pi && delay.count() >= 0;
+        }
+    };
+
+    /// @brief Multi-loop Distance Protection Settings structure \struct MultiLoopDistanceSettings
+    struct MultiLoopDistanceSettings
+    {
+        LoopZone zone1;
+        LoopZone zone2;
+        LoopZone zone3;
+        std::complex<double> residualCompensation{0.8, 0.0};
+        double currentThresholdA{0.5};
+        bool directionForward{true};
+
+        /**
+         * @brief Default constructor initializing zones with default values
+         */
+        MultiLoopDistanceSettings()
+        {
+            zone1.reachOhm = 8.0;
+            zone1.resistiveReachOhm = 8.0;
+            zone1.delay = std::chrono::microseconds(0);
+
+            zone2.reachOhm = 12.0;
+            zone2.resistiveReachOhm = 12.0;
+            zone2.delay = std::chrono::milliseconds(300);
+
+            zone3.reachOhm = 20.0;
+            zone3.resistiveReachOhm = 20.0;
+            zone3.delay = std::chrono::milliseconds(600);
+        }
+
+        /**
+         * @brief Validates the multi-loop distance settings
+         * @return true if settings are valid
+         */
+        bool isValid() const noexcept
+        {
+            return zone1.isValid() && zone2.isValid() && zone3.isValid() && currentThresholdA > 0.0 &&
+                   std::isfinite(residualCompensation.real()) && std::isfinite(residualCompensation.imag());
+        }
+    };
+
+    /// @brief Multi-loop Distance Protection Result structure \struct MultiLoopDistanceResult
+    struct MultiLoopDistanceResult
+    {
+        static constexpr size_t LOOPS = 6;
+
+        std::array<std::complex<double>, LOOPS> loopImpedanceOhm{};
+        std::array<uint8_t, LOOPS> loopZones{};
+        FaultLoop faultedLoop{FaultLoop::NONE};
+        bool zone1Trip{false};
+        bool zone2Trip{false};
+        bool zone3Trip{false};
+        std::chrono::nanoseconds sampleTime{0};
+        std::chrono::steady_clock::time_point tripTime;
+
+        /**
+         * @brief Gets the impedance of the faulted loop
+         * @return The impedance, or zero when no loop picked up
+         */
+        [[nodiscard]] std::complex<double> faultImpedance() const noexcept
+        {
+            return faultedLoop == FaultLoop::NONE ? std::complex<double>{} : loopImpedanceOhm[static_cast<size_t>(faultedLoop)];
+        }
+    };
+
+    /**
+     * @brief Six-loop distance protection with mho and quadrilateral zones \class MultiLoopDistanceProtection
+     *
+     * Every update computes the AB, BC, CA, AG, BG and CG loop impedances as one fixed-width batch,
+     * using k0 = (Z0 - Z1) / 3Z1 for the earth loops, and tests all six against the three zones.
+     * loopZones holds a bit per zone (bit 0 = zone 1) for each loop. The faulted loop is the
+     * picked-up loop in the fastest zone with the smallest impedance. The cost per sample is
+     * constant and update() never allocates.
+     */
+    class MultiLoopDistanceProtection
+    {
+    public:
+        using Ptr = std::shared_ptr<MultiLoopDistanceProtection>;
+
+        static constexpr size_t LOOPS = MultiLoopDistanceResult::LOOPS;
+
+        /**
+         * @brief Creates a new MultiLoopDistanceProtection instance
+         * @param settings The multi-loop distance settings
+         * @return A shared pointer to the created MultiLoopDistanceProtection
+         */
+        [[nodiscard]] static Ptr create(const MultiLoopDistanceSettings& settings = MultiLoopDistanceSettings());
+
+        /**
+         * @brief Destructor
+         */
+        ~MultiLoopDistanceProtection() = default;
+
+        MultiLoopDistanceProtection(const MultiLoopDistanceProtection&) = delete;
+        MultiLoopDistanceProtection& operator=(const MultiLoopDistanceProtection&) = delete;
+        MultiLoopDistanceProtection(MultiLoopDistanceProtection&&) noexcept = delete;
+        MultiLoopDistanceProtection& operator=(MultiLoopDistanceProtection&&) noexcept = delete;
+
+        /**
+         * @brief Evaluates all six loops from phase phasors
+         * @param voltagesV Phase A, B, C voltage phasors in volts
+         * @param currentsA Phase A, B, C current phasors in amperes
+         * @return A MultiLoopDistanceResult with loop impedances and trip information
+         */
+        [[nodiscard]] MultiLoopDistanceResult update(std::span<const std::complex<double>, 3> voltagesV,
+                                                     std::span<const std::complex<double>, 3> currentsA);
+
+        /**
+         * @brief Evaluates all six loops with the zone timers running on sample time
+         * @param voltagesV Phase A, B, C voltage phasors in volts
+         * @param currentsA Phase A, B, C current phasors in amperes
+         * @param sampleTime The time of the sample on a monotonic time base, e.g. from a SampleClock
+         * @return A MultiLoopDistanceResult with loop impedances and trip information
+         */
+        [[nodiscard]] MultiLoopDistanceResult update(std::span<const std::complex<double>, 3> voltagesV,
+                                                     std::span<const std::complex<double>, 3> currentsA,
+                                                     std::chrono::nanoseconds sampleTime);
+
+        /**
+         * @brief Evaluates all six loops from a three-phase measurement
+         * @param measurement The three-phase measurement
+         * @return A MultiLoopDistanceResult with loop impedances and trip information
+         */
+        [[nodiscard]] MultiLoopDistanceResult update(const ThreePhaseMeasurement& measurement);
+
+        /**
+         * @brief Evaluates all six loops from a three-phase measurement taken at a given sample time
+         * @param measurement The three-phase measurement
+         * @param sampleTime The time of the sample on a monotonic time base
+         * @return A MultiLoopDistanceResult with loop impedances and trip information
+         */
+        [[nodiscard]] MultiLoopDistanceResult update(const ThreePhaseMeasurement& measurement, std::chrono::nanoseconds sampleTime);
+
+        /**
+         * @brief Resets the zone timers
+         */
+        void reset();
+
+        /**
+         * @brief Sets the multi-loop distance settings
+         * @param settings The new settings
+         */
+        void setSettings(const MultiLoopDistanceSettings& settings);
+
+        /**
+         * @brief Gets the current multi-loop distance settings
+         * @return The settings
+         */
+        [[nodiscard]] MultiLoopDistanceSettings getSettings() const;
+
+        /**
+         * @brief Sets whether the protection is enabled
+         * @param enabled true to enable, false to disable
+         */
+        void setEnabled(bool enabled) noexcept;
+
+        /**
+         * @brief Checks if the protection is enabled
+         * @return true if enabled, false otherwise
+         */
+        [[nodiscard]] bool isEnabled() const noexcept;
+
+        /**
+         * @brief Registers a callback for trip events
+         *
+         * The callback runs inline on the evaluating thread, under a lock, before update() returns.
+         * @param callback The callback function to register
+         * @deprecated Use setTripDispatcher() and subscribe to the TripEventDispatcher, so slow
+         * trip handling does not delay the next evaluation.
+         */
+        void onTrip(std::function<void(const MultiLoopDistanceResult&)> callback);
+
+        /**
+         * @brief Routes trip events to a dispatcher in addition to the onTrip callback
+         *
+         * One event with the combined trip flags is published when the trip state rises from
+         * clear to set; a standing fault publishes nothing further until it clears.
+         * Must not be called while the element is being evaluated.
+         * @param dispatcher The dispatcher, or nullptr to detach
+         * @param elementId Identifier copied into every TripEvent
+         */
+        void setTripDispatcher(TripEventDispatcher::Ptr dispatcher, uint32_t elementId = 0);
+
+    private:
+        /// @brief Lane count of the batch, padded to a full 512-bit vector
+        static constexpr size_t LANES = 8;
+
+        /// @brief Zone characteristic precomputed for the batch \struct ZoneShape
+        struct ZoneShape
+        {
+            bool enabled{false};
+            bool mho{true};
+            double centerR{0.0};
+            double centerX{0.0};
+            double radiusSquared{0.0};
+            double reactanceReach{0.0};
+            double resistiveReach{0.0};
+            double cotangent{0.0};
+        };
+
+        /// @brief Settings published together with their precomputed zone shapes \struct Snapshot
+        struct Snapshot
+        {
+            MultiLoopDistanceSettings settings;
+            std::array<ZoneShape, 3> shapes{};
+        };
+
+        /**
+         * @brief Constructor is private.
+         * @param settings The multi-loop distance settings
+         */
+        explicit MultiLoopDistanceProtection(const MultiLoopDistanceSettings& settings);
+
+        /**
+         * @brief Builds a snapshot with the zone shapes precomputed from the settings.
+         * @param settings The multi-loop distance settings
+         * @return The snapshot
+         */
+        [[nodiscard]] static Snapshot makeSnapshot(const MultiLoopDistanceSettings& settings) noexcept;
+
+        /**
+         * @brief Tests all lanes against one zone and ORs the bit into the zone masks.
+         * @param shape The zone shape
+         * @param bit The zone bit
+         */
+        void applyZone(const ZoneShape& shape, uint8_t bit) noexcept;
+
+        /**
+         * @brief Tracks the trip state of one evaluation: publishes a TripEvent with the combined
+         * flags only when the state rises from clear to set, and invokes the registered callback
+         * for every tripping result. Called once per evaluation, tripping or not.
+         * @param result The multi-loop distance protection result
+         */
+        void invokeCallBack(const MultiLoopDistanceResult& result);
+
+        RcuCell<Snapshot> snapshot_;
+
+        alignas(64) std::array<double, LANES> resistance_{};
+        alignas(64) std::array<double, LANES> reactance_{};
+        alignas(64) std::array<uint8_t, LANES> valid_{};
+        alignas(64) std::array<uint8_t, LANES> zones_{};
+
+        std::atomic<bool> enabled_{true};
+        std::array<bool, 3> zoneActive_{};
+        std::array<std::chrono::nanoseconds, 3> zoneStartTime_{};
+
+        std::function<void(const MultiLoopDistanceResult&)> callback_;
+        std::mutex callbackMutex_;
+        std::atomic<bool> hasCallback_{false};
+        bool tripped_{false};
+
+        TripEventDispatcher::Ptr dispatcher_;
+        std::atomic<TripEventDispatcher*> dispatcherRaw_{nullptr};
+        uint32_t elementId_{0};
+    };
+}
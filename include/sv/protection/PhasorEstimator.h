@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <memory>
+#include <span>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Forward declaration of SampledValueControlBlock \class SampledValueControlBlock
+    class SampledValueControlBlock;
+
+    /**
+     * @brief Per-channel recursive sliding-DFT fundamental phasor estimator. \class PhasorEstimator
+     *
+     * Keeps a one-cycle window of samples per channel in a fixed ring buffer. Every new sample
+     * adds its contribution and removes the one leaving the window, so an update costs O(1) per
+     * channel regardless of the samples per period. Phasors are RMS-scaled and referenced to the
+     * sample counter, so a cosine at nominal frequency has angle 0 and a sine -pi/2.
+     *
+     * Channel order follows the SV dataset: 0-3 currents (Ia, Ib, Ic, In), 4-7 voltages (Va, Vb, Vc, Vn).
+     */
+    class PhasorEstimator
+    {
+    public:
+        using Ptr = std::shared_ptr<PhasorEstimator>;
+
+        /// @brief Number of channels (one per dataset value).
+        static constexpr size_t CHANNELS = VALUES_PER_ASDU;
+
+        /// @brief Largest supported window.
+        static constexpr size_t MAX_SAMPLES_PER_PERIOD = static_cast<size_t>(SamplesPerPeriod::SPP_256);
+
+        /// @brief Index of the first voltage channel.
+        static constexpr size_t FIRST_VOLTAGE_CHANNEL = 4;
+
+        /**
+         * @brief Creates a new PhasorEstimator
+         * @param samplesPerPeriod The window length (samples per nominal cycle)
+         * @param frequency The nominal signal frequency
+         * @param currentScaling Divisor turning raw current values into amperes
+         * @param voltageScaling Divisor turning raw voltage values into volts
+         * @return A shared pointer to the created PhasorEstimator
+         */
+        [[nodiscard]] static Ptr create(SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                                        SignalFrequency frequency = SignalFrequency::FREQ_50_HZ,
+                                        int32_t currentScaling = ScalingFactors::CURRENT_DEFAULT,
+                                        int32_t voltageScaling = ScalingFactors::VOLTAGE_DEFAULT);
+
+        /**
+         * @brief Creates a PhasorEstimator matching a control block's sampling and scaling
+         * @param svcb The control block
+         * @return A shared pointer to the created PhasorEstimator
+         */
+        [[nodiscard]] static Ptr create(const SampledValueControlBlock& svcb);
+
+        PhasorEstimator(const PhasorEstimator&) = delete;
+        PhasorEstimator& operator=(const PhasorEstimator&) = delete;
+
+        /**
+         * @brief Adds one sample per channel in engineering units
+         * @param samples The instantaneous values
+         */
+        void update(std::span<const double, CHANNELS> samples) noexcept;
+
+        /**
+         * @brief Adds the dataset of an ASDU, scaled to amperes and volts
+         * @param asdu The received ASDU; ignored if its dataset is incomplete
+         */
+        void update(const ASDU& asdu) noexcept;
+
+        /**
+         * @brief Gets the fundamental phasor of a channel
+         * @param channel The channel index
+         * @return The RMS phasor
+         */
+        [[nodiscard]] std::complex<double> getPhasor(size_t channel) const noexcept;
+
+        /**
+         * @brief Gets a phase current phasor
+         * @param phase The phase index (0 = A, 1 = B, 2 = C, 3 = neutral)
+         * @return The RMS phasor in amperes
+         */
+        [[nodiscard]] std::complex<double> getCurrent(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets a phase voltage phasor
+         * @param phase The phase index (0 = A, 1 = B, 2 = C, 3 = neutral)
+         * @return The RMS phasor in volts
+         */
+        [[nodiscard]] std::complex<double> getVoltage(size_t phase) const noexcept;
+
+        /**
+         * @brief Checks whether a full cycle has been observed since the last reset
+         * @return true if the phasors are valid
+         */
+        [[nodiscard]] bool isValid() const noexcept;
+
+        /**
+         * @brief Clears the window and all phasors
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Gets the window length
+         * @return The samples per period
+         */
+        [[nodiscard]] size_t getSamplesPerPeriod() const noexcept;
+
+        /**
+         * @brief Gets the nominal frequency
+         * @return The frequency in Hz
+         */
+        [[nodiscard]] double getFrequencyHz() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private.
+         * @param samplesPerPeriod The window length
+         * @param frequencyHz The nominal frequency in Hz
+         * @param currentScaling The current scaling divisor
+         * @param voltageScaling The voltage scaling divisor
+         */
+        PhasorEstimator(size_t samplesPerPeriod, double frequencyHz, int32_t currentScaling, int32_t voltageScaling);
+
+        size_t samplesPerPeriod_;
+        double frequencyHz_;
+        double currentScale_;
+        double voltageScale_;
+
+        std::array<std::complex<double>, MAX_SAMPLES_PER_PERIOD> twiddle_{};
+        std::array<std::array<double, CHANNELS>, MAX_SAMPLES_PER_PERIOD> window_{};
+        std::array<std::complex<double>, CHANNELS> phasor_{};
+        size_t index_{0};
+        size_t filled_{0};
+    };
+}
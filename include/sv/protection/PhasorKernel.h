@@ -0,0 +1,200 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <memory>
+#include <span>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Forward declaration of SampledValueControlBlock \class SampledValueControlBlock
+    class SampledValueControlBlock;
+
+    /**
+     * @brief Vectorized sliding-DFT phasor and RMS kernel over 8-channel datasets. \class PhasorKernel
+     *
+     * Consumes raw int32 datasets (Ia, Ib, Ic, In, Va, Vb, Vc, Vn) and updates the DFT accumulators
+     * and RMS windows of all eight channels in one pass per sample: one AVX-512 register or two
+     * AVX2 registers hold a whole dataset. The instruction set is chosen at runtime; the scalar
+     * fallback is written so the compiler can vectorize it for the baseline target.
+     *
+     * The accumulators are recomputed from the window every RESYNC_CYCLES cycles so rounding
+     * errors of the recursive update cannot build up over long runs.
+     */
+    class PhasorKernel
+    {
+    public:
+        /// @brief Instruction set used by the kernel. \enum Isa
+        enum class Isa
+        {
+            Scalar,
+            Avx2,
+            Avx512
+        };
+
+        /// @brief Number of channels in a dataset.
+        static constexpr size_t CHANNELS = VALUES_PER_ASDU;
+
+        /// @brief Largest supported window.
+        static constexpr size_t MAX_SAMPLES_PER_PERIOD = static_cast<size_t>(SamplesPerPeriod::SPP_256);
+
+        /// @brief Index of the first voltage channel.
+        static constexpr size_t FIRST_VOLTAGE_CHANNEL = 4;
+
+        /// @brief Number of cycles between exact recomputations of the accumulators.
+        static constexpr size_t RESYNC_CYCLES = 64;
+
+        /**
+         * @brief Creates a new PhasorKernel
+         * @param samplesPerPeriod The window length (samples per nominal cycle)
+         * @param currentScaling Divisor turning raw current values into amperes
+         * @param voltageScaling Divisor turning raw voltage values into volts
+         * @param isa The instruction set; must be supported by the CPU
+         * @return A unique pointer to the created PhasorKernel
+         * @throws std::invalid_argument if a scaling factor is not positive or the ISA is unsupported
+         */
+        [[nodiscard]] static std::unique_ptr<PhasorKernel> create(SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                                                                  int32_t currentScaling = ScalingFactors::CURRENT_DEFAULT,
+                                                                  int32_t voltageScaling = ScalingFactors::VOLTAGE_DEFAULT,
+                                                                  Isa isa = detectIsa());
+
+        /**
+         * @brief Creates a PhasorKernel matching a control block's sampling and scaling
+         * @param svcb The control block
+         * @param isa The instruction set; must be supported by the CPU
+         * @return A unique pointer to the created PhasorKernel
+         */
+        [[nodiscard]] static std::unique_ptr<PhasorKernel> create(const SampledValueControlBlock& svcb, Isa isa = detectIsa());
+
+        /**
+         * @brief Detects the widest instruction set supported by the CPU
+         * @return The detected Isa
+         */
+        [[nodiscard]] static Isa detectIsa() noexcept;
+
+        /**
+         * @brief Checks whether the CPU supports an instruction set
+         * @param isa The instruction set
+         * @return true if supported
+         */
+        [[nodiscard]] static bool isSupported(Isa isa) noexcept;
+
+        PhasorKernel(const PhasorKernel&) = delete;
+        PhasorKernel& operator=(const PhasorKernel&) = delete;
+
+        /**
+         * @brief Adds one dataset
+         * @param dataset The raw values of all channels
+         */
+        void update(std::span<const int32_t, CHANNELS> dataset) noexcept;
+
+        /**
+         * @brief Adds consecutive datasets stored back to back
+         * @param datasets The raw values; the size must be a multiple of CHANNELS
+         */
+        void process(std::span<const int32_t> datasets) noexcept;
+
+        /**
+         * @brief Gets the fundamental phasor of a channel
+         * @param channel The channel index
+         * @return The RMS phasor in amperes or volts
+         */
+        [[nodiscard]] std::complex<double> getPhasor(size_t channel) const noexcept;
+
+        /**
+         * @brief Gets the true RMS value of a channel over the last cycle
+         * @param channel The channel index
+         * @return The RMS value in amperes or volts
+         */
+        [[nodiscard]] double getRms(size_t channel) const noexcept;
+
+        /**
+         * @brief Checks whether a full cycle has been observed since the last reset
+         * @return true if the outputs are valid
+         */
+        [[nodiscard]] bool isValid() const noexcept;
+
+        /**
+         * @brief Clears the window and all accumulators
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Gets the instruction set in use
+         * @return The Isa
+         */
+        [[nodiscard]] Isa getIsa() const noexcept;
+
+        /**
+         * @brief Gets the window length
+         * @return The samples per period
+         */
+        [[nodiscard]] size_t getSamplesPerPeriod() const noexcept;
+
+    private:
+        /// @brief Signature of the per-ISA processing loops.
+        using ProcessFn = void (*)(PhasorKernel&, const int32_t*, size_t);
+
+        /**
+         * @brief Constructor is private.
+         * @param samplesPerPeriod The window length
+         * @param currentScaling The current scaling divisor
+         * @param voltageScaling The voltage scaling divisor
+         * @param isa The instruction set
+         */
+        PhasorKernel(size_t samplesPerPeriod, int32_t currentScaling, int32_t voltageScaling, Isa isa);
+
+        /**
+         * @brief Scalar processing loop.
+         * @param kernel The kernel state
+         * @param data The datasets
+         * @param count The number of datasets
+         */
+        static void processScalar(PhasorKernel& kernel, const int32_t* data, size_t count) noexcept;
+
+        /**
+         * @brief AVX2/FMA processing loop (two 4-wide halves per dataset).
+         * @param kernel The kernel state
+         * @param data The datasets
+         * @param count The number of datasets
+         */
+        static void processAvx2(PhasorKernel& kernel, const int32_t* data, size_t count) noexcept;
+
+        /**
+         * @brief AVX-512 processing loop (one 8-wide register per dataset).
+         * @param kernel The kernel state
+         * @param data The datasets
+         * @param count The number of datasets
+         */
+        static void processAvx512(PhasorKernel& kernel, const int32_t* data, size_t count) noexcept;
+
+        /**
+         * @brief Advances the window position after a sample.
+         * @return true if the accumulators must be resynchronised now
+         */
+        bool advance() noexcept;
+
+        /**
+         * @brief Recomputes the accumulators exactly from the window.
+         */
+        void resync() noexcept;
+
+        size_t samplesPerPeriod_;
+        Isa isa_;
+        ProcessFn process_;
+
+        alignas(64) std::array<double, CHANNELS> scale_{};
+        alignas(64) std::array<double, CHANNELS> real_{};
+        alignas(64) std::array<double, CHANNELS> imag_{};
+        alignas(64) std::array<double, CHANNELS> sumSquares_{};
+        alignas(64) std::array<std::array<double, CHANNELS>, MAX_SAMPLES_PER_PERIOD> window_{};
+        std::array<double, MAX_SAMPLES_PER_PERIOD> cos_{};
+        std::array<double, MAX_SAMPLES_PER_PERIOD> sin_{};
+
+        size_t index_{0};
+        size_t filled_{0};
+        size_t cycles_{0};
+    };
+}
@@ -7,6 +7,9 @@
 #include <atomic>
 #include <mutex>
 #include <numbers>
+#include <span>
+#include "sv/core/rcu.h"
+#include "sv/protection/TripEvents.h"
 
 /// @brief sv namespace \namespace sv
 namespace sv
@@ -76,6 +79,7 @@ namespace sv
         bool zone3Trip{false};
         double measuredImpedanceOhm{0.0};
         double measuredAngleRad{0.0};
+        std::chrono::nanoseconds sampleTime{0};
         std::chrono::steady_clock::time_point tripTime;
     };
 
@@ -88,6 +92,9 @@ namespace sv
     public:
         using Ptr = std::shared_ptr<DistanceProtection>;
 
+        /// @brief Samples evaluated per vectorized pass of updateBlock
+        static constexpr size_t BLOCK_CHUNK = 64;
+
         /**
          * @brief Creates a new DistanceProtection instance
          * @param settings The distance protection settings
@@ -107,12 +114,58 @@ namespace sv
 
         /**
          * @brief Updates the protection with new voltage and current measurements
+         *
+         * The zone timers run on steady_clock. Use the sampleTime overload for deterministic timing.
          * @param voltageV The complex voltage in volts
          * @param currentA The complex current in amperes
          * @return A DistanceProtectionResult with trip information
          */
         [[nodiscard]] DistanceProtectionResult update(std::complex<double> voltageV, std::complex<double> currentA);
 
+        /**
+         * @brief Updates the protection with measurements taken at a given sample time
+         *
+         * The zone timers compare sample times only, e.g. from a SampleClock or the SV timestamps,
+         * so the result does not depend on when or how fast the samples are processed. steady_clock
+         * is read only to stamp tripTime when a zone trips.
+         * @param voltageV The complex voltage in volts
+         * @param currentA The complex current in amperes
+         * @param sampleTime The time of the sample on a monotonic time base
+         * @return A DistanceProtectionResult with trip information
+         */
+        [[nodiscard]] DistanceProtectionResult update(std::complex<double> voltageV, std::complex<double> currentA,
+                                                      std::chrono::nanoseconds sampleTime);
+
+        /**
+         * @brief Evaluates a block of consecutive samples in one call
+         *
+         * Settings and the enabled flag are read once per block and impedances and zone pickups
+         * are computed in a branch-free pass before the zone timers are advanced sample by sample.
+         * All samples of a block share one timestamp.
+         * @param voltagesV The complex voltages in volts
+         * @param currentsA The complex currents in amperes, same length as voltagesV
+         * @param results Receives one result per sample, at least as long as voltagesV
+         * @throws std::invalid_argument if the span lengths do not match
+         */
+        void updateBlock(std::span<const std::complex<double>> voltagesV, std::span<const std::complex<double>> currentsA,
+                         std::span<DistanceProtectionResult> results);
+
+        /**
+         * @brief Evaluates a block of consecutive samples with their sample times
+         *
+         * Sample k is timed at firstSampleTime + k * samplePeriod, so the zone timers advance
+         * within the block exactly as with one update() call per sample.
+         * @param voltagesV The complex voltages in volts
+         * @param currentsA The complex currents in amperes, same length as voltagesV
+         * @param results Receives one result per sample, at least as long as voltagesV
+         * @param firstSampleTime The time of the first sample of the block
+         * @param samplePeriod The time between two samples
+         * @throws std::invalid_argument if the span lengths do not match
+         */
+        void updateBlock(std::span<const std::complex<double>> voltagesV, std::span<const std::complex<double>> currentsA,
+                         std::span<DistanceProtectionResult> results, std::chrono::nanoseconds firstSampleTime,
+                         std::chrono::nanoseconds samplePeriod);
+
         /**
          * @brief Resets the internal state of the protection
          */
@@ -144,10 +197,25 @@ namespace sv
 
         /**
          * @brief Registers a callback for trip events
+         *
+         * The callback runs inline on the evaluating thread, under a lock, before update() returns.
          * @param callback The callback function to register
+         * @deprecated Use setTripDispatcher() and subscribe to the TripEventDispatcher, so slow
+         * trip handling does not delay the next evaluation.
          */
         void onTrip(ProtectionTripCallback callback);
 
+        /**
+         * @brief Routes trip events to a dispatcher in addition to the onTrip callback
+         *
+         * One event with the combined trip flags is published when the trip state rises from
+         * clear to set; a standing fault publishes nothing further until it clears.
+         * Must not be called while the element is being evaluated.
+         * @param dispatcher The dispatcher, or nullptr to detach
+         * @param elementId Identifier copied into every TripEvent
+         */
+        void setTripDispatcher(TripEventDispatcher::Ptr dispatcher, uint32_t elementId = 0);
+
     private:
         /**
          * @brief Constructor is private.
@@ -166,24 +234,37 @@ namespace sv
 
         /**
          * @brief Checks the direction of the fault.
+         * @param settings The settings snapshot
          * @param impedance The measured impedance
          * @return A bool indicating if the direction is correct
          */
-        [[nodiscard]] bool checkDirecation(std::complex<double> impedance) const noexcept;
+        [[nodiscard]] static bool checkDirecation(const DistanceProtectionSettings& settings, std::complex<double> impedance) noexcept;
 
         /**
-         * @brief Invokes the registered callback with the result.
+         * @brief Advances the definite-time logic of one zone.
+         * @param zone The distance zone settings
+         * @param active The zone pickup flag
+         * @param startTime The zone pickup sample time
+         * @param now The sample time being evaluated
+         * @return A bool indicating if the zone delay has expired
+         */
+        [[nodiscard]] static bool checkZoneTimer(const DistanceZone& zone, std::atomic<bool>& active,
+                                                 std::chrono::nanoseconds& startTime, std::chrono::nanoseconds now) noexcept;
+
+        /**
+         * @brief Tracks the trip state of one evaluation: publishes a TripEvent with the combined
+         * flags only when the state rises from clear to set, and invokes the registered callback
+         * for every tripping result. Called once per evaluation, tripping or not.
          * @param result The distance protection result
          */
         void invokeCallBack(const DistanceProtectionResult& result);
 
-        DistanceProtectionSettings settings_;
-        mutable std::mutex settingsMutex_;
+        RcuCell<DistanceProtectionSettings> settings_;
 
         std::atomic<bool> enabled_{true};
-        std::chrono::steady_clock::time_point zone1StartTime_;
-        std::chrono::steady_clock::time_point zone2StartTime_;
-        std::chrono::steady_clock::time_point zone3StartTime_;
+        std::chrono::nanoseconds zone1StartTime_{0};
+        std::chrono::nanoseconds zone2StartTime_{0};
+        std::chrono::nanoseconds zone3StartTime_{0};
 
         std::atomic<bool> zone1Active_{false};
         std::atomic<bool> zone2Active_{false};
@@ -191,6 +272,12 @@ namespace sv
 
         ProtectionTripCallback callback_;
         std::mutex callbackMutex_;
+        std::atomic<bool> hasCallback_{false};
+        std::atomic<bool> tripped_{false};
+
+        TripEventDispatcher::Ptr dispatcher_;
+        std::atomic<TripEventDispatcher*> dispatcherRaw_{nullptr};
+        uint32_t elementId_{0};
     };
 
     /// @brief Differential Protection Settings structure \struct DifferentialProtectionSettings
@@ -221,6 +308,7 @@ namespace sv
         double operatingCurrentA{0.0};
         double restraintCurrentA{0.0};
         bool instantaneous{false};
+        bool restrained{false};
         std::chrono::steady_clock::time_point tripTime;
     };
 
@@ -230,6 +318,9 @@ namespace sv
     public:
         using Ptr = std::shared_ptr<DifferentialProtection>;
 
+        /// @brief Samples evaluated per vectorized pass of updateBlock
+        static constexpr size_t BLOCK_CHUNK = 64;
+
         /**
          * @brief Creates a new DifferentialProtection instance
          * @param settings The differential protection settings
@@ -255,6 +346,46 @@ namespace sv
          */
         [[nodiscard]] DifferentialProtectionResult update(std::complex<double> current1A, std::complex<double> current2A);
 
+        /**
+         * @brief Updates the protection with a harmonic or CT saturation restraint decision
+         *
+         * A restrained sample cannot trip on the slope characteristic; the unrestrained
+         * instantaneous element still operates. See HarmonicRestraint.
+         * @param current1A The complex current from side 1 in amperes
+         * @param current2A The complex current from side 2 in amperes
+         * @param restrained true if the restraint blocks the phase of this element
+         * @return A DifferentialProtectionResult with trip information
+         */
+        [[nodiscard]] DifferentialProtectionResult update(std::complex<double> current1A, std::complex<double> current2A,
+                                                          bool restrained);
+
+        /**
+         * @brief Evaluates a block of consecutive samples in one call
+         *
+         * Settings and the enabled flag are read once per block and the characteristic is
+         * evaluated in a branch-free pass over the whole block. All samples of a block share one timestamp.
+         * @param current1A The complex currents from side 1 in amperes
+         * @param current2A The complex currents from side 2 in amperes, same length as current1A
+         * @param results Receives one result per sample, at least as long as current1A
+         * @throws std::invalid_argument if the span lengths do not match
+         */
+        void updateBlock(std::span<const std::complex<double>> current1A, std::span<const std::complex<double>> current2A,
+                         std::span<DifferentialProtectionResult> results);
+
+        /**
+         * @brief Evaluates a block of consecutive samples with a harmonic or CT saturation restraint decision per sample
+         *
+         * As update() with restrained: a restrained sample cannot trip on the slope characteristic and
+         * reports restrained instead; the unrestrained instantaneous element still operates.
+         * @param current1A The complex currents from side 1 in amperes
+         * @param current2A The complex currents from side 2 in amperes, same length as current1A
+         * @param restrained Non-zero where the restraint blocks the sample; empty for no restraint
+         * @param results Receives one result per sample, at least as long as current1A
+         * @throws std::invalid_argument if the span lengths do not match
+         */
+        void updateBlock(std::span<const std::complex<double>> current1A, std::span<const std::complex<double>> current2A,
+                         std::span<const uint8_t> restrained, std::span<DifferentialProtectionResult> results);
+
 
         /**
          * @brief Resets the internal state of the protection
@@ -287,10 +418,25 @@ namespace sv
 
         /**
          * @brief Registers a callback for trip events
+         *
+         * The callback runs inline on the evaluating thread, under a lock, before update() returns.
          * @param callback The callback function to register
+         * @deprecated Use setTripDispatcher() and subscribe to the TripEventDispatcher, so slow
+         * trip handling does not delay the next evaluation.
          */
         void onTrip(std::function<void(const DifferentialProtectionResult&)> callback);
 
+        /**
+         * @brief Routes trip events to a dispatcher in addition to the onTrip callback
+         *
+         * One event with the combined trip flags is published when the trip state rises from
+         * clear to set; a standing fault publishes nothing further until it clears.
+         * Must not be called while the element is being evaluated.
+         * @param dispatcher The dispatcher, or nullptr to detach
+         * @param elementId Identifier copied into every TripEvent
+         */
+        void setTripDispatcher(TripEventDispatcher::Ptr dispatcher, uint32_t elementId = 0);
+
     private:
         /**
          * @brief Constructor is private.
@@ -300,19 +446,34 @@ namespace sv
 
         /**
          * @brief Checks the characteristic curve.
+         * @param settings The settings snapshot
          * @param operating The operating current
          * @param restraint The restraint current
          * @return A bool indicating if the characteristic is met
          */
-        [[nodiscard]] bool checkCharacteristic(double operating, double restraint) const noexcept;
+        [[nodiscard]] static bool checkCharacteristic(const DifferentialProtectionSettings& settings, double operating,
+                                                      double restraint) noexcept;
 
-        DifferentialProtectionSettings settings_;
-        mutable std::mutex settingsMutex_;
+        /**
+         * @brief Tracks the trip state of one evaluation: publishes a TripEvent with the combined
+         * flags only when the state rises from clear to set, and invokes the registered callback
+         * for every tripping result. Called once per evaluation, tripping or not.
+         * @param result The differential protection result
+         */
+        void invokeCallBack(const DifferentialProtectionResult& result);
+
+        RcuCell<DifferentialProtectionSettings> settings_;
 
         std::atomic<bool> enabled_{true};
 
         std::function<void(const DifferentialProtectionResult&)> callback_;
         std::mutex callbackMutex_;
+        std::atomic<bool> hasCallback_{false};
+        bool tripped_{false};
+
+        TripEventDispatcher::Ptr dispatcher_;
+        std::atomic<TripEventDispatcher*> dispatcherRaw_{nullptr};
+        uint32_t elementId_{0};
     };
 
 }
\ No newline at end of file
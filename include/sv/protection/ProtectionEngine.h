@@ -0,0 +1,260 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+#include "sv/core/ring.h"
+#include "sv/protection/Protection.h"
+#include "sv/protection/TripEvents.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /**
+     * @brief Settings of one relay instance hosted by a ProtectionEngine \struct RelaySettings
+     *
+     * The differential element is off by default and is switched on by differential.enabled.
+     */
+    struct RelaySettings
+    {
+        uint32_t elementId{0};
+        bool distanceEnabled{true};
+        DistanceProtectionSettings distance;
+        DifferentialProtectionSettings differential{.enabled = false};
+
+        /**
+         * @brief Validates the relay settings
+         * @return true if settings are valid
+         */
+        bool isValid() const noexcept
+        {
+            return distance.isValid() && differential.isValid();
+        }
+    };
+
+    /// @brief Evaluation statistics of one engine worker \struct EngineWorkerStats
+    struct EngineWorkerStats
+    {
+        size_t worker{0};
+        int cpu{-1};
+        size_t relays{0};
+        uint64_t sweeps{0};
+        uint64_t totalNs{0};
+        uint64_t maxNs{0};
+
+        /**
+         * @brief Mean sweep time of the worker
+         * @return The mean in nanoseconds, 0 if no sweep ran
+         */
+        [[nodiscard]] double meanNs() const noexcept
+        {
+            return sweeps == 0 ? 0.0 : static_cast<double>(totalNs) / static_cast<double>(sweeps);
+        }
+    };
+
+    /**
+     * @brief Evaluates many distance/differential relay instances in struct-of-arrays form. \class ProtectionEngine
+     *
+     * Settings and state of all relays live in contiguous per-field columns instead of one heap
+     * object per relay with its own mutexes, atomics and callbacks. Every evaluate() call takes
+     * one sample for all relays and sweeps them in a branch-free loop. Relays are split into
+     * contiguous partitions, one per worker. The calling thread sweeps partition 0 and worker
+     * threads sweep the rest, so the engine scales horizontally. Zone timers run on the sample
+     * timestamp passed by the caller. Rising trip edges are published as TripEvents from the
+     * worker that detected them, and each worker records its sweep time.
+     */
+    class ProtectionEngine
+    {
+    public:
+        using Ptr = std::shared_ptr<ProtectionEngine>;
+
+        /// @brief Trip bits reported per relay by getTrips()
+        static constexpr uint8_t TRIP_ZONE1 = 1u << 0;
+        static constexpr uint8_t TRIP_ZONE2 = 1u << 1;
+        static constexpr uint8_t TRIP_ZONE3 = 1u << 2;
+        static constexpr uint8_t TRIP_DIFFERENTIAL = 1u << 3;
+        static constexpr uint8_t TRIP_INSTANTANEOUS = 1u << 4;
+
+        /**
+         * @brief Creates a new ProtectionEngine
+         * @param workers Number of partitions including the calling thread
+         * @param pinWorkers Pin worker i to CPU i modulo the number of CPUs
+         * @return A shared pointer to the created engine
+         * @throws std::invalid_argument if workers is zero
+         */
+        [[nodiscard]] static Ptr create(size_t workers = 1, bool pinWorkers = false);
+
+        /**
+         * @brief Destructor. Stops the worker threads.
+         */
+        ~ProtectionEngine();
+
+        ProtectionEngine(const ProtectionEngine&) = delete;
+        ProtectionEngine& operator=(const ProtectionEngine&) = delete;
+        ProtectionEngine(ProtectionEngine&&) noexcept = delete;
+        ProtectionEngine& operator=(ProtectionEngine&&) noexcept = delete;
+
+        /**
+         * @brief Adds a relay instance. Only allowed while the engine is stopped.
+         * @param settings The relay settings
+         * @return The relay index used in the input and trip spans
+         * @throws std::invalid_argument if the settings are invalid
+         * @throws std::logic_error if the engine is running
+         */
+        size_t addRelay(const RelaySettings& settings);
+
+        /**
+         * @brief Publishes rising trip edges to a dispatcher. Only allowed while the engine is stopped.
+         * @param dispatcher The dispatcher, or nullptr to detach
+         */
+        void setTripDispatcher(TripEventDispatcher::Ptr dispatcher);
+
+        /**
+         * @brief Starts the worker threads and partitions the relays.
+         */
+        void start();
+
+        /**
+         * @brief Stops the worker threads.
+         */
+        void stop();
+
+        /**
+         * @brief Checks if the worker threads are running.
+         * @return true if running
+         */
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        /**
+         * @brief Evaluates one sample for every relay
+         *
+         * Without start() the calling thread sweeps all relays.
+         * @param voltagesV Voltage phasor per relay
+         * @param currentsA Local current phasor per relay
+         * @param remoteCurrentsA Remote-end current phasor per relay for the differential element
+         * @param timestampNs Sample time in nanoseconds, used by the zone timers
+         * @throws std::invalid_argument if a span is not one entry per relay
+         */
+        void evaluate(std::span<const std::complex<double>> voltagesV, std::span<const std::complex<double>> currentsA,
+                      std::span<const std::complex<double>> remoteCurrentsA, int64_t timestampNs);
+
+        /**
+         * @brief Gets the trip bits of every relay from the last evaluate()
+         * @return One TRIP_* bit set per relay
+         */
+        [[nodiscard]] std::span<const uint8_t> getTrips() const noexcept;
+
+        /**
+         * @brief Resets all zone timers and trip states
+         */
+        void reset() noexcept;
+
+        /**
+         * @brief Getter for the number of relays
+         * @return The relay count
+         */
+        [[nodiscard]] size_t getRelayCount() const noexcept;
+
+        /**
+         * @brief Getter for the number of workers
+         * @return The worker count
+         */
+        [[nodiscard]] size_t getWorkerCount() const noexcept;
+
+        /**
+         * @brief Gets the evaluation statistics of one worker
+         * @param worker The worker index
+         * @return The statistics
+         */
+        [[nodiscard]] EngineWorkerStats getWorkerStats(size_t worker) const;
+
+        /**
+         * @brief Clears the worker statistics
+         */
+        void resetStats() noexcept;
+
+    private:
+        /// @brief Per-worker partition and counters \struct Worker
+        struct alignas(CACHE_LINE_SIZE) Worker
+        {
+            size_t begin{0};
+            size_t end{0};
+            std::atomic<int> cpu{-1};
+            std::atomic<uint64_t> sweeps{0};
+            std::atomic<uint64_t> totalNs{0};
+            std::atomic<uint64_t> maxNs{0};
+        };
+
+        /**
+         * @brief Constructor is private.
+         * @param workers Number of partitions
+         * @param pinWorkers Pin workers to CPUs
+         */
+        ProtectionEngine(size_t workers, bool pinWorkers);
+
+        /**
+         * @brief Splits the relays into contiguous partitions.
+         */
+        void partition() noexcept;
+
+        /**
+         * @brief Sweeps one partition, records its time and publishes its trip edges.
+         * @param worker The worker
+         */
+        void runPartition(Worker& worker) noexcept;
+
+        /**
+         * @brief Evaluates the relays in [begin, end) for the current sample.
+         * @param begin First relay
+         * @param end One past the last relay
+         */
+        void sweep(size_t begin, size_t end) noexcept;
+
+        /**
+         * @brief Worker thread body.
+         * @param index The worker index
+         * @param seen The generation at start(), so samples or a stop() issued before the thread runs are not missed
+         */
+        void workerLoop(size_t index, uint64_t seen);
+
+        const bool pinWorkers_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+        std::vector<std::thread> threads_;
+        std::atomic<bool> running_{false};
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> generation_{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> completed_{0};
+
+        const std::complex<double>* voltages_{nullptr};
+        const std::complex<double>* currents_{nullptr};
+        const std::complex<double>* remoteCurrents_{nullptr};
+        int64_t timestampNs_{0};
+        int64_t originNs_{0};
+
+        TripEventDispatcher::Ptr dispatcher_;
+
+        std::vector<uint32_t> elementId_;
+        std::vector<uint8_t> distanceEnabled_;
+        std::vector<double> voltageThreshold_;
+        std::vector<double> currentThreshold_;
+        std::vector<double> direction_;
+        std::array<std::vector<double>, 3> reachSquared_;
+        std::array<std::vector<double>, 3> cosSigned_;
+        std::array<std::vector<int64_t>, 3> delayNs_;
+        std::array<std::vector<int64_t>, 3> zoneStartNs_;
+        std::vector<uint8_t> differentialEnabled_;
+        std::vector<double> slopeSquared_;
+        std::vector<double> minOperatingSquared_;
+        std::vector<double> minRestraintSquared_;
+        std::vector<double> instantaneousSquared_;
+        std::vector<double> impedanceSquared_;
+        std::vector<double> operatingSquared_;
+        std::vector<uint8_t> trips_;
+        std::vector<uint8_t> previousTrips_;
+    };
+}
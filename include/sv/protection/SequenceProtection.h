@@ -0,0 +1,203 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "sv/core/rcu.h"
+#include "sv/protection/TripEvents.h"
+#include "sv/protection/SymmetricalComponents.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Definite-time sequence element settings \struct SequenceElementSettings
+    struct SequenceElementSettings
+    {
+        double pickupA{0.5};
+        std::chrono::microseconds delay{0};
+        bool enabled{true};
+
+        /**
+         * @brief Validates the element settings
+         * @return true if settings are valid
+         */
+        constexpr bool isValid() const noexcept
+        {
+            return pickupA > 0.0 && delay.count() >= 0;
+        }
+    };
+
+    /// @brief Sequence Protection Settings structure \struct SequenceProtectionSettings
+    struct SequenceProtectionSettings
+    {
+        SequenceElementSettings negativeSequence{0.5, std::chrono::milliseconds(500), true};
+        SequenceElementSettings earthFault{0.5, std::chrono::milliseconds(100), true};
+        double minNegativeToPositiveRatio{0.0};
+
+        /**
+         * @brief Validates the sequence protection settings
+         * @return true if settings are valid
+         */
+        constexpr bool isValid() const noexcept
+        {
+            return negativeSequence.isValid() && earthFault.isValid() &&
+                   minNegativeToPositiveRatio >= 0.0 && minNegativeToPositiveRatio <= 1.0;
+        }
+    };
+
+    /// @brief Sequence Protection Result structure \struct SequenceProtectionResult
+    struct SequenceProtectionResult
+    {
+        bool negativeSequenceTrip{false};
+        bool earthFaultTrip{false};
+        double negativeSequenceA{0.0};
+        double residualA{0.0};
+        std::chrono::nanoseconds sampleTime{0};
+        std::chrono::steady_clock::time_point tripTime;
+    };
+
+    /**
+     * @brief Negative-sequence overcurrent (46) and zero-sequence earth-fault (50N/51N) elements \class SequenceProtection
+     *
+     * The negative-sequence element operates on |I2|, optionally supervised by a minimum I2/I1
+     * ratio; the earth-fault element operates on the residual current 3|I0|. Both are definite-time
+     * and are evaluated from a ThreePhaseMeasurement without allocating.
+     */
+    class SequenceProtection
+    {
+    public:
+        using Ptr = std::shared_ptr<SequenceProtection>;
+
+        /**
+         * @brief Creates a new SequenceProtection instance
+         * @param settings The sequence protection settings
+         * @return A shared pointer to the created SequenceProtection
+         */
+        [[nodiscard]] static Ptr create(const SequenceProtectionSettings& settings = SequenceProtectionSettings());
+
+        /**
+         * @brief Destructor
+         */
+        ~SequenceProtection() = default;
+
+        SequenceProtection(const SequenceProtection&) = delete;
+        SequenceProtection& operator=(const SequenceProtection&) = delete;
+        SequenceProtection(SequenceProtection&&) noexcept = delete;
+        SequenceProtection& operator=(SequenceProtection&&) noexcept = delete;
+
+        /**
+         * @brief Evaluates both elements on the latest measurement
+         * @param measurement The three-phase measurement
+         * @return A SequenceProtectionResult with trip information
+         */
+        [[nodiscard]] SequenceProtectionResult update(const ThreePhaseMeasurement& measurement);
+
+        /**
+         * @brief Evaluates both elements with the element timers running on sample time
+         * @param measurement The three-phase measurement
+         * @param sampleTime The time of the sample on a monotonic time base, e.g. from a SampleClock
+         * @return A SequenceProtectionResult with trip information
+         */
+        [[nodiscard]] SequenceProtectionResult update(const ThreePhaseMeasurement& measurement, std::chrono::nanoseconds sampleTime);
+
+        /**
+         * @brief Resets the element timers
+         */
+        void reset();
+
+        /**
+         * @brief Sets the sequence protection settings
+         * @param settings The new sequence protection settings
+         */
+        void setSettings(const SequenceProtectionSettings& settings);
+
+        /**
+         * @brief Gets the current sequence protection settings
+         * @return The sequence protection settings
+         */
+        [[nodiscard]] SequenceProtectionSettings getSettings() const;
+
+        /**
+         * @brief Sets whether the protection is enabled
+         * @param enabled true to enable, false to disable
+         */
+        void setEnabled(bool enabled) noexcept;
+
+        /**
+         * @brief Checks if the protection is enabled
+         * @return true if enabled, false otherwise
+         */
+        [[nodiscard]] bool isEnabled() const noexcept;
+
+        /**
+         * @brief Registers a callback for trip events
+         *
+         * The callback runs inline on the evaluating thread, under a lock, before update() returns.
+         * @param callback The callback function to register
+         * @deprecated Use setTripDispatcher() and subscribe to the TripEventDispatcher, so slow
+         * trip handling does not delay the next evaluation.
+         */
+        void onTrip(std::function<void(const SequenceProtectionResult&)> callback);
+
+        /**
+         * @brief Routes trip events to a dispatcher in addition to the onTrip callback
+         *
+         * One event with the combined trip flags is published when the trip state rises from
+         * clear to set; a standing fault publishes nothing further until it clears.
+         * Must not be called while the element is being evaluated.
+         * @param dispatcher The dispatcher, or nullptr to detach
+         * @param elementId Identifier copied into every TripEvent
+         */
+        void setTripDispatcher(TripEventDispatcher::Ptr dispatcher, uint32_t elementId = 0);
+
+    private:
+        /// @brief Pickup timer state of one element \struct ElementTimer
+        struct ElementTimer
+        {
+            bool active{false};
+            std::chrono::nanoseconds startTime{0};
+        };
+
+        /**
+         * @brief Constructor is private.
+         * @param settings The sequence protection settings
+         */
+        explicit SequenceProtection(const SequenceProtectionSettings& settings);
+
+        /**
+         * @brief Runs the definite-time logic of one element.
+         * @param element The element settings
+         * @param pickedUp Whether the operating quantity is above pickup
+         * @param timer The element timer
+         * @param now The sample time being evaluated
+         * @return true if the element operates
+         */
+        [[nodiscard]] static bool evaluate(const SequenceElementSettings& element, bool pickedUp, ElementTimer& timer,
+                                           std::chrono::nanoseconds now) noexcept;
+
+        /**
+         * @brief Tracks the trip state of one evaluation: publishes a TripEvent with the combined
+         * flags only when the state rises from clear to set, and invokes the registered callback
+         * for every tripping result. Called once per evaluation, tripping or not.
+         * @param result The sequence protection result
+         */
+        void invokeCallBack(const SequenceProtectionResult& result);
+
+        RcuCell<SequenceProtectionSettings> settings_;
+
+        std::atomic<bool> enabled_{true};
+        ElementTimer negativeSequenceTimer_;
+        ElementTimer earthFaultTimer_;
+
+        std::function<void(const SequenceProtectionResult&)> callback_;
+        std::mutex callbackMutex_;
+        std::atomic<bool> hasCallback_{false};
+        bool tripped_{false};
+
+        TripEventDispatcher::Ptr dispatcher_;
+        std::atomic<TripEventDispatcher*> dispatcherRaw_{nullptr};
+        uint32_t elementId_{0};
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <array>
+#include <complex>
+#include <numbers>
+#include <span>
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    class PhasorEstimator;
+    class PhasorKernel;
+
+    /// @brief Zero, positive and negative sequence phasors of a three-phase quantity \struct SequenceComponents
+    struct SequenceComponents
+    {
+        std::complex<double> zero;
+        std::complex<double> positive;
+        std::complex<double> negative;
+
+        /**
+         * @brief Computes the Fortescue decomposition of three phase phasors
+         * @param a Phase A phasor
+         * @param b Phase B phasor
+         * @param c Phase C phasor
+         * @return The sequence components
+         */
+        [[nodiscard]] static SequenceComponents fromPhases(const std::complex<double> a, const std::complex<double> b,
+                                                           const std::complex<double> c) noexcept
+        {
+            // Rotation operator a = 1 at 120 degrees
+            const std::complex<double> op(-0.5, std::numbers::sqrt3 / 2.0);
+            const std::complex<double> op2 = std::conj(op);
+
+            SequenceComponents result;
+            result.zero = (a + b + c) / 3.0;
+            result.positive = (a + op * b + op2 * c) / 3.0;
+            result.negative = (a + op2 * b + op * c) / 3.0;
+            return result;
+        }
+
+        /**
+         * @brief Gets the residual quantity 3 * X0
+         * @return The residual magnitude
+         */
+        [[nodiscard]] double residual() const noexcept
+        {
+            return 3.0 * std::abs(zero);
+        }
+    };
+
+    /**
+     * @brief Three-phase measurement block computing sequence components from phasors \class ThreePhaseMeasurement
+     *
+     * Takes the per-sample phasor output of a PhasorEstimator or PhasorKernel and keeps the
+     * current and voltage sequence components. Updating is O(1) and never allocates.
+     */
+    class ThreePhaseMeasurement
+    {
+    public:
+        /**
+         * @brief Updates from phase phasors
+         * @param currents Phase A, B, C current phasors in amperes
+         * @param voltages Phase A, B, C voltage phasors in volts
+         */
+        void update(std::span<const std::complex<double>, 3> currents, std::span<const std::complex<double>, 3> voltages) noexcept;
+
+        /**
+         * @brief Updates from the current output of a phasor estimator
+         * @param estimator The estimator
+         */
+        void update(const PhasorEstimator& estimator) noexcept;
+
+        /**
+         * @brief Updates from the current output of a phasor kernel
+         * @param kernel The kernel
+         */
+        void update(const PhasorKernel& kernel) noexcept;
+
+        /**
+         * @brief Gets a phase current phasor
+         * @param phase The phase index (0 = A, 1 = B, 2 = C)
+         * @return The phasor in amperes
+         */
+        [[nodiscard]] std::complex<double> getPhaseCurrent(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets a phase voltage phasor
+         * @param phase The phase index (0 = A, 1 = B, 2 = C)
+         * @return The phasor in volts
+         */
+        [[nodiscard]] std::complex<double> getPhaseVoltage(size_t phase) const noexcept;
+
+        /**
+         * @brief Gets the current sequence components
+         * @return The current SequenceComponents
+         */
+        [[nodiscard]] const SequenceComponents& getCurrentSequence() const noexcept;
+
+        /**
+         * @brief Gets the voltage sequence components
+         * @return The voltage SequenceComponents
+         */
+        [[nodiscard]] const SequenceComponents& getVoltageSequence() const noexcept;
+
+    private:
+        std::array<std::complex<double>, 3> currents_{};
+        std::array<std::complex<double>, 3> voltages_{};
+        SequenceComponents currentSequence_{};
+        SequenceComponents voltageSequence_{};
+    };
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "sv/core/latency.h"
+#include "sv/core/ring.h"
+
+/// @brief sv namespace \namespace sv
+namespace sv
+{
+    /// @brief Protection element that raised a trip \enum TripSource
+    enum class TripSource : uint8_t
+    {
+        DISTANCE,
+        DIFFERENTIAL,
+        SEQUENCE,
+        MULTI_LOOP_DISTANCE
+    };
+
+    /// @brief Convert TripSource to string
+    inline const char* toString(const TripSource source)
+    {
+        switch (source)
+        {
+            case TripSource::DISTANCE: return "DISTANCE";
+            case TripSource::DIFFERENTIAL: return "DIFFERENTIAL";
+            case TripSource::SEQUENCE: return "SEQUENCE";
+            case TripSource::MULTI_LOOP_DISTANCE: return "MULTI_LOOP_DISTANCE";
+            default: return "UNKNOWN";
+        }
+    }
+
+    /**
+     * @brief Fixed-size trip record passed from a protection element to the dispatcher. \struct TripEvent
+     *
+     * The meaning of the element-specific fields per source:
+     * - DISTANCE: flags FLAG_ZONE1..3, value = |Z| in ohm, secondary = angle in rad
+     * - DIFFERENTIAL: flags FLAG_INSTANTANEOUS, value = operating A, secondary = restraint A
+     * - SEQUENCE: flags FLAG_NEGATIVE_SEQUENCE and FLAG_EARTH_FAULT, value = |I2| A, secondary = 3|I0| A
+     * - MULTI_LOOP_DISTANCE: flags FLAG_ZONE1..3, loop = faulted FaultLoop, value/secondary = R/X in ohm
+     */
+    struct TripEvent
+    {
+        /// @brief flags bits of DISTANCE and MULTI_LOOP_DISTANCE events
+        static constexpr uint8_t FLAG_ZONE1 = 1u << 0;
+        static constexpr uint8_t FLAG_ZONE2 = 1u << 1;
+        static constexpr uint8_t FLAG_ZONE3 = 1u << 2;
+
+        /// @brief flags bit of DIFFERENTIAL events
+        static constexpr uint8_t FLAG_INSTANTANEOUS = 1u << 0;
+
+        /// @brief flags bits of SEQUENCE events
+        static constexpr uint8_t FLAG_NEGATIVE_SEQUENCE = 1u << 0;
+        static constexpr uint8_t FLAG_EARTH_FAULT = 1u << 1;
+
+        uint64_t sequence{0};
+        int64_t originNs{0};    ///< PipelineLatency origin of the frame that led to the trip, 0 if unknown
+        int64_t decisionNs{0};
+        int64_t enqueueNs{0};
+        double value{0.0};
+        double secondary{0.0};
+        uint32_t elementId{0};
+        TripSource source{TripSource::DISTANCE};
+        uint8_t flags{0};
+        uint8_t loop{0};
+
+        /**
+         * @brief Converts a steady_clock time point to the decision timestamp format.
+         * @param time The time point
+         * @return Nanoseconds since the steady_clock epoch
+         */
+        [[nodiscard]] static int64_t toNs(const std::chrono::steady_clock::time_point time) noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+        }
+    };
+
+    /**
+     * @brief Lock-free trip event queue with a dispatcher thread. \class TripEventDispatcher
+     *
+     * Protection elements publish() fixed-size TripEvent records from their evaluation thread:
+     * one slot claim in a bounded LockFreeRing, no lock and no allocation. A dispatcher thread
+     * drains the ring and fans the events out to the subscribers, so slow subscribers (console
+     * output, breaker commands) never delay the next evaluation. The time from trip decision to
+     * enqueue and from enqueue to delivery is recorded in two latency histograms, and events
+     * carrying a frame origin add the frame-to-trip time to PipelineStage::TRIP once the
+     * subscribers have run. When the ring is full the event is dropped and counted.
+     */
+    class TripEventDispatcher
+    {
+    public:
+        using Ptr = std::shared_ptr<TripEventDispatcher>;
+        using Subscriber = std::function<void(const TripEvent&)>;
+
+        /**
+         * @brief Creates a new dispatcher. The dispatcher thread is not started.
+         * @param capacity Queue capacity, rounded up to a power of two
+         * @return A shared pointer to the created dispatcher
+         * @throws std::invalid_argument if capacity is zero
+         */
+        [[nodiscard]] static Ptr create(size_t capacity = 1024);
+
+        /**
+         * @brief Destructor. Stops the dispatcher thread.
+         */
+        ~TripEventDispatcher();
+
+        TripEventDispatcher(const TripEventDispatcher&) = delete;
+        TripEventDispatcher& operator=(const TripEventDispatcher&) = delete;
+        TripEventDispatcher(TripEventDispatcher&&) noexcept = delete;
+        TripEventDispatcher& operator=(TripEventDispatcher&&) noexcept = delete;
+
+        /**
+         * @brief Enqueues a trip event. Lock-free and allocation-free; safe from any thread.
+         * @param event The event; sequence and enqueueNs are filled in
+         * @return false if the queue was full and the event was dropped
+         */
+        bool publish(TripEvent event) noexcept;
+
+        /**
+         * @brief Adds a subscriber invoked on the dispatcher thread for every event.
+         * @param subscriber The subscriber
+         */
+        void subscribe(Subscriber subscriber);
+
+        /**
+         * @brief Starts the dispatcher thread.
+         */
+        void start();
+
+        /**
+         * @brief Delivers the remaining events and stops the dispatcher thread.
+         */
+        void stop();
+
+        /**
+         * @brief Checks if the dispatcher thread is running.
+         * @return true if running
+         */
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        /**
+         * @brief Delivers all queued events on the calling thread.
+         * @return The number of events delivered
+         */
+        size_t drain();
+
+        /**
+         * @brief Getter for the decision-to-enqueue latency histogram.
+         * @return The histogram
+         */
+        [[nodiscard]] const LatencyHistogram& getEnqueueLatency() const noexcept;
+
+        /**
+         * @brief Getter for the enqueue-to-delivery latency histogram.
+         * @return The histogram
+         */
+        [[nodiscard]] const LatencyHistogram& getDispatchLatency() const noexcept;
+
+        /**
+         * @brief Getter for the number of published events.
+         * @return The count
+         */
+        [[nodiscard]] uint64_t getPublished() const noexcept;
+
+        /**
+         * @brief Getter for the number of events dropped on a full queue.
+         * @return The count
+         */
+        [[nodiscard]] uint64_t getDropped() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private.
+         * @param capacity Queue capacity
+         */
+        explicit TripEventDispatcher(size_t capacity);
+
+        /**
+         * @brief Dispatcher thread body.
+         */
+        void run();
+
+        LockFreeRing<TripEvent> queue_;
+        LatencyHistogram enqueueLatency_;
+        LatencyHistogram dispatchLatency_;
+
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> sequence_{0};
+        std::atomic<uint64_t> dropped_{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> pending_{0};
+
+        std::vector<Subscriber> subscribers_;
+        std::mutex subscribersMutex_;
+
+        std::atomic<bool> running_{false};
+        std::thread thread_;
+    };
+}
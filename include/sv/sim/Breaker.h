@@ -3,14 +3,18 @@
 #include <memory>
 #include <functional>
 #include <atomic>
-#include <thread>
 #include <chrono>
 #include <mutex>
+#include <cstdint>
 #include <limits>
+#include <string>
+#include <vector>
 
 /// @brief sv namespace \namespace sv::sim
 namespace sv::sim
 {
+    class BreakerScheduler;
+
     /// @brief Breaker State Enumeration \enum BreakerState
     enum class BreakerState
     {
@@ -37,6 +41,18 @@ namespace sv::sim
         }
     }
 
+    /**
+     * @brief Time base of a breaker model \enum BreakerClock
+     *
+     * A REAL_TIME breaker is driven by the shared real-time BreakerScheduler, a SIMULATED breaker
+     * is passive and advances only through step() or a BreakerScheduler it is attached to.
+     */
+    enum class BreakerClock
+    {
+        REAL_TIME,
+        SIMULATED
+    };
+
     /// @brief Breaker physical characteristics and ratings \struct BreakerDefinition
     struct BreakerDefinition
     {
@@ -63,15 +79,77 @@ namespace sv::sim
         }
     };
 
-    /// @brief Simulation scenario results \struct SimulationResult
+    /// @brief Breaker state entered at a simulation step \struct StateTransition
+    struct StateTransition
+    {
+        uint64_t step{0};
+        double time{0.0};
+        BreakerState state{BreakerState::OPEN};
+
+        bool operator==(const StateTransition&) const = default;
+    };
+
+    /**
+     * @brief Simulation scenario results \struct SimulationResult
+     *
+     * Time and current are stored per step in storage reserved up front. The breaker state is run
+     * length encoded: stateTransitions holds the first step and every step where the state changed.
+     */
     struct SimulationResult
     {
         std::vector<double> timePoints;
         std::vector<double> currentValues;
-        std::vector<BreakerState> stateHistory;
+        std::vector<StateTransition> stateTransitions;
         bool tripOccurred{false};
         double tripTime{0.0};
         std::string summary;
+
+        /**
+         * @brief Reserves storage for a number of steps
+         * @param steps The expected number of steps
+         */
+        void reserve(size_t steps);
+
+        /**
+         * @brief Appends one step, recording the state only when it changed
+         * @param time The step time in seconds
+         * @param current The current in Amperes
+         * @param state The breaker state
+         */
+        void append(double time, double current, BreakerState state);
+
+        /**
+         * @brief Gets the number of recorded steps
+         * @return The step count
+         */
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @brief Gets the breaker state at a step
+         * @param step The step index
+         * @return The state
+         * @throws std::out_of_range if step is not recorded
+         */
+        [[nodiscard]] BreakerState stateAt(size_t step) const;
+
+        /**
+         * @brief Writes the result to a binary file through a shared memory mapping
+         *
+         * Layout, native endian: the magic "SVBRKR01", uint64 steps, uint64 transitions, uint64
+         * tripOccurred, float64 tripTime, then float64 timePoints[steps], float64
+         * currentValues[steps] and per transition uint64 step, float64 time, uint64 state.
+         * @param path The output file
+         * @throws std::runtime_error if the file cannot be created or mapped
+         */
+        void exportBinary(const std::string& path) const;
+
+        /**
+         * @brief Reads a file written by exportBinary through a read-only mapping
+         * @param path The input file
+         * @return The result without summary
+         * @throws std::runtime_error if the file is missing or malformed
+         */
+        [[nodiscard]] static SimulationResult importBinary(const std::string& path);
     };
 
     /// @brief Breaker state change callback
@@ -84,20 +162,33 @@ namespace sv::sim
         using BreakerPtr = std::shared_ptr<BreakerModel>;
 
         /**
-         * @brief Creates a new BreakerModel with default definition
+         * @brief Creates a new passive BreakerModel with default definition
          * @return Shared pointer to BreakerModel
          */
         static BreakerPtr create();
 
         /**
-         * @brief Creates a new BreakerModel with custom definition
+         * @brief Creates a new passive BreakerModel with custom definition
          * @param definition BreakerDefinition struct
          * @return Shared pointer to BreakerModel
          */
         static BreakerPtr create(const BreakerDefinition& definition);
 
         /**
-         * @brief Destructor - stops simulation thread
+         * @brief Creates a new BreakerModel on the given time base
+         *
+         * A REAL_TIME breaker is attached to the shared real-time scheduler. A SIMULATED breaker
+         * starts passive: transitions, arc decay and runSimulation() advance only through step(), so
+         * results are bit-identical between runs and independent of wall time.
+         * @param definition BreakerDefinition struct
+         * @param clock The time base
+         * @return Shared pointer to BreakerModel
+         * @throws std::invalid_argument if the definition is invalid
+         */
+        static BreakerPtr create(const BreakerDefinition& definition, BreakerClock clock);
+
+        /**
+         * @brief Destructor - detaches the breaker from its scheduler
          */
         ~BreakerModel();
 
@@ -185,17 +276,47 @@ namespace sv::sim
         void onStateChange(BreakerCallback callback);
 
         /**
-         * @brief Starts the breaker simulation thread
+         * @brief Advances a passive breaker by a time step
+         * @param dt The simulated time step
+         * @throws std::logic_error if the breaker is driven by a scheduler
+         * @throws std::invalid_argument if dt is negative
+         */
+        void step(std::chrono::nanoseconds dt);
+
+        /**
+         * @brief Gets the time of the breaker clock
+         * @return The time of its scheduler, or the own simulated time of a passive breaker
+         */
+        [[nodiscard]] std::chrono::nanoseconds getTime() const;
+
+        /**
+         * @brief Gets the time base of the breaker
+         * @return The clock
+         */
+        [[nodiscard]] BreakerClock getClock() const;
+
+        /**
+         * @brief Checks whether a scheduler drives the breaker
+         * @return true if attached to a BreakerScheduler
+         */
+        [[nodiscard]] bool isScheduled() const;
+
+        /**
+         * @brief Attaches the breaker to the shared real-time scheduler
+         * @throws std::logic_error if the breaker is in transition
          */
         void startSimulation();
 
         /**
-         * @brief Stops the breaker simulation thread
+         * @brief Detaches the breaker from its scheduler, leaving it passive
          */
         void stopSimulation();
 
         /**
          * @brief Runs a automatic simulation of the Breaker.
+         *
+         * A passive breaker steps through the scenario without sleeping and records the outcome in
+         * SimulationResult::summary; a breaker driven by a scheduler runs it in wall time.
          * @param voltageV The voltage across the breaker in Volts.
          * @param nominalCurrentA The nominal current through the breaker in Amperes.
          * @param faultCurrentA The fault current through the breaker in Amperes.
@@ -215,16 +336,14 @@ namespace sv::sim
 
     private:
 
-        /**
-         * @brief Private constructor to enforce use of factory methods
-         */
-        BreakerModel();
-
         /**
          * @brief Private constructor with definition
          * @param definition BreakerDefinition struct
+         * @param clock The time base
          */
-        explicit BreakerModel(const BreakerDefinition& definition);
+        BreakerModel(const BreakerDefinition& definition, BreakerClock clock);
+
+        friend class BreakerScheduler;
 
         /// @brief Deleted copy/move constructors and assignment operators
         BreakerModel(const BreakerModel&) = delete;
@@ -232,11 +351,6 @@ namespace sv::sim
         BreakerModel(BreakerModel&&) noexcept = delete;
         BreakerModel& operator=(BreakerModel&&) noexcept = delete;
 
-        /**
-         * @brief Main simulation loop that updates breaker state over time
-         */
-        void simulationLoop();
-
         /**
          * @brief Transitions the breaker to a new state and starts timing the transition
          */
@@ -244,23 +358,46 @@ namespace sv::sim
 
         /**
          * @brief Updates the breaker state based on elapsed time and current conditions
+         * @param dt The time since the previous update
+         */
+        void updateState(std::chrono::nanoseconds dt);
+
+        /**
+         * @brief Updates the breaker state up to the current time of its clock
          */
-        void updateState();
+        void advance();
+
+        /**
+         * @brief Starts timing a commanded transition and tells the scheduler when it is due
+         * @param target The end state of the transition
+         * @param durationSec The transition time in seconds
+         */
+        void beginTransition(BreakerState target, double durationSec);
+
+        /**
+         * @brief Gets the time the breaker next needs an update
+         * @param tick The resolution of the caller
+         * @return The due time, or a negative duration when idle
+         */
+        [[nodiscard]] std::chrono::nanoseconds nextUpdateTime(std::chrono::nanoseconds tick) const;
 
         std::atomic<BreakerState> state_{BreakerState::OPEN};
         std::atomic<bool> locked_{false};
         std::atomic<double> currentA_{0.0};
 
-        std::chrono::steady_clock::time_point transitionStartTime_;
-        double transitionDuration_{0.0};
+        BreakerClock clock_{BreakerClock::REAL_TIME};
+        std::atomic<int64_t> simulatedTimeNs_{0};
+
+        std::atomic<BreakerScheduler*> scheduler_{nullptr};
+        std::chrono::nanoseconds lastUpdateTime_{0};
+
+        std::chrono::nanoseconds transitionStartTime_{0};
+        std::chrono::nanoseconds transitionDuration_{0};
         BreakerState targetState_{BreakerState::OPEN};
 
         BreakerDefinition definition_;
         mutable std::mutex definitionMutex_;
 
-        std::atomic<bool> running_{false};
-        std::thread simulationThread_;
-
         BreakerCallback callback_;
         std::mutex callbackMutex_;
     };
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "sv/sim/Breaker.h"
+
+/// @brief sv namespace \namespace sv::sim
+namespace sv::sim
+{
+    /**
+     * @brief Shared clock and timer wheel that drives many breaker models. \class BreakerScheduler
+     *
+     * Attached breakers read their time from the scheduler. A commanded transition registers the
+     * breaker in a hashed timer wheel at the tick its transition completes; an opening breaker that
+     * still carries arc current is updated every tick until then. Idle breakers cost nothing, so one
+     * scheduler handles hundreds of breakers.
+     *
+     * The clock is advanced either explicitly with advance(), as a shared simulation clock, or by a
+     * single thread against the steady clock after start(). BreakerScheduler::shared() is the
+     * real-time scheduler behind BreakerClock::REAL_TIME breakers.
+     */
+    class BreakerScheduler
+    {
+    public:
+        using Ptr = std::shared_ptr<BreakerScheduler>;
+
+        /// @brief Default wheel resolution.
+        static constexpr std::chrono::nanoseconds DEFAULT_TICK = std::chrono::milliseconds(1);
+
+        /// @brief Default number of wheel slots.
+        static constexpr size_t DEFAULT_SLOTS = 256;
+
+        /**
+         * @brief Creates a new BreakerScheduler at time zero, not running
+         * @param tick The wheel resolution
+         * @param slots The number of wheel slots
+         * @return A shared pointer to the created BreakerScheduler
+         * @throws std::invalid_argument if tick or slots is zero
+         */
+        [[nodiscard]] static Ptr create(std::chrono::nanoseconds tick = DEFAULT_TICK, size_t slots = DEFAULT_SLOTS);
+
+        /**
+         * @brief Gets the process-wide real-time scheduler, starting it on first use
+         * @return The shared scheduler
+         */
+        [[nodiscard]] static BreakerScheduler& shared();
+
+        /**
+         * @brief Destructor - stops the thread and detaches all breakers
+         */
+        ~BreakerScheduler();
+
+        BreakerScheduler(const BreakerScheduler&) = delete;
+        BreakerScheduler& operator=(const BreakerScheduler&) = delete;
+
+        /**
+         * @brief Lets the scheduler drive a breaker
+         * @param breaker The breaker
+         * @throws std::logic_error if the breaker is in transition or driven by another scheduler
+         */
+        void attach(const BreakerModel::BreakerPtr& breaker);
+
+        /**
+         * @brief Stops driving a breaker; it continues passive from the current time
+         * @param breaker The breaker
+         */
+        void detach(const BreakerModel::BreakerPtr& breaker);
+
+        /**
+         * @brief Advances the simulation clock and updates every breaker that becomes due
+         * @param dt The time step
+         * @throws std::logic_error while the scheduler thread is running
+         * @throws std::invalid_argument if dt is negative
+         */
+        void advance(std::chrono::nanoseconds dt);
+
+        /**
+         * @brief Starts the scheduler thread, which follows the steady clock from the current time
+         */
+        void start();
+
+        /**
+         * @brief Stops the scheduler thread
+         */
+        void stop();
+
+        /**
+         * @brief Checks if the scheduler thread is running
+         * @return true if running
+         */
+        [[nodiscard]] bool isRunning() const noexcept;
+
+        /**
+         * @brief Gets the scheduler time
+         * @return The time since creation on the scheduler clock
+         */
+        [[nodiscard]] std::chrono::nanoseconds now() const noexcept;
+
+        /**
+         * @brief Gets the wheel resolution
+         * @return The tick
+         */
+        [[nodiscard]] std::chrono::nanoseconds getTick() const noexcept;
+
+        /**
+         * @brief Gets the number of attached breakers
+         * @return The breaker count
+         */
+        [[nodiscard]] size_t getBreakerCount() const;
+
+        /**
+         * @brief Gets the number of breakers waiting for a timer
+         * @return The pending count
+         */
+        [[nodiscard]] size_t getPendingCount() const;
+
+    private:
+        friend class BreakerModel;
+
+        /// @brief Wheel entry; stale when the breaker has been rescheduled or detached
+        struct TimerEntry
+        {
+            BreakerModel* breaker;
+            uint64_t dueTick;
+        };
+
+        /**
+         * @brief Constructor is private.
+         * @param tick The wheel resolution
+         * @param slots The number of wheel slots
+         */
+        BreakerScheduler(std::chrono::nanoseconds tick, size_t slots);
+
+        /**
+         * @brief Attaches a breaker by reference.
+         * @param breaker The breaker
+         */
+        void attachModel(BreakerModel& breaker);
+
+        /**
+         * @brief Detaches a breaker by reference.
+         * @param breaker The breaker
+         */
+        void detachModel(BreakerModel& breaker);
+
+        /**
+         * @brief Places a breaker on the wheel at its next update time, or removes it when idle.
+         * @param breaker The breaker
+         */
+        void schedule(BreakerModel& breaker);
+
+        /**
+         * @brief Advances the clock to a target time tick by tick.
+         * @param target The target time
+         */
+        void advanceTo(std::chrono::nanoseconds target);
+
+        /**
+         * @brief Updates the breakers that are due on a tick.
+         * @param tick The tick index
+         */
+        void processTick(uint64_t tick);
+
+        /**
+         * @brief Scheduler thread loop.
+         */
+        void run();
+
+        std::chrono::nanoseconds tick_;
+        std::vector<std::vector<TimerEntry>> wheel_;
+        std::unordered_map<BreakerModel*, uint64_t> breakers_;
+        uint64_t currentTick_{0};
+        size_t pending_{0};
+        std::atomic<int64_t> nowNs_{0};
+
+        std::chrono::steady_clock::time_point origin_;
+        std::atomic<bool> running_{false};
+        std::thread thread_;
+        mutable std::recursive_mutex mutex_;
+        std::condition_variable_any wakeup_;
+    };
+}
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "sv/core/sampleclock.h"
+#include "sv/core/types.h"
+#include "sv/core/workpool.h"
+#include "sv/sim/Breaker.h"
+
+namespace sv
+{
+    class IedServer;
+    class SampledValueControlBlock;
+}
+
+/// @brief sv namespace \namespace sv::sim
+namespace sv::sim
+{
+    /// @brief Shunt fault type on the feeder \enum FaultType
+    enum class FaultType
+    {
+        NONE,
+        A_GROUND,
+        B_C,
+        B_C_GROUND,
+        THREE_PHASE
+    };
+
+    /// @brief Convert FaultType to string
+    inline const char* toString(const FaultType type)
+    {
+        switch (type)
+        {
+            case FaultType::NONE: return "NONE";
+            case FaultType::A_GROUND: return "A_GROUND";
+            case FaultType::B_C: return "B_C";
+            case FaultType::B_C_GROUND: return "B_C_GROUND";
+            case FaultType::THREE_PHASE: return "THREE_PHASE";
+            default: return "UNKNOWN";
+        }
+    }
+
+    /// @brief Fault applied at a point of the line \struct FaultDefinition
+    struct FaultDefinition
+    {
+        FaultType type{FaultType::NONE};
+        double location{0.5};
+        double resistanceOhm{0.0};
+        double inceptionS{0.1};
+
+        /// @brief Validates the fault definition
+        [[nodiscard]] bool isValid() const
+        {
+            return location >= 0.0 && location <= 1.0 && resistanceOhm >= 0.0 && inceptionS >= 0.0;
+        }
+    };
+
+    /**
+     * @brief Radial source, line and load with a breaker at the sending end \struct FeederDefinition
+     *
+     * Impedances are per phase; the zero sequence ones decide the earth fault current. The fault
+     * location is the fraction of the line between the breaker and the fault.
+     */
+    struct FeederDefinition
+    {
+        double sourceVoltageV{11000.0};
+        std::complex<double> sourceImpedanceOhm{0.2, 2.0};
+        std::complex<double> sourceZeroImpedanceOhm{0.4, 4.0};
+        std::complex<double> lineImpedanceOhmPerKm{0.1, 0.4};
+        std::complex<double> lineZeroImpedanceOhmPerKm{0.3, 1.2};
+        double lineLengthKm{20.0};
+        std::complex<double> loadImpedanceOhm{40.0, 10.0};
+        BreakerDefinition breaker{.maxCurrentA = 40000.0};
+        FaultDefinition fault;
+
+        /// @brief Validates the feeder definition
+        [[nodiscard]] bool isValid() const
+        {
+            return sourceVoltageV > 0.0 && sourceImpedanceOhm.real() > 0.0 &&
+                   sourceZeroImpedanceOhm.real() > 0.0 && lineImpedanceOhmPerKm.real() >= 0.0 &&
+                   lineZeroImpedanceOhmPerKm.real() >= 0.0 && lineLengthKm > 0.0 &&
+                   std::abs(loadImpedanceOhm) > 0.0 && breaker.isValid() && fault.isValid();
+        }
+    };
+
+    /// @brief Instantaneous measurements of one sample in dataset order \struct FeederSample
+    struct FeederSample
+    {
+        std::chrono::nanoseconds time{0};
+        uint64_t index{0};
+        std::array<double, 4> currentsA{};
+        std::array<double, 4> voltagesV{};
+    };
+
+    /**
+     * @brief Sampled value source for a source-line-breaker-fault network. \class FeederSimulator
+     *
+     * The feeder is solved with symmetrical components whenever the network changes: load flow
+     * before the fault, superposed fault current after it. Samples are taken at the sending end,
+     * with the voltage transformer on the line side of the breaker, in the SV dataset order
+     * Ia, Ib, Ic, In, Va, Vb, Vc, Vn. Fault inception adds the decaying DC offset that keeps the
+     * current continuous.
+     *
+     * The feeder owns a passive BreakerModel stepped by one sample period per sample. While it is
+     * opening the currents follow its decaying arc current and the line voltage drops by its arc
+     * voltage; open or closing, the line is dead. Protection under test trips the breaker through
+     * getBreaker(). Time is sample time, so a feeder generates as fast as it computes.
+     */
+    class FeederSimulator
+    {
+    public:
+        using Ptr = std::shared_ptr<FeederSimulator>;
+
+        /**
+         * @brief Creates a new FeederSimulator
+         * @param definition The feeder definition
+         * @param samplesPerPeriod The samples per nominal cycle
+         * @param frequency The nominal frequency
+         * @param currentScaling Counts per ampere of the encoded currents
+         * @param voltageScaling Counts per volt of the encoded voltages
+         * @return A shared pointer to the created FeederSimulator
+         * @throws std::invalid_argument if the definition is invalid
+         */
+        [[nodiscard]] static Ptr create(const FeederDefinition& definition,
+                                        SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                                        SignalFrequency frequency = SignalFrequency::FREQ_50_HZ,
+                                        int32_t currentScaling = ScalingFactors::CURRENT_DEFAULT,
+                                        int32_t voltageScaling = ScalingFactors::VOLTAGE_DEFAULT);
+
+        /**
+         * @brief Creates a new FeederSimulator for the rate and scaling of a control block
+         * @param definition The feeder definition
+         * @param svcb The control block the samples are published on
+         * @return A shared pointer to the created FeederSimulator
+         * @throws std::invalid_argument if the definition is invalid
+         */
+        [[nodiscard]] static Ptr create(const FeederDefinition& definition, const SampledValueControlBlock& svcb);
+
+        FeederSimulator(const FeederSimulator&) = delete;
+        FeederSimulator& operator=(const FeederSimulator&) = delete;
+
+        /**
+         * @brief Computes the next sample and steps the breaker by one sample period
+         * @return The sample
+         */
+        const FeederSample& step();
+
+        /**
+         * @brief Generates samples as scaled integers ready to encode
+         * @param out Receives VALUES_PER_ASDU values per sample
+         * @throws std::invalid_argument if the size is not a multiple of VALUES_PER_ASDU
+         */
+        void generate(std::span<int32_t> out);
+
+        /**
+         * @brief Computes the next sample and publishes it
+         * @param server The server
+         * @param svcb The control block
+         */
+        void publish(const IedServer& server, const std::shared_ptr<SampledValueControlBlock>& svcb);
+
+        /**
+         * @brief Converts a sample into the values of an ASDU
+         * @param sample The sample
+         * @param values Receives VALUES_PER_ASDU values
+         */
+        void toAnalogValues(const FeederSample& sample, std::vector<AnalogValue>& values) const;
+
+        /**
+         * @brief Applies a fault from the next sample on, regardless of its inception time
+         * @param fault The fault, type NONE clears it
+         * @throws std::invalid_argument if the fault is invalid
+         */
+        void setFault(const FaultDefinition& fault);
+
+        /**
+         * @brief Getter for the breaker at the sending end
+         * @return The breaker, stepped by the feeder; it must not be attached to a scheduler
+         */
+        [[nodiscard]] const BreakerModel::BreakerPtr& getBreaker() const noexcept;
+
+        /**
+         * @brief Getter for the last sample
+         * @return The sample
+         */
+        [[nodiscard]] const FeederSample& getSample() const noexcept;
+
+        /**
+         * @brief Getter for the fault current phasors of the active fault
+         * @return RMS phasors of Ia, Ib and Ic seen by the breaker, zero without a fault
+         */
+        [[nodiscard]] std::array<std::complex<double>, 3> getFaultCurrents() const noexcept;
+
+        /**
+         * @brief Checks if the active fault is applied
+         * @return true once the fault has started
+         */
+        [[nodiscard]] bool isFaulted() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         */
+        FeederSimulator(const FeederDefinition& definition, SamplesPerPeriod samplesPerPeriod,
+                        SignalFrequency frequency, int32_t currentScaling, int32_t voltageScaling);
+
+        /**
+         * @brief Solves the network phasors for the load and the active fault
+         */
+        void solve();
+
+        /**
+         * @brief Starts the fault and sets the DC offset that keeps the currents continuous
+         * @param rotation The rotation of the sample the fault starts at
+         */
+        void startFault(std::complex<double> rotation);
+
+        FeederDefinition definition_;
+        SampleClock clock_;
+        BreakerModel::BreakerPtr breaker_;
+        double currentScaling_;
+        double voltageScaling_;
+
+        std::vector<std::complex<double>> rotations_;
+        std::array<std::complex<double>, 3> sourceVoltages_{};
+        std::array<std::complex<double>, 3> loadCurrents_{};
+        std::array<std::complex<double>, 3> faultCurrents_{};
+        std::array<std::complex<double>, 3> voltages_{};
+        std::array<std::complex<double>, 3> loadVoltages_{};
+        std::array<double, 3> dcOffsetA_{};
+        double dcDecay_{0.0};
+        double arcStartCurrentA_{0.0};
+        bool arcing_{false};
+        bool faulted_{false};
+        uint64_t next_{0};
+        FeederSample sample_;
+        std::vector<AnalogValue> values_;
+    };
+
+    /**
+     * @brief Generates many feeders in parallel. \class FeederBank
+     *
+     * Each feeder fills its own sample buffer on a work-stealing pool, so a bank of feeders runs
+     * as many times faster than real time as there are cores to spare.
+     */
+    class FeederBank
+    {
+    public:
+        using Ptr = std::shared_ptr<FeederBank>;
+
+        /**
+         * @brief Creates a new FeederBank
+         * @param workers Number of worker threads, 0 for one per hardware thread
+         * @return A shared pointer to the created FeederBank
+         */
+        [[nodiscard]] static Ptr create(size_t workers = 0);
+
+        FeederBank(const FeederBank&) = delete;
+        FeederBank& operator=(const FeederBank&) = delete;
+
+        /**
+         * @brief Adds a feeder
+         * @param feeder The feeder
+         * @return The index of the feeder
+         */
+        size_t add(FeederSimulator::Ptr feeder);
+
+        /**
+         * @brief Generates the next samples of every feeder
+         * @param samples Number of samples per feeder
+         */
+        void generate(size_t samples);
+
+        /**
+         * @brief Getter for the samples of the last generate() call
+         * @param feeder The index of the feeder
+         * @return VALUES_PER_ASDU scaled values per sample
+         */
+        [[nodiscard]] std::span<const int32_t> getSamples(size_t feeder) const;
+
+        /**
+         * @brief Getter for a feeder
+         * @param feeder The index of the feeder
+         * @return The feeder
+         */
+        [[nodiscard]] const FeederSimulator::Ptr& getFeeder(size_t feeder) const;
+
+        /**
+         * @brief Getter for the number of feeders
+         * @return The feeder count
+         */
+        [[nodiscard]] size_t getFeederCount() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private.
+         * @param workers Number of worker threads
+         */
+        explicit FeederBank(size_t workers);
+
+        WorkStealingPool pool_;
+        std::vector<FeederSimulator::Ptr> feeders_;
+        std::vector<std::vector<int32_t>> samples_;
+    };
+}
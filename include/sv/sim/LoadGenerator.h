@@ -0,0 +1,157 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "sv/core/types.h"
+#include "sv/network/Transport.h"
+
+/// @brief sv namespace \namespace sv::sim
+namespace sv::sim
+{
+    /// @brief Options of a load generator run \struct LoadGeneratorOptions
+    struct LoadGeneratorOptions
+    {
+        size_t streams{1};
+        uint32_t sampleRate{4000};
+        uint32_t frequencyHz{50};
+        size_t threads{1};
+        double durationS{10.0};
+        uint64_t spinNs{50'000};
+        uint16_t firstAppId{APP_ID_MIN};
+        std::string svIdPrefix{"MU"};
+
+        /**
+         * @brief Validates the options: a whole number of at least 4 samples per cycle, a rate
+         * smpCnt can count, APPIDs in range and no more threads than streams
+         */
+        [[nodiscard]] bool isValid() const
+        {
+            return streams > 0 && streams <= 0x10000 && threads > 0 && threads <= streams && frequencyHz > 0 &&
+                   sampleRate % frequencyHz == 0 && sampleRate / frequencyHz >= 4 && sampleRate <= 0x10000 &&
+                   durationS > 0.0 && firstAppId >= APP_ID_MIN && firstAppId + streams - 1 <= APP_ID_MAX;
+        }
+    };
+
+    /// @brief Addresses of one emulated merging unit \struct LoadStreamIdentity
+    struct LoadStreamIdentity
+    {
+        std::string svId;
+        uint16_t appId{0};
+        std::array<uint8_t, 6> destinationMac{};
+        std::array<uint8_t, 6> sourceMac{};
+    };
+
+    /// @brief Result of one stream \struct LoadStreamStats
+    struct LoadStreamStats
+    {
+        LoadStreamIdentity identity;
+        uint64_t frames{0};
+        uint64_t failed{0};
+        double framesPerSecond{0.0};
+    };
+
+    /**
+     * @brief Result of one sender thread \struct LoadThreadStats
+     *
+     * A thread hands the frames of all its streams to one batched send per sample, so timing is
+     * measured per thread: lateness is the time from a sample's deadline to the return of that
+     * send and the jitter is its standard deviation.
+     */
+    struct LoadThreadStats
+    {
+        size_t firstStream{0};
+        size_t streams{0};
+        uint64_t batches{0};
+        double meanLatenessNs{0.0};
+        double jitterNs{0.0};
+        uint64_t maxLatenessNs{0};
+        double cpuPercent{0.0};
+    };
+
+    /// @brief Result of a load generator run \struct LoadReport
+    struct LoadReport
+    {
+        std::vector<LoadStreamStats> streams;
+        std::vector<LoadThreadStats> threads;
+        uint64_t frames{0};
+        uint64_t failed{0};
+        double elapsedSeconds{0.0};
+
+        /**
+         * @brief Gets the achieved frame rate of all streams.
+         * @return Frames per second.
+         */
+        [[nodiscard]] double framesPerSecond() const noexcept;
+    };
+
+    /**
+     * @brief Emulates many merging units publishing at a fixed rate. \class LoadGenerator
+     *
+     * Every stream has its own svID, APPID, multicast destination and source MAC and carries a
+     * balanced three-phase dataset from a WaveformGenerator. The streams are split into
+     * contiguous groups, one per thread, each with its own sender. A thread encodes the frames
+     * of the next sample into reused buffers ahead of time, sleeps with clock_nanosleep on an
+     * absolute CLOCK_MONOTONIC deadline until spinNs before it, spins the rest of the way and
+     * hands all frames to NetworkSender::sendRawFrames in one batch. Deadlines are computed
+     * from the start time in integer nanoseconds, so they do not drift.
+     */
+    class LoadGenerator
+    {
+    public:
+        using Ptr = std::shared_ptr<LoadGenerator>;
+
+        /**
+         * @brief Creates a new LoadGenerator
+         * @param transport The transport the streams are published on
+         * @param options The run options
+         * @return A shared pointer to the created LoadGenerator
+         * @throws std::invalid_argument if the transport is null or the options are invalid
+         */
+        [[nodiscard]] static Ptr create(TransportFactory::Ptr transport, const LoadGeneratorOptions& options);
+
+        /**
+         * @brief Gets the addresses of a stream: svID prefix plus a 4 digit number from 1, APPID
+         * firstAppId plus the index, destination 01-0C-CD-04-xx-xx and a locally administered source
+         * @param options The run options
+         * @param stream The stream index
+         * @return The identity
+         */
+        [[nodiscard]] static LoadStreamIdentity getIdentity(const LoadGeneratorOptions& options, size_t stream);
+
+        LoadGenerator(const LoadGenerator&) = delete;
+        LoadGenerator& operator=(const LoadGenerator&) = delete;
+
+        /**
+         * @brief Publishes all streams. Blocks until the duration has elapsed or stop() is called.
+         * @return The run statistics.
+         * @throws std::logic_error if the generator is already running
+         */
+        LoadReport run();
+
+        /**
+         * @brief Requests a running generator to stop. Safe to call from another thread.
+         */
+        void stop() noexcept;
+
+        /**
+         * @brief Getter for the run options
+         * @return The options
+         */
+        [[nodiscard]] const LoadGeneratorOptions& getOptions() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         */
+        LoadGenerator(TransportFactory::Ptr transport, const LoadGeneratorOptions& options);
+
+        TransportFactory::Ptr transport_;
+        LoadGeneratorOptions options_;
+        std::atomic<bool> running_{false};
+        std::atomic<bool> stopRequested_{false};
+    };
+}
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "sv/core/workpool.h"
+#include "sv/protection/Protection.h"
+#include "sv/sim/Breaker.h"
+
+/// @brief sv namespace \namespace sv::sim
+namespace sv::sim
+{
+    /// @brief Scenario quantity that a study varies \enum StudyParameter
+    enum class StudyParameter
+    {
+        FAULT_CURRENT_A,
+        FAULT_TIME_S,
+        FAULT_IMPEDANCE_OHM,
+        FAULT_ANGLE_RAD,
+        LOAD_CURRENT_A,
+        BREAKER_OPEN_TIME_S,
+        BREAKER_MAX_CURRENT_A,
+        BREAKER_ARC_DURATION_S,
+        ZONE1_REACH_OHM,
+        ZONE2_REACH_OHM,
+        ZONE2_DELAY_S,
+        ZONE3_REACH_OHM,
+        ZONE3_DELAY_S
+    };
+
+    /// @brief Convert StudyParameter to its column name
+    inline const char* toString(const StudyParameter parameter)
+    {
+        switch (parameter)
+        {
+            case StudyParameter::FAULT_CURRENT_A: return "fault_current_a";
+            case StudyParameter::FAULT_TIME_S: return "fault_time_s";
+            case StudyParameter::FAULT_IMPEDANCE_OHM: return "fault_impedance_ohm";
+            case StudyParameter::FAULT_ANGLE_RAD: return "fault_angle_rad";
+            case StudyParameter::LOAD_CURRENT_A: return "load_current_a";
+            case StudyParameter::BREAKER_OPEN_TIME_S: return "breaker_open_time_s";
+            case StudyParameter::BREAKER_MAX_CURRENT_A: return "breaker_max_current_a";
+            case StudyParameter::BREAKER_ARC_DURATION_S: return "breaker_arc_duration_s";
+            case StudyParameter::ZONE1_REACH_OHM: return "zone1_reach_ohm";
+            case StudyParameter::ZONE2_REACH_OHM: return "zone2_reach_ohm";
+            case StudyParameter::ZONE2_DELAY_S: return "zone2_delay_s";
+            case StudyParameter::ZONE3_REACH_OHM: return "zone3_reach_ohm";
+            case StudyParameter::ZONE3_DELAY_S: return "zone3_delay_s";
+            default: return "unknown";
+        }
+    }
+
+    /// @brief All study parameters in column order
+    inline constexpr StudyParameter STUDY_PARAMETERS[] = {
+        StudyParameter::FAULT_CURRENT_A, StudyParameter::FAULT_TIME_S, StudyParameter::FAULT_IMPEDANCE_OHM,
+        StudyParameter::FAULT_ANGLE_RAD, StudyParameter::LOAD_CURRENT_A, StudyParameter::BREAKER_OPEN_TIME_S,
+        StudyParameter::BREAKER_MAX_CURRENT_A, StudyParameter::BREAKER_ARC_DURATION_S, StudyParameter::ZONE1_REACH_OHM,
+        StudyParameter::ZONE2_REACH_OHM, StudyParameter::ZONE2_DELAY_S, StudyParameter::ZONE3_REACH_OHM,
+        StudyParameter::ZONE3_DELAY_S
+    };
+
+    /**
+     * @brief One breaker-plus-distance-relay scenario on a radial feeder \struct StudyScenario
+     *
+     * The feeder carries loadCurrentA at voltageV until faultTimeS. From then on the relay sees
+     * faultCurrentA through faultImpedanceOhm at faultAngleRad. A relay trip opens the breaker. A
+     * current above the breaker's maxCurrentA trips it directly.
+     */
+    struct StudyScenario
+    {
+        BreakerDefinition breaker{.maxCurrentA = 40000.0};
+        DistanceProtectionSettings protection;
+        double voltageV{6350.0};
+        double loadCurrentA{150.0};
+        double loadAngleRad{0.2};
+        double faultCurrentA{5000.0};
+        double faultImpedanceOhm{1.0};
+        double faultAngleRad{1.0};
+        double faultTimeS{0.1};
+        double durationS{0.5};
+        double timeStepS{0.00025};
+
+        /**
+         * @brief Gets a varied quantity
+         * @param parameter The parameter
+         * @return The value
+         */
+        [[nodiscard]] double get(StudyParameter parameter) const;
+
+        /**
+         * @brief Sets a varied quantity
+         * @param parameter The parameter
+         * @param value The value
+         */
+        void set(StudyParameter parameter, double value);
+
+        /**
+         * @brief Validates the scenario
+         * @return true if the scenario can be simulated
+         */
+        [[nodiscard]] bool isValid() const;
+    };
+
+    /// @brief Grid axis: every listed value is combined with every value of the other axes \struct StudyAxis
+    struct StudyAxis
+    {
+        StudyParameter parameter;
+        std::vector<double> values;
+    };
+
+    /// @brief Uniformly sampled parameter range \struct StudyRange
+    struct StudyRange
+    {
+        StudyParameter parameter;
+        double min;
+        double max;
+    };
+
+    /**
+     * @brief Scenario grid and random sampling specification \struct StudySpec
+     *
+     * Every point of the grid (the base scenario if the grid is empty) is repeated samples times
+     * with the ranges drawn at random, or once if samples is zero. Draws depend only on the seed and
+     * the scenario index, so a study is reproducible for any worker count.
+     */
+    struct StudySpec
+    {
+        StudyScenario base;
+        std::vector<StudyAxis> grid;
+        std::vector<StudyRange> random;
+        size_t samples{0};
+        uint64_t seed{1};
+    };
+
+    /// @brief Outcome of one scenario \struct StudyOutcome
+    struct StudyOutcome
+    {
+        bool relayOperated{false};
+        uint8_t zone{0};
+        bool overloadTrip{false};
+        bool cleared{false};
+        double relayTimeS{0.0};
+        double clearingTimeS{0.0};
+    };
+
+    /// @brief Distribution of a time over all scenarios where it occurred \struct TripTimeDistribution
+    struct TripTimeDistribution
+    {
+        size_t count{0};
+        double minS{0.0};
+        double maxS{0.0};
+        double meanS{0.0};
+        double stddevS{0.0};
+        double p50S{0.0};
+        double p90S{0.0};
+        double p99S{0.0};
+    };
+
+    /// @brief Scenarios, outcomes and aggregated distributions of a study \struct StudyResult
+    struct StudyResult
+    {
+        std::vector<StudyScenario> scenarios;
+        std::vector<StudyOutcome> outcomes;
+        TripTimeDistribution relayTime;
+        TripTimeDistribution clearingTime;
+        size_t notCleared{0};
+        std::chrono::nanoseconds wallTime{0};
+
+        /**
+         * @brief Writes the study as a columnar binary file
+         *
+         * Layout, little-endian: the magic "SVSTUDY1", uint32 column count, uint64 row count, then per
+         * column a uint8 type (0 = float64, 1 = uint8) and a uint16-length name, then the column data
+         * one column after the other. Each column holds the parameters of STUDY_PARAMETERS followed
+         * by the outcome fields.
+         * @param path The output file
+         * @throws std::runtime_error if the file cannot be written
+         */
+        void writeColumnar(const std::string& path) const;
+
+        /**
+         * @brief Reads a file written by writeColumnar
+         * @param path The input file
+         * @return The columns by name, widened to double
+         * @throws std::runtime_error if the file is missing or malformed
+         */
+        [[nodiscard]] static std::map<std::string, std::vector<double>> readColumnar(const std::string& path);
+    };
+
+    /**
+     * @brief Runs independent breaker and protection scenarios on all cores. \class StudyRunner
+     *
+     * Each scenario runs a passive BreakerModel and a DistanceProtection on simulated sample time,
+     * so a scenario takes microseconds instead of its duration and gives the same outcome on any
+     * worker. Scenarios are split into chunks on a work-stealing pool.
+     */
+    class StudyRunner
+    {
+    public:
+        using Ptr = std::shared_ptr<StudyRunner>;
+
+        /**
+         * @brief Creates a new StudyRunner
+         * @param workers Number of worker threads, 0 for one per hardware thread
+         * @return A shared pointer to the created StudyRunner
+         */
+        [[nodiscard]] static Ptr create(size_t workers = 0);
+
+        StudyRunner(const StudyRunner&) = delete;
+        StudyRunner& operator=(const StudyRunner&) = delete;
+
+        /**
+         * @brief Expands a specification into its scenarios
+         * @param spec The study specification
+         * @return The scenarios in study order
+         * @throws std::invalid_argument if an axis is empty or a range is inverted
+         */
+        [[nodiscard]] static std::vector<StudyScenario> expand(const StudySpec& spec);
+
+        /**
+         * @brief Simulates one scenario
+         * @param scenario The scenario
+         * @return The outcome
+         * @throws std::invalid_argument if the scenario is invalid
+         */
+        [[nodiscard]] static StudyOutcome simulate(const StudyScenario& scenario);
+
+        /**
+         * @brief Expands and runs a study
+         * @param spec The study specification
+         * @return The study result
+         * @throws std::invalid_argument if the specification or a scenario is invalid
+         */
+        [[nodiscard]] StudyResult run(const StudySpec& spec);
+
+        /**
+         * @brief Runs a list of scenarios
+         * @param scenarios The scenarios
+         * @return The study result
+         * @throws std::invalid_argument if a scenario is invalid
+         */
+        [[nodiscard]] StudyResult run(std::vector<StudyScenario> scenarios);
+
+        /**
+         * @brief Gets the number of worker threads
+         * @return The worker count
+         */
+        [[nodiscard]] size_t getWorkerCount() const noexcept;
+
+        /**
+         * @brief Gets the number of scenario chunks taken from another worker
+         * @return The steal count
+         */
+        [[nodiscard]] uint64_t getStealCount() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private.
+         * @param workers Number of worker threads
+         */
+        explicit StudyRunner(size_t workers);
+
+        WorkStealingPool pool_;
+    };
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+#include "sv/core/types.h"
+
+/// @brief sv namespace \namespace sv::sim
+namespace sv::sim
+{
+    /// @brief Harmonic added to a channel \struct WaveformHarmonic
+    struct WaveformHarmonic
+    {
+        uint32_t order{2};
+        double rms{0.0};
+        double phaseRad{0.0};
+    };
+
+    /**
+     * @brief Content of one dataset channel \struct WaveformChannel
+     *
+     * The channel is rms * sqrt(2) * cos(wt + phaseRad) plus its harmonics, a DC offset decaying
+     * with dcTimeConstantS (0 keeps it constant) and uniform noise of noiseRms. Values are in
+     * amperes for the current channels and volts for the voltage channels.
+     */
+    struct WaveformChannel
+    {
+        double rms{0.0};
+        double phaseRad{0.0};
+        std::vector<WaveformHarmonic> harmonics;
+        double dcOffset{0.0};
+        double dcTimeConstantS{0.0};
+        double noiseRms{0.0};
+    };
+
+    /// @brief Channels of one stream in dataset order Ia, Ib, Ic, In, Va, Vb, Vc, Vn \struct WaveformDefinition
+    struct WaveformDefinition
+    {
+        std::array<WaveformChannel, VALUES_PER_ASDU> channels;
+        int32_t currentScaling{ScalingFactors::CURRENT_DEFAULT};
+        int32_t voltageScaling{ScalingFactors::VOLTAGE_DEFAULT};
+
+        /**
+         * @brief Creates a balanced three-phase stream with empty neutral channels
+         * @param currentRms The phase current
+         * @param voltageRms The phase voltage
+         * @param currentAngleRad The angle of the currents relative to the voltages
+         * @return The definition
+         */
+        [[nodiscard]] static WaveformDefinition balanced(double currentRms, double voltageRms, double currentAngleRad = 0.0);
+    };
+
+    /**
+     * @brief Generates scaled SV datasets for many streams without transcendental calls. \class WaveformGenerator
+     *
+     * Every sinusoid is a recursive oscillator: a phasor rotated by a constant step each sample.
+     * All fundamentals share one step; each stream keeps its channels in fixed arrays, one lane
+     * per channel, so one pass over the streams rotates, offsets and scales every channel in
+     * vector registers. Harmonics have their own loop. Integer harmonics
+     * return to their starting phasor after a nominal cycle, so the oscillators are reset at
+     * every cycle start and do not drift. DC offsets and noise are updated in the same
+     * channel-wise loops. Output is the int32 dataset of each stream, ready to encode.
+     */
+    class WaveformGenerator
+    {
+    public:
+        using Ptr = std::shared_ptr<WaveformGenerator>;
+
+        /**
+         * @brief Creates a new WaveformGenerator
+         * @param samplesPerPeriod The samples per nominal cycle
+         * @param frequency The nominal frequency
+         * @param seed Seed of the noise sources
+         * @return A shared pointer to the created WaveformGenerator
+         */
+        [[nodiscard]] static Ptr create(SamplesPerPeriod samplesPerPeriod = SamplesPerPeriod::SPP_80,
+                                        SignalFrequency frequency = SignalFrequency::FREQ_50_HZ,
+                                        uint64_t seed = 1);
+
+        /**
+         * @brief Creates a new WaveformGenerator for a rate without a SamplesPerPeriod value,
+         * e.g. 288 samples per cycle for 14400 Hz at 50 Hz
+         * @param samplesPerPeriod The samples per nominal cycle
+         * @param frequencyHz The nominal frequency in hertz
+         * @param seed Seed of the noise sources
+         * @return A shared pointer to the created WaveformGenerator
+         * @throws std::invalid_argument if there are fewer than 4 samples per cycle or the frequency is not positive
+         */
+        [[nodiscard]] static Ptr create(size_t samplesPerPeriod, double frequencyHz, uint64_t seed = 1);
+
+        WaveformGenerator(const WaveformGenerator&) = delete;
+        WaveformGenerator& operator=(const WaveformGenerator&) = delete;
+
+        /**
+         * @brief Adds a stream, in phase with the streams already generated
+         * @param definition The stream definition
+         * @return The index of the stream
+         * @throws std::invalid_argument if a harmonic is not below half the samples per period, a
+         * scaling is not positive, or a time constant or noise level is negative
+         */
+        size_t addStream(const WaveformDefinition& definition);
+
+        /**
+         * @brief Generates the next sample of every stream
+         * @return VALUES_PER_ASDU values per stream, valid until the next call
+         */
+        std::span<const int32_t> step();
+
+        /**
+         * @brief Generates several samples of every stream
+         * @param out Receives the step() output of each sample, one sample after the other
+         * @throws std::invalid_argument if the size is not a multiple of one sample of all streams
+         */
+        void generate(std::span<int32_t> out);
+
+        /**
+         * @brief Converts one stream's dataset of the last sample into the values of an ASDU
+         * @param stream The stream index
+         * @param values Receives VALUES_PER_ASDU values
+         * @throws std::out_of_range if the stream does not exist
+         */
+        void toAnalogValues(size_t stream, std::vector<AnalogValue>& values) const;
+
+        /**
+         * @brief Getter for the number of streams
+         * @return The stream count
+         */
+        [[nodiscard]] size_t getStreamCount() const noexcept;
+
+        /**
+         * @brief Getter for the number of samples generated
+         * @return The sample count
+         */
+        [[nodiscard]] uint64_t getSampleCount() const noexcept;
+
+    private:
+        /**
+         * @brief Constructor is private. Use create() method.
+         */
+        WaveformGenerator(size_t samplesPerPeriod, double frequencyHz, uint64_t seed);
+
+        /// @brief Oscillator state of one stream's channels, one lane per channel \struct StreamState
+        struct alignas(64) StreamState
+        {
+            std::array<double, VALUES_PER_ASDU> real;
+            std::array<double, VALUES_PER_ASDU> imag;
+            std::array<double, VALUES_PER_ASDU> startReal;
+            std::array<double, VALUES_PER_ASDU> startImag;
+            std::array<double, VALUES_PER_ASDU> dc;
+            std::array<double, VALUES_PER_ASDU> dcDecay;
+            std::array<double, VALUES_PER_ASDU> scale;
+            std::array<double, VALUES_PER_ASDU> noiseScale;
+            std::array<double, VALUES_PER_ASDU> extra;
+            std::array<uint64_t, VALUES_PER_ASDU> noise;
+        };
+
+        size_t samplesPerPeriod_;
+        double samplePeriodS_;
+        double stepCos_;
+        double stepSin_;
+        uint64_t seed_;
+        uint64_t samples_{0};
+        bool noisy_{false};
+
+        std::vector<StreamState> streams_;
+        std::vector<int32_t> output_;
+
+        // Per harmonic of all channels
+        std::vector<double> harmonicReal_;
+        std::vector<double> harmonicImag_;
+        std::vector<double> harmonicStartReal_;
+        std::vector<double> harmonicStartImag_;
+        std::vector<double> harmonicStepCos_;
+        std::vector<double> harmonicStepSin_;
+        std::vector<uint32_t> harmonicChannel_;
+    };
+}
@@ -1,8 +1,16 @@
 #include "sv/model/IedClient.h"
 #include "sv/model/IedModel.h"
+#include "sv/network/Transport.h"
 #include "sv/visualize/SVVisualizer.h"
 #include "sv/core/ptp.h"
+#include "sv/core/sampleclock.h"
+#include "sv/core/pipeline.h"
 #include "sv/protection/Protection.h"
+#include "sv/protection/HarmonicRestraint.h"
+#include "sv/protection/PhasorEstimator.h"
+#include "sv/protection/SequenceProtection.h"
+#include "sv/protection/TripEvents.h"
+#include <array>
 #include <iostream>
 #include <iomanip>
 #include <string>
@@ -12,20 +20,44 @@
 
 int main(int argc, char* argv[])
 {
-    std::string interface;
+    std::string transportSpec;
+    std::string captureFile;
     if (argc > 1)
     {
-        interface = argv[1];
+        transportSpec = argv[1];
+    }
+    if (argc > 2)
+    {
+        captureFile = argv[2];
     }
 
     std::cout << "IEC61850 SV Client Demo" << std::endl;
-    std::cout << "Interface: " << (interface.empty() ? "(auto-detect)" : interface) << std::endl;
+
+    const auto transport = sv::createTransport(transportSpec);
+    if (!transport)
+    {
+        std::cerr << "Usage: " << argv[0] << " [<interface> | eth:<interface> | unix[:<path>]] [capture.pcapng]" << std::endl;
+        return 1;
+    }
+    std::cout << "Transport: " << transport->describe() << std::endl;
+
+    if (!captureFile.empty())
+    {
+        const auto ethernet = std::dynamic_pointer_cast<sv::EthernetTransportFactory>(transport);
+        if (!ethernet)
+        {
+            std::cerr << "Error: Capture is only supported on the Ethernet transport." << std::endl;
+            return 1;
+        }
+        ethernet->setCaptureFile(captureFile);
+        std::cout << "Capture file: " << captureFile << std::endl;
+    }
 
     const auto model = sv::IedModel::create("ClientModel");
-    const auto client = sv::IedClient::create(model, interface);
+    const auto client = sv::IedClient::create(model, transport);
     if (!client)
     {
-        std::cerr << "Error: Failed to create client. Check interface name." << std::endl;
+        std::cerr << "Error: Failed to create client. Check transport specification." << std::endl;
         return 1;
     }
 
@@ -34,24 +66,52 @@ int main(int argc, char* argv[])
     diffSettings.minOperatingCurrentA = 0.3;
     diffSettings.instantaneousThresholdA = 400.0;
     auto differentialProtection = sv::DifferentialProtection::create(diffSettings);
+    auto sequenceProtection = sv::SequenceProtection::create();
 
-    differentialProtection->onTrip([](const sv::DifferentialProtectionResult& result)
+    // Trips are queued by the receive thread and printed on the dispatcher thread,
+    // so console output never delays the next frame
+    auto tripDispatcher = sv::TripEventDispatcher::create();
+    tripDispatcher->subscribe([](const sv::TripEvent& event)
     {
-        std::cout << "\n*** DIFFERENTIAL PROTECTION TRIP ***" << std::endl;
-        std::cout << "  Operating Current: " << std::fixed << std::setprecision(2)
-                  << result.operatingCurrentA << " A" << std::endl;
-        std::cout << "  Restraint Current: " << std::fixed << std::setprecision(2)
-                  << result.restraintCurrentA << " A" << std::endl;
-        std::cout << "  Instantaneous: " << (result.instantaneous ? "YES" : "NO") << std::endl;
+        if (event.source == sv::TripSource::DIFFERENTIAL)
+        {
+            std::cout << "\n*** DIFFERENTIAL PROTECTION TRIP ***" << std::endl;
+            std::cout << "  Operating Current: " << std::fixed << std::setprecision(2)
+                      << event.value << " A" << std::endl;
+            std::cout << "  Restraint Current: " << std::fixed << std::setprecision(2)
+                      << event.secondary << " A" << std::endl;
+            std::cout << "  Instantaneous: " << ((event.flags & sv::TripEvent::FLAG_INSTANTANEOUS) ? "YES" : "NO") << std::endl;
+        }
+        else if (event.source == sv::TripSource::SEQUENCE)
+        {
+            std::cout << "\n*** SEQUENCE PROTECTION TRIP ***" << std::endl;
+            std::cout << "  Negative Sequence: " << std::fixed << std::setprecision(2)
+                      << event.value << " A" << ((event.flags & sv::TripEvent::FLAG_NEGATIVE_SEQUENCE) ? " (TRIP)" : "") << std::endl;
+            std::cout << "  Residual: " << std::fixed << std::setprecision(2)
+                      << event.secondary << " A" << ((event.flags & sv::TripEvent::FLAG_EARTH_FAULT) ? " (TRIP)" : "") << std::endl;
+        }
     });
+    tripDispatcher->start();
+    differentialProtection->setTripDispatcher(tripDispatcher, 1);
+    sequenceProtection->setTripDispatcher(tripDispatcher, 2);
+
+    // The demo publisher uses the default 80 samples per 50 Hz cycle and default scaling
+    const auto phasorEstimator = sv::PhasorEstimator::create();
+    const auto harmonicRestraint = sv::HarmonicRestraint::create();
+    sv::SampleClock sampleClock;
+    sv::ThreePhaseMeasurement measurement;
 
     size_t frameCount = 0;
     double maxCurrentA = 0.0;
     double maxCurrentB = 0.0;
     double maxCurrentC = 0.0;
 
+    // Frame-to-decision latency every 5 s while listening
+    const auto latencyReporter = sv::PipelineLatencyReporter::create(std::chrono::seconds(5));
+    latencyReporter->start();
+
     std::cout << "Starting client, listening for 10 seconds..." << std::endl;
-    std::cout << "Monitoring with differential protection..." << std::endl;
+    std::cout << "Monitoring with differential and sequence protection..." << std::endl;
 
     client->start([&](const sv::ASDU& asdu)
     {
@@ -67,10 +127,22 @@ int main(int argc, char* argv[])
             maxCurrentB = std::max(maxCurrentB, std::abs(ib));
             maxCurrentC = std::max(maxCurrentC, std::abs(ic));
 
-            const std::complex<double> current1(ia, 0.0);
-            const std::complex<double> current2(ia * 0.98, 0.0);
+            phasorEstimator->update(asdu);
+            const auto sampleTime = sampleClock.update(asdu.smpCnt);
+            const std::array<double, 3> side1{ia, ib, ic};
+            const std::array<double, 3> side2{ia * 0.98, ib * 0.98, ic * 0.98};
+            harmonicRestraint->update(side1, side2);
+
+            if (phasorEstimator->isValid())
+            {
+                const std::complex<double> current1 = phasorEstimator->getCurrent(0);
+                const std::complex<double> current2 = current1 * 0.98;
 
-            const auto diffResult = differentialProtection->update(current1, current2);
+                static_cast<void>(differentialProtection->update(current1, current2, harmonicRestraint->isBlocked(0)));
+
+                measurement.update(*phasorEstimator);
+                static_cast<void>(sequenceProtection->update(measurement, sampleTime));
+            }
 
             if (frameCount % 20 == 0)
             {
@@ -102,6 +174,8 @@ int main(int argc, char* argv[])
 
     std::cout << "\nStopping client..." << std::endl;
     client->stop();
+    tripDispatcher->stop();
+    latencyReporter->stop();
 
     std::cout << "\n=== Session Statistics ===" << std::endl;
     std::cout << "Frames processed by callback: " << frameCount << std::endl;
@@ -112,6 +186,7 @@ int main(int argc, char* argv[])
     std::cout << "Max current Phase C: " << std::fixed << std::setprecision(2)
               << maxCurrentC << " A" << std::endl;
     std::cout << "==========================" << std::endl;
+    std::cout << sv::PipelineLatency::snapshot().toString() << std::endl;
 
     const auto received = client->receiveSampledValues();
     std::cout << "Received " << received.size() << " ASDU frames total." << std::endl;
@@ -4,27 +4,38 @@
 #include <iomanip>
 #include <cmath>
 #include <complex>
+#include <array>
 
 #include "sv/core/mac.h"
 #include "sv/core/ptp.h"
+#include "sv/core/sampleclock.h"
 #include "sv/model/IedModel.h"
 #include "sv/model/IedServer.h"
 #include "sv/model/LogicalNode.h"
 #include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/Transport.h"
 #include "sv/sim/Breaker.h"
 #include "sv/protection/Protection.h"
+#include "sv/protection/PhasorEstimator.h"
 
 
 int main(int argc, char* argv[])
 {
-    std::string interface;
+    std::string transportSpec;
     if (argc > 1)
     {
-        interface = argv[1];
+        transportSpec = argv[1];
     }
 
     std::cout << "IEC61850 SV Server Demo" << std::endl;
-    std::cout << "Interface: " << (interface.empty() ? "(auto-detect)" : interface) << std::endl;
+
+    const auto transport = sv::createTransport(transportSpec);
+    if (!transport)
+    {
+        std::cerr << "Usage: " << argv[0] << " [<interface> | eth:<interface> | unix[:<path>]]" << std::endl;
+        return 1;
+    }
+    std::cout << "Transport: " << transport->describe() << std::endl;
 
     const auto model = sv::IedModel::create("SVModel");
 
@@ -85,10 +96,10 @@ int main(int argc, char* argv[])
 
     ln->addSampledValueControlBlock(svcb);
 
-    const auto server = sv::IedServer::create(model, interface);
+    const auto server = sv::IedServer::create(model, transport);
     if (!server)
     {
-        std::cerr << "Error: Failed to create server. Check interface name." << std::endl;
+        std::cerr << "Error: Failed to create server. Check transport specification." << std::endl;
         return 1;
     }
 
@@ -97,7 +108,7 @@ int main(int argc, char* argv[])
     breakerDef.voltageRatingV = 400.0;
     breakerDef.openTimeSec = 0.050;
     breakerDef.closeTimeSec = 0.100;
-    auto breaker = sv::sim::BreakerModel::create(breakerDef);
+    auto breaker = sv::sim::BreakerModel::create(breakerDef, sv::sim::BreakerClock::REAL_TIME);
 
     sv::DistanceProtectionSettings distSettings;
     distSettings.zone1.reachOhm = 0.8;
@@ -109,16 +120,21 @@ int main(int argc, char* argv[])
     distSettings.currentThresholdA = 50.0;
     auto distanceProtection = sv::DistanceProtection::create(distSettings);
 
-    distanceProtection->onTrip([&breaker](const sv::DistanceProtectionResult& result)
+    // Trips are queued by the protection thread and handled on the dispatcher thread,
+    // so console output and the breaker command never delay the next evaluation
+    auto tripDispatcher = sv::TripEventDispatcher::create();
+    tripDispatcher->subscribe([&breaker](const sv::TripEvent& event)
     {
         std::cout << "\n*** DISTANCE PROTECTION TRIP ***" << std::endl;
-        std::cout << "  Zone 1: " << (result.zone1Trip ? "TRIP" : "OK") << std::endl;
-        std::cout << "  Zone 2: " << (result.zone2Trip ? "TRIP" : "OK") << std::endl;
-        std::cout << "  Zone 3: " << (result.zone3Trip ? "TRIP" : "OK") << std::endl;
+        std::cout << "  Zone 1: " << ((event.flags & sv::TripEvent::FLAG_ZONE1) ? "TRIP" : "OK") << std::endl;
+        std::cout << "  Zone 2: " << ((event.flags & sv::TripEvent::FLAG_ZONE2) ? "TRIP" : "OK") << std::endl;
+        std::cout << "  Zone 3: " << ((event.flags & sv::TripEvent::FLAG_ZONE3) ? "TRIP" : "OK") << std::endl;
         std::cout << "  Measured Z: " << std::fixed << std::setprecision(3)
-                  << result.measuredImpedanceOhm << " Ω" << std::endl;
+                  << event.value << " Ω" << std::endl;
         breaker->trip();
     });
+    tripDispatcher->start();
+    distanceProtection->setTripDispatcher(tripDispatcher, 1);
 
     breaker->onStateChange([](sv::sim::BreakerState oldState, sv::sim::BreakerState newState)
     {
@@ -133,21 +149,29 @@ int main(int argc, char* argv[])
     std::cout << "Starting server..." << std::endl;
     server->start();
 
+    const auto phasorEstimator = sv::PhasorEstimator::create(*svcb);
+    sv::SampleClock sampleClock(svcb->getSamplesPerPeriod(), svcb->getSignalFrequency());
+
+    // Two cycles of load fill the phasor window before the fault
+    constexpr int totalFrames = 240;
+    constexpr int faultFrame = 160;
+
     std::vector<sv::AnalogValue> values(sv::VALUES_PER_ASDU);
     std::cout << "\nSending sampled value frames with protection simulation..." << std::endl;
-    std::cout << "Simulating normal load, then fault at frame 40..." << std::endl;
+    std::cout << "Simulating normal load, then fault at frame " << faultFrame << "..." << std::endl;
 
-    for (int frame = 0; frame < 80; ++frame)
+    for (int frame = 0; frame < totalFrames; ++frame)
     {
         const auto samplesPerPeriod = static_cast<double>(svcb->getSamplesPerPeriod());
         const double frequency = static_cast<double>(svcb->getSignalFrequency()) / 10.0;
         const double time = frame / (samplesPerPeriod * frequency);
         const double omega = 2.0 * std::numbers::pi * frequency;
+        const auto sampleTime = sampleClock.update(static_cast<uint16_t>(frame));
 
         double currentAmplitude = 100.0;
         constexpr double voltageAmplitude = 230.0;
 
-        if (frame >= 40 && breaker->isClosed())
+        if (frame >= faultFrame && breaker->isClosed())
         {
             currentAmplitude = 450.0;
             std::cout << "\n>>> Fault injected at frame " << frame << " <<<" << std::endl;
@@ -166,13 +190,16 @@ int main(int argc, char* argv[])
             breaker->setCurrent(ia);
 
             const double actualBreakerCurrent = breaker->getCurrent();
+            const std::array<double, sv::PhasorEstimator::CHANNELS> samples = {actualBreakerCurrent, ib, ic, 0.0, va, vb, vc, 0.0};
+            phasorEstimator->update(samples);
+
+            const std::complex<double> currentPhasor = phasorEstimator->getCurrent(0);
+            const std::complex<double> voltagePhasor = phasorEstimator->getVoltage(0);
+
             constexpr double minCurrentForProtection = 10.0;
-            if (std::abs(actualBreakerCurrent) > minCurrentForProtection)
+            if (phasorEstimator->isValid() && std::abs(currentPhasor) > minCurrentForProtection)
             {
-                const std::complex<double> currentPhasor(actualBreakerCurrent, 0.0);
-                const std::complex<double> voltagePhasor(va, 0.0);
-
-                const auto protResult = distanceProtection->update(voltagePhasor, currentPhasor);
+                const auto protResult = distanceProtection->update(voltagePhasor, currentPhasor, sampleTime);
 
                 if (protResult.zone1Trip || protResult.zone2Trip || protResult.zone3Trip)
                 {
@@ -214,7 +241,7 @@ int main(int argc, char* argv[])
 
         server->updateSampledValue(svcb, values);
 
-        if (frame % 10 == 0 || frame >= 40)
+        if (frame % 20 == 0 || (frame >= faultFrame && frame % 5 == 0))
         {
             const int32_t currentVal = values[0].getScaledInt();
             const int32_t voltageVal = values[4].getScaledInt();
@@ -226,20 +253,33 @@ int main(int argc, char* argv[])
                       << "Va=" << std::setw(7) << std::fixed << std::setprecision(1) << actualV << "V, "
                       << "Breaker: " << sv::sim::toString(breaker->getState());
 
-            if (breaker->isClosed() && std::abs(actualI) > 1.0)
+            const std::complex<double> currentPhasor = phasorEstimator->getCurrent(0);
+            if (breaker->isClosed() && phasorEstimator->isValid() && std::abs(currentPhasor) > 1.0)
             {
-                const double impedance = actualV / actualI;
+                const double impedance = std::abs(phasorEstimator->getVoltage(0) / currentPhasor);
                 std::cout << ", Z=" << std::setw(6) << std::fixed << std::setprecision(2) << impedance << "Ohm";
             }
 
             std::cout << std::endl;
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
     }
 
     server->stop();
+    tripDispatcher->stop();
     std::cout << "Server stopped." << std::endl;
 
+    const auto& enqueueLatency = tripDispatcher->getEnqueueLatency();
+    const auto& dispatchLatency = tripDispatcher->getDispatchLatency();
+    std::cout << "Trip events: " << tripDispatcher->getPublished()
+              << " (dropped " << tripDispatcher->getDropped() << ")" << std::endl;
+    std::cout << "  Decision -> enqueue: p50=" << enqueueLatency.percentileNs(50.0)
+              << " ns, p99=" << enqueueLatency.percentileNs(99.0)
+              << " ns, max=" << enqueueLatency.maxNs() << " ns" << std::endl;
+    std::cout << "  Enqueue -> delivery: p50=" << dispatchLatency.percentileNs(50.0)
+              << " ns, p99=" << dispatchLatency.percentileNs(99.0)
+              << " ns, max=" << dispatchLatency.maxNs() << " ns" << std::endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,221 @@
+#include "../include/sv/protection/HarmonicRestraint.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+using namespace sv;
+
+HarmonicRestraint::Ptr HarmonicRestraint::create(const SamplesPerPeriod samplesPerPeriod, const HarmonicRestraintSettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid harmonic restraint settings");
+    }
+    return Ptr(new HarmonicRestraint(static_cast<size_t>(samplesPerPeriod), settings));
+}
+
+HarmonicRestraint::HarmonicRestraint(const size_t samplesPerPeriod, const HarmonicRestraintSettings& settings)
+    : settings_(settings)
+    , samplesPerPeriod_(samplesPerPeriod)
+    , rmsScale_(std::numbers::sqrt2 / static_cast<double>(samplesPerPeriod))
+{
+    const double second = settings_.secondHarmonicPercent / 100.0;
+    const double fifth = settings_.fifthHarmonicPercent / 100.0;
+    const double external = settings_.externalFaultPercent / 100.0;
+    const double restraint = settings_.saturationRestraintA / rmsScale_;
+    secondRatioSquared_ = second * second;
+    fifthRatioSquared_ = fifth * fifth;
+    externalFaultRatioSquared_ = external * external;
+    saturationRestraintSquared_ = restraint * restraint;
+
+    const double samples = static_cast<double>(samplesPerPeriod_);
+    saturationDetectSamples_ = std::max(1u, static_cast<uint32_t>(std::lround(settings_.saturationDetectCycles * samples)));
+    saturationBlockSamples_ = static_cast<uint32_t>(std::lround(settings_.saturationBlockCycles * samples));
+
+    // Goertzel coefficient 2 cos(2 pi h / N) per filter group
+    constexpr std::array<double, 4> harmonics = {1.0, 2.0, 5.0, 1.0};
+    for (size_t group = 0; group < harmonics.size(); ++group)
+    {
+        const double coefficient = 2.0 * std::cos(2.0 * std::numbers::pi * harmonics[group] / samples);
+        std::fill_n(coefficient_.begin() + group * PHASES, PHASES, coefficient);
+    }
+}
+
+const HarmonicRestraintResult& HarmonicRestraint::update(const std::span<const double, PHASES> current1A,
+                                                         const std::span<const double, PHASES> current2A) noexcept
+{
+    auto& slot = window_[index_];
+
+    // The comb x(n) - x(n - N) in front of each resonator turns the Goertzel filter into a sliding
+    // one: its state is always the plain Goertzel state over the last N samples
+    alignas(64) std::array<double, FILTERS> delta{};
+    for (size_t p = 0; p < PHASES; ++p)
+    {
+        const double operating = current1A[p] - current2A[p];
+        const double restraint = 0.5 * (current1A[p] + current2A[p]);
+        const double operatingDelta = operating - slot[p];
+        delta[FUNDAMENTAL + p] = operatingDelta;
+        delta[SECOND + p] = operatingDelta;
+        delta[FIFTH + p] = operatingDelta;
+        delta[RESTRAINT + p] = restraint - slot[PHASES + p];
+        slot[p] = operating;
+        slot[PHASES + p] = restraint;
+    }
+
+    for (size_t f = 0; f < FILTERS; ++f)
+    {
+        const double state = delta[f] + coefficient_[f] * state1_[f] - state2_[f];
+        state2_[f] = state1_[f];
+        state1_[f] = state;
+    }
+
+    if (++index_ == samplesPerPeriod_)
+    {
+        index_ = 0;
+    }
+    if (filled_ < samplesPerPeriod_)
+    {
+        ++filled_;
+    }
+    if (++sinceResync_ == RESYNC_CYCLES * samplesPerPeriod_)
+    {
+        resync();
+    }
+
+    evaluate();
+    return result_;
+}
+
+const HarmonicRestraintResult& HarmonicRestraint::getResult() const noexcept
+{
+    return result_;
+}
+
+bool HarmonicRestraint::isBlocked(const size_t phase) const noexcept
+{
+    return phase < PHASES && result_.blocked[phase];
+}
+
+double HarmonicRestraint::getFundamental(const size_t phase) const noexcept
+{
+    return phase < PHASES ? rms(FUNDAMENTAL + phase) : 0.0;
+}
+
+double HarmonicRestraint::getSecondHarmonic(const size_t phase) const noexcept
+{
+    return phase < PHASES ? rms(SECOND + phase) : 0.0;
+}
+
+double HarmonicRestraint::getFifthHarmonic(const size_t phase) const noexcept
+{
+    return phase < PHASES ? rms(FIFTH + phase) : 0.0;
+}
+
+double HarmonicRestraint::getRestraint(const size_t phase) const noexcept
+{
+    return phase < PHASES ? rms(RESTRAINT + phase) : 0.0;
+}
+
+bool HarmonicRestraint::isValid() const noexcept
+{
+    return filled_ == samplesPerPeriod_;
+}
+
+void HarmonicRestraint::reset() noexcept
+{
+    for (auto& slot : window_)
+    {
+        slot.fill(0.0);
+    }
+    state1_.fill(0.0);
+    state2_.fill(0.0);
+    externalFaultSamples_.fill(0);
+    saturationHold_ = 0;
+    result_ = HarmonicRestraintResult{};
+    index_ = 0;
+    filled_ = 0;
+    sinceResync_ = 0;
+}
+
+const HarmonicRestraintSettings& HarmonicRestraint::getSettings() const noexcept
+{
+    return settings_;
+}
+
+size_t HarmonicRestraint::getSamplesPerPeriod() const noexcept
+{
+    return samplesPerPeriod_;
+}
+
+double HarmonicRestraint::magnitudeSquared(const size_t filter) const noexcept
+{
+    const double y1 = state1_[filter];
+    const double y2 = state2_[filter];
+    return std::max(0.0, y1 * y1 + y2 * y2 - coefficient_[filter] * y1 * y2);
+}
+
+double HarmonicRestraint::rms(const size_t filter) const noexcept
+{
+    return std::sqrt(magnitudeSquared(filter)) * rmsScale_;
+}
+
+void HarmonicRestraint::resync() noexcept
+{
+    state1_.fill(0.0);
+    state2_.fill(0.0);
+
+    // Plain Goertzel pass over the window, oldest sample first
+    for (size_t n = 0; n < samplesPerPeriod_; ++n)
+    {
+        const auto& slot = window_[(index_ + n) % samplesPerPeriod_];
+        for (size_t f = 0; f < FILTERS; ++f)
+        {
+            const double x = f < RESTRAINT ? slot[f % PHASES] : slot[PHASES + f % PHASES];
+            const double state = x + coefficient_[f] * state1_[f] - state2_[f];
+            state2_[f] = state1_[f];
+            state1_[f] = state;
+        }
+    }
+    sinceResync_ = 0;
+}
+
+void HarmonicRestraint::evaluate() noexcept
+{
+    bool anyHarmonic = false;
+    bool externalFault = false;
+
+    for (size_t p = 0; p < PHASES; ++p)
+    {
+        const double fundamental = magnitudeSquared(FUNDAMENTAL + p);
+        const double restraint = magnitudeSquared(RESTRAINT + p);
+
+        result_.secondHarmonicBlocked[p] = magnitudeSquared(SECOND + p) > secondRatioSquared_ * fundamental;
+        result_.fifthHarmonicBlocked[p] = settings_.fifthHarmonicEnabled &&
+                                          magnitudeSquared(FIFTH + p) > fifthRatioSquared_ * fundamental;
+        anyHarmonic |= result_.secondHarmonicBlocked[p] || result_.fifthHarmonicBlocked[p];
+
+        const bool throughFault = settings_.saturationDetection && restraint >= saturationRestraintSquared_ &&
+                                  fundamental <= externalFaultRatioSquared_ * restraint;
+        externalFaultSamples_[p] = throughFault ? externalFaultSamples_[p] + 1 : 0;
+        externalFault |= externalFaultSamples_[p] >= saturationDetectSamples_;
+    }
+
+    if (externalFault)
+    {
+        saturationHold_ = saturationBlockSamples_;
+    }
+    else if (saturationHold_ > 0)
+    {
+        --saturationHold_;
+    }
+    result_.saturationDetected = externalFault || saturationHold_ > 0;
+
+    for (size_t p = 0; p < PHASES; ++p)
+    {
+        const bool harmonic = settings_.crossBlocking
+                                  ? anyHarmonic
+                                  : result_.secondHarmonicBlocked[p] || result_.fifthHarmonicBlocked[p];
+        result_.blocked[p] = harmonic || result_.saturationDetected;
+    }
+}
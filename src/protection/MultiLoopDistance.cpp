@@ -0,0 +1,303 @@
+#include "../include/sv/protection/MultiLoopDistance.h"
+#include "../include/sv/core/alloc.h"
+#include "../include/sv/core/pipeline.h"
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+using namespace sv;
+
+MultiLoopDistanceProtection::Ptr MultiLoopDistanceProtection::create(const MultiLoopDistanceSettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid multi-loop distance protection settings");
+    }
+    return Ptr(new MultiLoopDistanceProtection(settings));
+}
+
+MultiLoopDistanceProtection::MultiLoopDistanceProtection(const MultiLoopDistanceSettings& settings)
+    : snapshot_(makeSnapshot(settings))
+{
+}
+
+MultiLoopDistanceProtection::Snapshot MultiLoopDistanceProtection::makeSnapshot(const MultiLoopDistanceSettings& settings) noexcept
+{
+    Snapshot snapshot;
+    snapshot.settings = settings;
+
+    const std::array<const LoopZone*, 3> zones = {&settings.zone1, &settings.zone2, &settings.zone3};
+    for (size_t z = 0; z < zones.size(); ++z)
+    {
+        const LoopZone& zone = *zones[z];
+        ZoneShape& shape = snapshot.shapes[z];
+
+        const double sinAngle = std::sin(zone.lineAngleRad);
+        const double cosAngle = std::cos(zone.lineAngleRad);
+
+        shape.enabled = zone.enabled;
+        shape.mho = zone.characteristic == ZoneCharacteristic::MHO;
+
+        // Self-polarized mho: circle through the origin with its diameter along the line angle
+        shape.centerR = 0.5 * zone.reachOhm * cosAngle;
+        shape.centerX = 0.5 * zone.reachOhm * sinAngle;
+        shape.radiusSquared = 0.25 * zone.reachOhm * zone.reachOhm;
+
+        // Quadrilateral: reactance reach on top, directional line at X = 0, resistive blinders parallel to the line
+        shape.reactanceReach = zone.reachOhm * sinAngle;
+        shape.resistiveReach = zone.resistiveReachOhm;
+        shape.cotangent = cosAngle / sinAngle;
+    }
+    return snapshot;
+}
+
+MultiLoopDistanceResult MultiLoopDistanceProtection::update(const ThreePhaseMeasurement& measurement)
+{
+    return update(measurement, std::chrono::steady_clock::now().time_since_epoch());
+}
+
+MultiLoopDistanceResult MultiLoopDistanceProtection::update(const ThreePhaseMeasurement& measurement,
+                                                            const std::chrono::nanoseconds sampleTime)
+{
+    const std::array<std::complex<double>, 3> voltages = {measurement.getPhaseVoltage(0), measurement.getPhaseVoltage(1),
+                                                          measurement.getPhaseVoltage(2)};
+    const std::array<std::complex<double>, 3> currents = {measurement.getPhaseCurrent(0), measurement.getPhaseCurrent(1),
+                                                          measurement.getPhaseCurrent(2)};
+    return update(voltages, currents, sampleTime);
+}
+
+MultiLoopDistanceResult MultiLoopDistanceProtection::update(const std::span<const std::complex<double>, 3> voltagesV,
+                                                            const std::span<const std::complex<double>, 3> currentsA)
+{
+    return update(voltagesV, currentsA, std::chrono::steady_clock::now().time_since_epoch());
+}
+
+MultiLoopDistanceResult MultiLoopDistanceProtection::update(const std::span<const std::complex<double>, 3> voltagesV,
+                                                            const std::span<const std::complex<double>, 3> currentsA,
+                                                            const std::chrono::nanoseconds sampleTime)
+{
+    const AllocationScopeGuard scope(AllocationScope::PROTECT);
+
+    MultiLoopDistanceResult result;
+    result.sampleTime = sampleTime;
+
+    if (!enabled_.load(std::memory_order_acquire))
+    {
+        return result;
+    }
+
+    const auto snapshot = snapshot_.read();
+    const MultiLoopDistanceSettings& settings = snapshot->settings;
+    const std::array<ZoneShape, 3>& shapes = snapshot->shapes;
+
+    // Loop quantities: AB, BC, CA phase-to-phase, then AG, BG, CG with residual compensation
+    const std::complex<double> compensation = settings.residualCompensation * (currentsA[0] + currentsA[1] + currentsA[2]);
+    const std::array<std::complex<double>, LOOPS> loopVoltage = {
+        voltagesV[0] - voltagesV[1], voltagesV[1] - voltagesV[2], voltagesV[2] - voltagesV[0],
+        voltagesV[0], voltagesV[1], voltagesV[2]};
+    const std::array<std::complex<double>, LOOPS> loopCurrent = {
+        currentsA[0] - currentsA[1], currentsA[1] - currentsA[2], currentsA[2] - currentsA[0],
+        currentsA[0] + compensation, currentsA[1] + compensation, currentsA[2] + compensation};
+
+    alignas(64) std::array<double, LANES> vr{};
+    alignas(64) std::array<double, LANES> vi{};
+    alignas(64) std::array<double, LANES> ir{};
+    alignas(64) std::array<double, LANES> ii{};
+    for (size_t l = 0; l < LOOPS; ++l)
+    {
+        vr[l] = loopVoltage[l].real();
+        vi[l] = loopVoltage[l].imag();
+        ir[l] = loopCurrent[l].real();
+        ii[l] = loopCurrent[l].imag();
+    }
+
+    // Z = V * conj(I) / |I|^2 for all lanes at once; lanes below the current threshold are masked out
+    const double thresholdSquared = settings.currentThresholdA * settings.currentThresholdA;
+    const double direction = settings.directionForward ? 1.0 : -1.0;
+    for (size_t l = 0; l < LANES; ++l)
+    {
+        const double magnitudeSquared = ir[l] * ir[l] + ii[l] * ii[l];
+        const bool valid = magnitudeSquared >= thresholdSquared;
+        const double scale = (valid ? direction : 0.0) / (valid ? magnitudeSquared : 1.0);
+        resistance_[l] = (vr[l] * ir[l] + vi[l] * ii[l]) * scale;
+        reactance_[l] = (vi[l] * ir[l] - vr[l] * ii[l]) * scale;
+        valid_[l] = valid ? 1 : 0;
+        zones_[l] = 0;
+    }
+
+    for (size_t z = 0; z < shapes.size(); ++z)
+    {
+        applyZone(shapes[z], static_cast<uint8_t>(1u << z));
+    }
+
+    uint8_t anyZone = 0;
+    for (size_t l = 0; l < LOOPS; ++l)
+    {
+        result.loopImpedanceOhm[l] = valid_[l] ? std::complex<double>(direction * resistance_[l], direction * reactance_[l])
+                                               : std::complex<double>{};
+        result.loopZones[l] = zones_[l];
+        anyZone |= zones_[l];
+    }
+
+    // Faulted loop: fastest zone first, then the smallest impedance within it
+    for (size_t z = 0; z < shapes.size() && result.faultedLoop == FaultLoop::NONE; ++z)
+    {
+        const uint8_t bit = static_cast<uint8_t>(1u << z);
+        double smallest = std::numeric_limits<double>::max();
+        for (size_t l = 0; l < LOOPS; ++l)
+        {
+            const double magnitudeSquared = resistance_[l] * resistance_[l] + reactance_[l] * reactance_[l];
+            if ((zones_[l] & bit) && magnitudeSquared < smallest)
+            {
+                smallest = magnitudeSquared;
+                result.faultedLoop = static_cast<FaultLoop>(l);
+            }
+        }
+    }
+
+    const std::array<std::chrono::microseconds, 3> delays = {settings.zone1.delay, settings.zone2.delay, settings.zone3.delay};
+    std::array<bool, 3> trips{};
+    for (size_t z = 0; z < trips.size(); ++z)
+    {
+        if (!(anyZone & (1u << z)))
+        {
+            zoneActive_[z] = false;
+            continue;
+        }
+        if (!zoneActive_[z])
+        {
+            zoneActive_[z] = true;
+            zoneStartTime_[z] = sampleTime;
+        }
+        trips[z] = sampleTime - zoneStartTime_[z] >= delays[z];
+    }
+
+    result.zone1Trip = trips[0];
+    result.zone2Trip = trips[1];
+    result.zone3Trip = trips[2];
+
+    if (result.zone1Trip || result.zone2Trip || result.zone3Trip)
+    {
+        result.tripTime = std::chrono::steady_clock::now();
+    }
+    invokeCallBack(result);
+
+    PipelineLatency::mark(PipelineStage::DECISION);
+    return result;
+}
+
+void MultiLoopDistanceProtection::applyZone(const ZoneShape& shape, const uint8_t bit) noexcept
+{
+    if (!shape.enabled)
+    {
+        return;
+    }
+
+    if (shape.mho)
+    {
+        for (size_t l = 0; l < LANES; ++l)
+        {
+            const double dr = resistance_[l] - shape.centerR;
+            const double dx = reactance_[l] - shape.centerX;
+            const bool inside = dr * dr + dx * dx <= shape.radiusSquared;
+            zones_[l] |= (inside && valid_[l]) ? bit : 0;
+        }
+    }
+    else
+    {
+        for (size_t l = 0; l < LANES; ++l)
+        {
+            const double offset = resistance_[l] - reactance_[l] * shape.cotangent;
+            const bool inside = reactance_[l] >= 0.0 && reactance_[l] <= shape.reactanceReach &&
+                                std::abs(offset) <= shape.resistiveReach;
+            zones_[l] |= (inside && valid_[l]) ? bit : 0;
+        }
+    }
+}
+
+void MultiLoopDistanceProtection::reset()
+{
+    zoneActive_.fill(false);
+    tripped_ = false;
+}
+
+void MultiLoopDistanceProtection::setSettings(const MultiLoopDistanceSettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid multi-loop distance protection settings");
+    }
+    snapshot_.store(makeSnapshot(settings));
+}
+
+MultiLoopDistanceSettings MultiLoopDistanceProtection::getSettings() const
+{
+    return snapshot_.read()->settings;
+}
+
+void MultiLoopDistanceProtection::setEnabled(const bool enabled) noexcept
+{
+    enabled_.store(enabled, std::memory_order_release);
+    if (!enabled)
+    {
+        reset();
+    }
+}
+
+bool MultiLoopDistanceProtection::isEnabled() const noexcept
+{
+    return enabled_.load(std::memory_order_acquire);
+}
+
+void MultiLoopDistanceProtection::onTrip(std::function<void(const MultiLoopDistanceResult&)> callback)
+{
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    callback_ = std::move(callback);
+    hasCallback_.store(static_cast<bool>(callback_), std::memory_order_release);
+}
+
+void MultiLoopDistanceProtection::setTripDispatcher(TripEventDispatcher::Ptr dispatcher, const uint32_t elementId)
+{
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    elementId_ = elementId;
+    dispatcherRaw_.store(dispatcher.get(), std::memory_order_release);
+    dispatcher_ = std::move(dispatcher);
+}
+
+void MultiLoopDistanceProtection::invokeCallBack(const MultiLoopDistanceResult& result)
+{
+    const bool trip = result.zone1Trip || result.zone2Trip || result.zone3Trip;
+    const bool wasTripped = std::exchange(tripped_, trip);
+    if (!trip)
+    {
+        return;
+    }
+
+    // A standing fault yields one event per element: only the rising edge is published
+    TripEventDispatcher* dispatcher = wasTripped ? nullptr : dispatcherRaw_.load(std::memory_order_acquire);
+    if (dispatcher != nullptr)
+    {
+        TripEvent event;
+        event.source = TripSource::MULTI_LOOP_DISTANCE;
+        event.elementId = elementId_;
+        event.originNs = PipelineLatency::frameOrigin();
+        event.decisionNs = TripEvent::toNs(result.tripTime);
+        event.flags = static_cast<uint8_t>((result.zone1Trip ? TripEvent::FLAG_ZONE1 : 0u) |
+                                           (result.zone2Trip ? TripEvent::FLAG_ZONE2 : 0u) |
+                                           (result.zone3Trip ? TripEvent::FLAG_ZONE3 : 0u));
+        event.loop = static_cast<uint8_t>(result.faultedLoop);
+        event.value = result.faultImpedance().real();
+        event.secondary = result.faultImpedance().imag();
+        static_cast<void>(dispatcher->publish(event));
+    }
+
+    // The deprecated onTrip callback is the only locked step; skip it when none is registered
+    if (hasCallback_.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        if (callback_)
+        {
+            callback_(result);
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include "../include/sv/protection/PhasorEstimator.h"
+#include "../include/sv/model/SampledValueControlBlock.h"
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+using namespace sv;
+
+PhasorEstimator::Ptr PhasorEstimator::create(const SamplesPerPeriod samplesPerPeriod, const SignalFrequency frequency,
+                                             const int32_t currentScaling, const int32_t voltageScaling)
+{
+    if (currentScaling <= 0 || voltageScaling <= 0)
+    {
+        throw std::invalid_argument("Phasor estimator scaling factors must be positive");
+    }
+    return Ptr(new PhasorEstimator(static_cast<size_t>(samplesPerPeriod), static_cast<double>(frequency) / 10.0,
+                                   currentScaling, voltageScaling));
+}
+
+PhasorEstimator::Ptr PhasorEstimator::create(const SampledValueControlBlock& svcb)
+{
+    return create(svcb.getSamplesPerPeriod(), svcb.getSignalFrequency(), svcb.getCurrentScaling(), svcb.getVoltageScaling());
+}
+
+PhasorEstimator::PhasorEstimator(const size_t samplesPerPeriod, const double frequencyHz,
+                                 const int32_t currentScaling, const int32_t voltageScaling)
+    : samplesPerPeriod_(samplesPerPeriod)
+    , frequencyHz_(frequencyHz)
+    , currentScale_(1.0 / currentScaling)
+    , voltageScale_(1.0 / voltageScaling)
+{
+    // Folds the sqrt(2)/N RMS normalisation into the twiddles
+    const double gain = std::numbers::sqrt2 / static_cast<double>(samplesPerPeriod_);
+    for (size_t k = 0; k < samplesPerPeriod_; ++k)
+    {
+        const double angle = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(samplesPerPeriod_);
+        twiddle_[k] = std::polar(gain, angle);
+    }
+}
+
+void PhasorEstimator::update(const std::span<const double, CHANNELS> samples) noexcept
+{
+    auto& slot = window_[index_];
+    const std::complex<double> twiddle = twiddle_[index_];
+
+    for (size_t ch = 0; ch < CHANNELS; ++ch)
+    {
+        phasor_[ch] += (samples[ch] - slot[ch]) * twiddle;
+        slot[ch] = samples[ch];
+    }
+
+    if (++index_ == samplesPerPeriod_)
+    {
+        index_ = 0;
+    }
+    if (filled_ < samplesPerPeriod_)
+    {
+        ++filled_;
+    }
+}
+
+void PhasorEstimator::update(const ASDU& asdu) noexcept
+{
+    if (asdu.dataSet.size() < CHANNELS)
+    {
+        return;
+    }
+
+    std::array<double, CHANNELS> samples{};
+    for (size_t ch = 0; ch < CHANNELS; ++ch)
+    {
+        const double scale = ch < FIRST_VOLTAGE_CHANNEL ? currentScale_ : voltageScale_;
+        samples[ch] = static_cast<double>(asdu.dataSet[ch].getScaledInt()) * scale;
+    }
+    update(samples);
+}
+
+std::complex<double> PhasorEstimator::getPhasor(const size_t channel) const noexcept
+{
+    return channel < CHANNELS ? phasor_[channel] : std::complex<double>{};
+}
+
+std::complex<double> PhasorEstimator::getCurrent(const size_t phase) const noexcept
+{
+    return phase < FIRST_VOLTAGE_CHANNEL ? phasor_[phase] : std::complex<double>{};
+}
+
+std::complex<double> PhasorEstimator::getVoltage(const size_t phase) const noexcept
+{
+    return phase < CHANNELS - FIRST_VOLTAGE_CHANNEL ? phasor_[FIRST_VOLTAGE_CHANNEL + phase] : std::complex<double>{};
+}
+
+bool PhasorEstimator::isValid() const noexcept
+{
+    return filled_ == samplesPerPeriod_;
+}
+
+void PhasorEstimator::reset() noexcept
+{
+    for (auto& slot : window_)
+    {
+        slot.fill(0.0);
+    }
+    phasor_.fill({});
+    index_ = 0;
+    filled_ = 0;
+}
+
+size_t PhasorEstimator::getSamplesPerPeriod() const noexcept
+{
+    return samplesPerPeriod_;
+}
+
+double PhasorEstimator::getFrequencyHz() const noexcept
+{
+    return frequencyHz_;
+}
@@ -0,0 +1,306 @@
+#include "../include/sv/protection/PhasorKernel.h"
+#include "../include/sv/model/SampledValueControlBlock.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SV_PHASOR_KERNEL_X86 1
+#endif
+
+using namespace sv;
+
+std::unique_ptr<PhasorKernel> PhasorKernel::create(const SamplesPerPeriod samplesPerPeriod, const int32_t currentScaling,
+                                                   const int32_t voltageScaling, const Isa isa)
+{
+    if (currentScaling <= 0 || voltageScaling <= 0)
+    {
+        throw std::invalid_argument("Phasor kernel scaling factors must be positive");
+    }
+    if (!isSupported(isa))
+    {
+        throw std::invalid_argument("Requested instruction set is not supported by this CPU");
+    }
+    return std::unique_ptr<PhasorKernel>(new PhasorKernel(static_cast<size_t>(samplesPerPeriod), currentScaling, voltageScaling, isa));
+}
+
+std::unique_ptr<PhasorKernel> PhasorKernel::create(const SampledValueControlBlock& svcb, const Isa isa)
+{
+    return create(svcb.getSamplesPerPeriod(), svcb.getCurrentScaling(), svcb.getVoltageScaling(), isa);
+}
+
+PhasorKernel::Isa PhasorKernel::detectIsa() noexcept
+{
+    if (isSupported(Isa::Avx512))
+    {
+        return Isa::Avx512;
+    }
+    if (isSupported(Isa::Avx2))
+    {
+        return Isa::Avx2;
+    }
+    return Isa::Scalar;
+}
+
+bool PhasorKernel::isSupported(const Isa isa) noexcept
+{
+#ifdef SV_PHASOR_KERNEL_X86
+    switch (isa)
+    {
+        case Isa::Avx512: return __builtin_cpu_supports("avx512f");
+        case Isa::Avx2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        case Isa::Scalar: return true;
+    }
+    return false;
+#else
+    return isa == Isa::Scalar;
+#endif
+}
+
+PhasorKernel::PhasorKernel(const size_t samplesPerPeriod, const int32_t currentScaling, const int32_t voltageScaling, const Isa isa)
+    : samplesPerPeriod_(samplesPerPeriod)
+    , isa_(isa)
+{
+    switch (isa_)
+    {
+        case Isa::Avx512: process_ = &PhasorKernel::processAvx512; break;
+        case Isa::Avx2: process_ = &PhasorKernel::processAvx2; break;
+        case Isa::Scalar: process_ = &PhasorKernel::processScalar; break;
+    }
+
+    for (size_t ch = 0; ch < CHANNELS; ++ch)
+    {
+        scale_[ch] = 1.0 / (ch < FIRST_VOLTAGE_CHANNEL ? currentScaling : voltageScaling);
+    }
+
+    // Folds the sqrt(2)/N RMS normalisation and the sign of the imaginary part into the tables
+    const double gain = std::numbers::sqrt2 / static_cast<double>(samplesPerPeriod_);
+    for (size_t k = 0; k < samplesPerPeriod_; ++k)
+    {
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(samplesPerPeriod_);
+        cos_[k] = gain * std::cos(angle);
+        sin_[k] = -gain * std::sin(angle);
+    }
+}
+
+void PhasorKernel::update(const std::span<const int32_t, CHANNELS> dataset) noexcept
+{
+    process_(*this, dataset.data(), 1);
+}
+
+void PhasorKernel::process(const std::span<const int32_t> datasets) noexcept
+{
+    process_(*this, datasets.data(), datasets.size() / CHANNELS);
+}
+
+bool PhasorKernel::advance() noexcept
+{
+    if (filled_ < samplesPerPeriod_)
+    {
+        ++filled_;
+    }
+    if (++index_ < samplesPerPeriod_)
+    {
+        return false;
+    }
+    index_ = 0;
+    return ++cycles_ % RESYNC_CYCLES == 0;
+}
+
+void PhasorKernel::resync() noexcept
+{
+    real_.fill(0.0);
+    imag_.fill(0.0);
+    sumSquares_.fill(0.0);
+
+    for (size_t k = 0; k < samplesPerPeriod_; ++k)
+    {
+        for (size_t ch = 0; ch < CHANNELS; ++ch)
+        {
+            const double x = window_[k][ch];
+            real_[ch] += x * cos_[k];
+            imag_[ch] += x * sin_[k];
+            sumSquares_[ch] += x * x;
+        }
+    }
+}
+
+void PhasorKernel::processScalar(PhasorKernel& kernel, const int32_t* data, const size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i, data += CHANNELS)
+    {
+        auto& slot = kernel.window_[kernel.index_];
+        const double c = kernel.cos_[kernel.index_];
+        const double s = kernel.sin_[kernel.index_];
+
+        for (size_t ch = 0; ch < CHANNELS; ++ch)
+        {
+            const double x = static_cast<double>(data[ch]) * kernel.scale_[ch];
+            const double old = slot[ch];
+            const double delta = x - old;
+            kernel.real_[ch] += delta * c;
+            kernel.imag_[ch] += delta * s;
+            kernel.sumSquares_[ch] += x * x - old * old;
+            slot[ch] = x;
+        }
+
+        if (kernel.advance())
+        {
+            kernel.resync();
+        }
+    }
+}
+
+#ifdef SV_PHASOR_KERNEL_X86
+__attribute__((target("avx2,fma")))
+void PhasorKernel::processAvx2(PhasorKernel& kernel, const int32_t* data, const size_t count) noexcept
+{
+    const __m256d scaleLo = _mm256_load_pd(kernel.scale_.data());
+    const __m256d scaleHi = _mm256_load_pd(kernel.scale_.data() + 4);
+    __m256d realLo = _mm256_load_pd(kernel.real_.data());
+    __m256d realHi = _mm256_load_pd(kernel.real_.data() + 4);
+    __m256d imagLo = _mm256_load_pd(kernel.imag_.data());
+    __m256d imagHi = _mm256_load_pd(kernel.imag_.data() + 4);
+    __m256d squaresLo = _mm256_load_pd(kernel.sumSquares_.data());
+    __m256d squaresHi = _mm256_load_pd(kernel.sumSquares_.data() + 4);
+
+    for (size_t i = 0; i < count; ++i, data += CHANNELS)
+    {
+        double* slot = kernel.window_[kernel.index_].data();
+        const __m256d c = _mm256_set1_pd(kernel.cos_[kernel.index_]);
+        const __m256d s = _mm256_set1_pd(kernel.sin_[kernel.index_]);
+
+        const __m256d xLo = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data))), scaleLo);
+        const __m256d xHi = _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4))), scaleHi);
+        const __m256d oldLo = _mm256_load_pd(slot);
+        const __m256d oldHi = _mm256_load_pd(slot + 4);
+
+        const __m256d deltaLo = _mm256_sub_pd(xLo, oldLo);
+        const __m256d deltaHi = _mm256_sub_pd(xHi, oldHi);
+        realLo = _mm256_fmadd_pd(deltaLo, c, realLo);
+        realHi = _mm256_fmadd_pd(deltaHi, c, realHi);
+        imagLo = _mm256_fmadd_pd(deltaLo, s, imagLo);
+        imagHi = _mm256_fmadd_pd(deltaHi, s, imagHi);
+
+        // x^2 - old^2 = (x - old) * (x + old)
+        squaresLo = _mm256_fmadd_pd(deltaLo, _mm256_add_pd(xLo, oldLo), squaresLo);
+        squaresHi = _mm256_fmadd_pd(deltaHi, _mm256_add_pd(xHi, oldHi), squaresHi);
+
+        _mm256_store_pd(slot, xLo);
+        _mm256_store_pd(slot + 4, xHi);
+
+        if (kernel.advance())
+        {
+            kernel.resync();
+            realLo = _mm256_load_pd(kernel.real_.data());
+            realHi = _mm256_load_pd(kernel.real_.data() + 4);
+            imagLo = _mm256_load_pd(kernel.imag_.data());
+            imagHi = _mm256_load_pd(kernel.imag_.data() + 4);
+            squaresLo = _mm256_load_pd(kernel.sumSquares_.data());
+            squaresHi = _mm256_load_pd(kernel.sumSquares_.data() + 4);
+        }
+    }
+
+    _mm256_store_pd(kernel.real_.data(), realLo);
+    _mm256_store_pd(kernel.real_.data() + 4, realHi);
+    _mm256_store_pd(kernel.imag_.data(), imagLo);
+    _mm256_store_pd(kernel.imag_.data() + 4, imagHi);
+    _mm256_store_pd(kernel.sumSquares_.data(), squaresLo);
+    _mm256_store_pd(kernel.sumSquares_.data() + 4, squaresHi);
+}
+
+__attribute__((target("avx512f")))
+void PhasorKernel::processAvx512(PhasorKernel& kernel, const int32_t* data, const size_t count) noexcept
+{
+    const __m512d scale = _mm512_load_pd(kernel.scale_.data());
+    __m512d real = _mm512_load_pd(kernel.real_.data());
+    __m512d imag = _mm512_load_pd(kernel.imag_.data());
+    __m512d squares = _mm512_load_pd(kernel.sumSquares_.data());
+
+    for (size_t i = 0; i < count; ++i, data += CHANNELS)
+    {
+        double* slot = kernel.window_[kernel.index_].data();
+        const __m512d c = _mm512_set1_pd(kernel.cos_[kernel.index_]);
+        const __m512d s = _mm512_set1_pd(kernel.sin_[kernel.index_]);
+
+        // Zero-masked form: the plain _mm512_cvtepi32_pd starts from an undefined vector, which
+        // GCC reports as -Wmaybe-uninitialized once inlined at -O2
+        const __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        const __m512d x = _mm512_mul_pd(_mm512_maskz_cvtepi32_pd(0xFF, raw), scale);
+        const __m512d old = _mm512_load_pd(slot);
+        const __m512d delta = _mm512_sub_pd(x, old);
+
+        real = _mm512_fmadd_pd(delta, c, real);
+        imag = _mm512_fmadd_pd(delta, s, imag);
+        squares = _mm512_fmadd_pd(delta, _mm512_add_pd(x, old), squares);
+        _mm512_store_pd(slot, x);
+
+        if (kernel.advance())
+        {
+            kernel.resync();
+            real = _mm512_load_pd(kernel.real_.data());
+            imag = _mm512_load_pd(kernel.imag_.data());
+            squares = _mm512_load_pd(kernel.sumSquares_.data());
+        }
+    }
+
+    _mm512_store_pd(kernel.real_.data(), real);
+    _mm512_store_pd(kernel.imag_.data(), imag);
+    _mm512_store_pd(kernel.sumSquares_.data(), squares);
+}
+#else
+void PhasorKernel::processAvx2(PhasorKernel& kernel, const int32_t* data, const size_t count) noexcept
+{
+    processScalar(kernel, data, count);
+}
+
+void PhasorKernel::processAvx512(PhasorKernel& kernel, const int32_t* data, const size_t count) noexcept
+{
+    processScalar(kernel, data, count);
+}
+#endif
+
+std::complex<double> PhasorKernel::getPhasor(const size_t channel) const noexcept
+{
+    return channel < CHANNELS ? std::complex<double>(real_[channel], imag_[channel]) : std::complex<double>{};
+}
+
+double PhasorKernel::getRms(const size_t channel) const noexcept
+{
+    if (channel >= CHANNELS)
+    {
+        return 0.0;
+    }
+    return std::sqrt(std::max(sumSquares_[channel], 0.0) / static_cast<double>(samplesPerPeriod_));
+}
+
+bool PhasorKernel::isValid() const noexcept
+{
+    return filled_ == samplesPerPeriod_;
+}
+
+void PhasorKernel::reset() noexcept
+{
+    for (auto& slot : window_)
+    {
+        slot.fill(0.0);
+    }
+    real_.fill(0.0);
+    imag_.fill(0.0);
+    sumSquares_.fill(0.0);
+    index_ = 0;
+    filled_ = 0;
+    cycles_ = 0;
+}
+
+PhasorKernel::Isa PhasorKernel::getIsa() const noexcept
+{
+    return isa_;
+}
+
+size_t PhasorKernel::getSamplesPerPeriod() const noexcept
+{
+    return samplesPerPeriod_;
+}
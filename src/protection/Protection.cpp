@@ -1,6 +1,12 @@
 #include "../include/sv/protection/Protection.h"
+#include "../include/sv/core/alloc.h"
+#include "../include/sv/core/pipeline.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <numbers>
+#include <stdexcept>
+#include <utility>
 
 using namespace sv;
 
@@ -20,17 +26,28 @@ DistanceProtection::DistanceProtection(const DistanceProtectionSettings& setting
 
 DistanceProtectionResult DistanceProtection::update(const std::complex<double> voltageV, const std::complex<double> currentA)
 {
+    return update(voltageV, currentA, std::chrono::steady_clock::now().time_since_epoch());
+}
+
+DistanceProtectionResult DistanceProtection::update(const std::complex<double> voltageV, const std::complex<double> currentA,
+                                                    const std::chrono::nanoseconds sampleTime)
+{
+    const AllocationScopeGuard scope(AllocationScope::PROTECT);
+
     DistanceProtectionResult result;
+    result.sampleTime = sampleTime;
 
     if (!enabled_.load(std::memory_order_acquire))
     {
         return result;
     }
 
+    const auto settings = settings_.read();
+
     const double voltageMag = std::abs(voltageV);
     const double currentMag = std::abs(currentA);
 
-    if (voltageMag < settings_.voltageThresholdV || currentMag < settings_.currentThresholdA)
+    if (voltageMag < settings->voltageThresholdV || currentMag < settings->currentThresholdA)
     {
         reset();
         return result;
@@ -43,78 +60,198 @@ DistanceProtectionResult DistanceProtection::update(const std::complex<double> v
     result.measuredImpedanceOhm = impedanceMag;
     result.measuredAngleRad = impedanceAngle;
 
-    if (!checkDirecation(impedance))
+    if (!checkDirecation(*settings, impedance))
     {
         reset();
         return result;
     }
 
-    const auto now = std::chrono::steady_clock::now();
-
-    if (settings_.zone1.enabled && checkZone(settings_.zone1, impedanceMag, impedanceAngle))
+    if (settings->zone1.enabled && checkZone(settings->zone1, impedanceMag, impedanceAngle))
     {
-        if (!zone1Active_.load(std::memory_order_acquire))
-        {
-            zone1Active_.store(true, std::memory_order_release);
-            zone1StartTime_ = now;
-        }
-
-        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - zone1StartTime_);
-        if (elapsed >= settings_.zone1.delay)
-        {
-            result.zone1Trip = true;
-            result.tripTime = now;
-            invokeCallBack(result);
-        }
+        result.zone1Trip = checkZoneTimer(settings->zone1, zone1Active_, zone1StartTime_, sampleTime);
     }
     else
     {
         zone1Active_.store(false, std::memory_order_release);
     }
 
-    if (settings_.zone2.enabled && checkZone(settings_.zone2, impedanceMag, impedanceAngle))
+    if (settings->zone2.enabled && checkZone(settings->zone2, impedanceMag, impedanceAngle))
     {
-        if (!zone2Active_.load(std::memory_order_acquire))
-        {
-            zone2Active_.store(true, std::memory_order_release);
-            zone2StartTime_ = now;
-        }
-
-        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - zone2StartTime_);
-        if (elapsed >= settings_.zone2.delay)
-        {
-            result.zone2Trip = true;
-            result.tripTime = now;
-            invokeCallBack(result);
-        }
+        result.zone2Trip = checkZoneTimer(settings->zone2, zone2Active_, zone2StartTime_, sampleTime);
     }
     else
     {
         zone2Active_.store(false, std::memory_order_release);
     }
 
-    if (settings_.zone3.enabled && checkZone(settings_.zone3, impedanceMag, impedanceAngle))
+    if (settings->zone3.enabled && checkZone(settings->zone3, impedanceMag, impedanceAngle))
+    {
+        result.zone3Trip = checkZoneTimer(settings->zone3, zone3Active_, zone3StartTime_, sampleTime);
+    }
+    else
+    {
+        zone3Active_.store(false, std::memory_order_release);
+    }
+
+    // All zones of the sample are reported together
+    if (result.zone1Trip || result.zone2Trip || result.zone3Trip)
     {
-        if (!zone3Active_.load(std::memory_order_acquire))
+        result.tripTime = std::chrono::steady_clock::now();
+    }
+    invokeCallBack(result);
+
+    PipelineLatency::mark(PipelineStage::DECISION);
+    return result;
+}
+
+void DistanceProtection::updateBlock(const std::span<const std::complex<double>> voltagesV,
+                                     const std::span<const std::complex<double>> currentsA,
+                                     const std::span<DistanceProtectionResult> results)
+{
+    updateBlock(voltagesV, currentsA, results, std::chrono::steady_clock::now().time_since_epoch(), std::chrono::nanoseconds(0));
+}
+
+void DistanceProtection::updateBlock(const std::span<const std::complex<double>> voltagesV,
+                                     const std::span<const std::complex<double>> currentsA,
+                                     const std::span<DistanceProtectionResult> results,
+                                     const std::chrono::nanoseconds firstSampleTime,
+                                     const std::chrono::nanoseconds samplePeriod)
+{
+    if (voltagesV.size() != currentsA.size() || results.size() < voltagesV.size())
+    {
+        throw std::invalid_argument("Distance protection block spans do not match");
+    }
+
+    if (!enabled_.load(std::memory_order_acquire))
+    {
+        std::fill_n(results.begin(), voltagesV.size(), DistanceProtectionResult{});
+        return;
+    }
+
+    const auto settings = settings_.read();
+    const std::array<const DistanceZone*, 3> zones = {&settings->zone1, &settings->zone2, &settings->zone3};
+    const std::array<std::atomic<bool>*, 3> zoneActive = {&zone1Active_, &zone2Active_, &zone3Active_};
+    const std::array<std::chrono::nanoseconds*, 3> zoneStart = {&zone1StartTime_, &zone2StartTime_, &zone3StartTime_};
+
+    // The vectorized pass works on |Z|^2 so it needs neither sqrt nor atan2: |Z| <= reach becomes
+    // |Z|^2 <= reach^2 and |arg Z| <= angle, i.e. R >= |Z| cos(angle), becomes R|R| >= |Z|^2 cos|cos|
+    std::array<double, 3> reachSquared{};
+    std::array<double, 3> cosSigned{};
+    for (size_t z = 0; z < zones.size(); ++z)
+    {
+        const double cosAngle = std::cos(zones[z]->angleRad);
+        reachSquared[z] = zones[z]->enabled ? zones[z]->reachOhm * zones[z]->reachOhm : -1.0;
+        cosSigned[z] = cosAngle * std::abs(cosAngle);
+    }
+    const double voltageThreshold = settings->voltageThresholdV * settings->voltageThresholdV;
+    const double currentThreshold = settings->currentThresholdA * settings->currentThresholdA;
+    const double direction = settings->directionForward ? 1.0 : -1.0;
+
+    constexpr uint8_t SUPERVISED = 1u << 0;
+    constexpr uint8_t DIRECTIONAL = 1u << 1;
+    constexpr uint8_t ZONE1 = 1u << 2;
+    constexpr uint8_t ZONE2 = 1u << 3;
+    constexpr uint8_t ZONE3 = 1u << 4;
+
+    alignas(64) std::array<double, BLOCK_CHUNK> resistance;
+    alignas(64) std::array<double, BLOCK_CHUNK> reactance;
+    alignas(64) std::array<double, BLOCK_CHUNK> magnitudeSquared;
+    alignas(64) std::array<uint8_t, BLOCK_CHUNK> flags;
+
+    for (size_t offset = 0; offset < voltagesV.size(); offset += BLOCK_CHUNK)
+    {
+        const size_t count = std::min(BLOCK_CHUNK, voltagesV.size() - offset);
+        const std::complex<double>* v = voltagesV.data() + offset;
+        const std::complex<double>* i = currentsA.data() + offset;
+
+        for (size_t k = 0; k < count; ++k)
         {
-            zone3Active_.store(true, std::memory_order_release);
-            zone3StartTime_ = now;
+            const double vr = v[k].real();
+            const double vi = v[k].imag();
+            const double ir = i[k].real();
+            const double ii = i[k].imag();
+
+            const double currentSquared = ir * ir + ii * ii;
+            const bool supervised = (vr * vr + vi * vi >= voltageThreshold) & (currentSquared >= currentThreshold);
+            const double scale = 1.0 / std::max(currentSquared, currentThreshold);
+
+            const double r = (vr * ir + vi * ii) * scale;
+            const double x = (vi * ir - vr * ii) * scale;
+            const double m = r * r + x * x;
+
+            resistance[k] = r;
+            reactance[k] = x;
+            magnitudeSquared[k] = m;
+
+            // Bitwise rather than short-circuit operators keep the loop free of branches
+            const double rSigned = r * std::abs(r);
+            uint8_t flag = static_cast<uint8_t>(supervised) * SUPERVISED;
+            flag |= static_cast<uint8_t>(r * direction > 0.0) * DIRECTIONAL;
+            flag |= static_cast<uint8_t>((m <= reachSquared[0]) & (rSigned >= m * cosSigned[0])) * ZONE1;
+            flag |= static_cast<uint8_t>((m <= reachSquared[1]) & (rSigned >= m * cosSigned[1])) * ZONE2;
+            flag |= static_cast<uint8_t>((m <= reachSquared[2]) & (rSigned >= m * cosSigned[2])) * ZONE3;
+            flags[k] = flag;
         }
 
-        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - zone3StartTime_);
-        if (elapsed >= settings_.zone3.delay)
+        for (size_t k = 0; k < count; ++k)
         {
-            result.zone3Trip = true;
-            result.tripTime = now;
+            DistanceProtectionResult& result = results[offset + k];
+            result = DistanceProtectionResult{};
+            result.sampleTime = firstSampleTime + samplePeriod * static_cast<int64_t>(offset + k);
+
+            if (!(flags[k] & SUPERVISED))
+            {
+                reset();
+                continue;
+            }
+
+            result.measuredImpedanceOhm = std::sqrt(magnitudeSquared[k]);
+            result.measuredAngleRad = std::atan2(reactance[k], resistance[k]);
+
+            if (!(flags[k] & DIRECTIONAL))
+            {
+                reset();
+                continue;
+            }
+
+            std::array<bool, 3> trips{};
+            for (size_t z = 0; z < zones.size(); ++z)
+            {
+                if (flags[k] & (ZONE1 << z))
+                {
+                    trips[z] = checkZoneTimer(*zones[z], *zoneActive[z], *zoneStart[z], result.sampleTime);
+                }
+                else
+                {
+                    zoneActive[z]->store(false, std::memory_order_release);
+                }
+            }
+
+            result.zone1Trip = trips[0];
+            result.zone2Trip = trips[1];
+            result.zone3Trip = trips[2];
+            if (result.zone1Trip || result.zone2Trip || result.zone3Trip)
+            {
+                result.tripTime = std::chrono::steady_clock::now();
+            }
             invokeCallBack(result);
         }
     }
-    else
+
+    PipelineLatency::mark(PipelineStage::DECISION);
+}
+
+bool DistanceProtection::checkZoneTimer(const DistanceZone& zone, std::atomic<bool>& active,
+                                        std::chrono::nanoseconds& startTime, const std::chrono::nanoseconds now) noexcept
+{
+    if (!active.load(std::memory_order_acquire))
     {
-        zone3Active_.store(false, std::memory_order_release);
+        active.store(true, std::memory_order_release);
+        startTime = now;
     }
 
-    return result;
+    // Full resolution: a 300 us delay must not round to 0 or 1 ms
+    return now - startTime >= zone.delay;
 }
 
 void DistanceProtection::reset()
@@ -122,6 +259,7 @@ void DistanceProtection::reset()
     zone1Active_.store(false, std::memory_order_release);
     zone2Active_.store(false, std::memory_order_release);
     zone3Active_.store(false, std::memory_order_release);
+    tripped_.store(false, std::memory_order_relaxed);
 }
 
 void DistanceProtection::setSettings(const DistanceProtectionSettings& settings)
@@ -130,14 +268,12 @@ void DistanceProtection::setSettings(const DistanceProtectionSettings& settings)
     {
         throw std::invalid_argument("Invalid distance protection settings");
     }
-    std::lock_guard<std::mutex> lock(settingsMutex_);
-    settings_ = settings;
+    settings_.store(settings);
 }
 
 DistanceProtectionSettings DistanceProtection::getSettings() const
 {
-    std::lock_guard<std::mutex> lock(settingsMutex_);
-    return settings_;
+    return settings_.load();
 }
 
 void DistanceProtection::setEnabled(const bool enabled) noexcept
@@ -158,6 +294,7 @@ void DistanceProtection::onTrip(ProtectionTripCallback callback)
 {
     std::lock_guard<std::mutex> lock(callbackMutex_);
     callback_ = std::move(callback);
+    hasCallback_.store(static_cast<bool>(callback_), std::memory_order_release);
 }
 
 bool DistanceProtection::checkZone(const DistanceZone& zone, const double impedance, const double angle) const noexcept
@@ -171,9 +308,9 @@ bool DistanceProtection::checkZone(const DistanceZone& zone, const double impeda
     return normalizedAngle <= zone.angleRad || normalizedAngle >= (2.0 * std::numbers::pi - zone.angleRad);
 }
 
-bool DistanceProtection::checkDirecation(const std::complex<double> impedance) const noexcept
+bool DistanceProtection::checkDirecation(const DistanceProtectionSettings& settings, const std::complex<double> impedance) noexcept
 {
-    if (settings_.directionForward)
+    if (settings.directionForward)
     {
         return impedance.real() > 0.0;
     }
@@ -183,12 +320,48 @@ bool DistanceProtection::checkDirecation(const std::complex<double> impedance) c
     }
 }
 
-void DistanceProtection::invokeCallBack(const DistanceProtectionResult& result)
+void DistanceProtection::setTripDispatcher(TripEventDispatcher::Ptr dispatcher, const uint32_t elementId)
 {
     std::lock_guard<std::mutex> lock(callbackMutex_);
-    if (callback_)
+    elementId_ = elementId;
+    dispatcherRaw_.store(dispatcher.get(), std::memory_order_release);
+    dispatcher_ = std::move(dispatcher);
+}
+
+void DistanceProtection::invokeCallBack(const DistanceProtectionResult& result)
+{
+    const bool trip = result.zone1Trip || result.zone2Trip || result.zone3Trip;
+    const bool wasTripped = tripped_.exchange(trip, std::memory_order_relaxed);
+    if (!trip)
+    {
+        return;
+    }
+
+    // A standing fault yields one event per element: only the rising edge is published
+    TripEventDispatcher* dispatcher = wasTripped ? nullptr : dispatcherRaw_.load(std::memory_order_acquire);
+    if (dispatcher != nullptr)
     {
-        callback_(result);
+        TripEvent event;
+        event.source = TripSource::DISTANCE;
+        event.elementId = elementId_;
+        event.originNs = PipelineLatency::frameOrigin();
+        event.decisionNs = TripEvent::toNs(result.tripTime);
+        event.flags = static_cast<uint8_t>((result.zone1Trip ? TripEvent::FLAG_ZONE1 : 0u) |
+                                           (result.zone2Trip ? TripEvent::FLAG_ZONE2 : 0u) |
+                                           (result.zone3Trip ? TripEvent::FLAG_ZONE3 : 0u));
+        event.value = result.measuredImpedanceOhm;
+        event.secondary = result.measuredAngleRad;
+        static_cast<void>(dispatcher->publish(event));
+    }
+
+    // The deprecated onTrip callback is the only locked step; skip it when none is registered
+    if (hasCallback_.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        if (callback_)
+        {
+            callback_(result);
+        }
     }
 }
 
@@ -208,6 +381,14 @@ DifferentialProtection::DifferentialProtection(const DifferentialProtectionSetti
 
 DifferentialProtectionResult DifferentialProtection::update(const std::complex<double> current1A, const std::complex<double> current2A)
 {
+    return update(current1A, current2A, false);
+}
+
+DifferentialProtectionResult DifferentialProtection::update(const std::complex<double> current1A, const std::complex<double> current2A,
+                                                            const bool restrained)
+{
+    const AllocationScopeGuard scope(AllocationScope::PROTECT);
+
     DifferentialProtectionResult result;
 
     if (!enabled_.load(std::memory_order_acquire))
@@ -215,6 +396,8 @@ DifferentialProtectionResult DifferentialProtection::update(const std::complex<d
         return result;
     }
 
+    const auto settings = settings_.read();
+
     const std::complex<double> operatingCurrent = current1A - current2A;
     const std::complex<double> restraintCurrentComplex = (current1A + current2A) * 0.5;
 
@@ -224,38 +407,130 @@ DifferentialProtectionResult DifferentialProtection::update(const std::complex<d
     result.operatingCurrentA = operatingMag;
     result.restraintCurrentA = restraintMag;
 
-    if (operatingMag >= settings_.instantaneousThresholdA)
+    if (operatingMag >= settings->instantaneousThresholdA)
     {
         result.trip = true;
         result.instantaneous = true;
         result.tripTime = std::chrono::steady_clock::now();
+        invokeCallBack(result);
+        PipelineLatency::mark(PipelineStage::DECISION);
+        return result;
+    }
 
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        if (callback_)
+    if (checkCharacteristic(*settings, operatingMag, restraintMag))
+    {
+        if (restrained)
         {
-            callback_(result);
+            result.restrained = true;
+        }
+        else
+        {
+            result.trip = true;
+            result.instantaneous = false;
+            result.tripTime = std::chrono::steady_clock::now();
         }
-        return result;
     }
+    invokeCallBack(result);
+
+    PipelineLatency::mark(PipelineStage::DECISION);
+    return result;
+}
 
-    if (checkCharacteristic(operatingMag, restraintMag))
+void DifferentialProtection::updateBlock(const std::span<const std::complex<double>> current1A,
+                                         const std::span<const std::complex<double>> current2A,
+                                         const std::span<DifferentialProtectionResult> results)
+{
+    updateBlock(current1A, current2A, {}, results);
+}
+
+void DifferentialProtection::updateBlock(const std::span<const std::complex<double>> current1A,
+                                         const std::span<const std::complex<double>> current2A,
+                                         const std::span<const uint8_t> restrained,
+                                         const std::span<DifferentialProtectionResult> results)
+{
+    if (current1A.size() != current2A.size() || results.size() < current1A.size() ||
+        (!restrained.empty() && restrained.size() != current1A.size()))
     {
-        result.trip = true;
-        result.instantaneous = false;
-        result.tripTime = std::chrono::steady_clock::now();
+        throw std::invalid_argument("Differential protection block spans do not match");
+    }
 
-        std::lock_guard<std::mutex> lock(callbackMutex_);
-        if (callback_)
+    if (!enabled_.load(std::memory_order_acquire))
+    {
+        std::fill_n(results.begin(), current1A.size(), DifferentialProtectionResult{});
+        return;
+    }
+
+    const auto settings = settings_.read();
+    const double slope = settings->slopePercent / 100.0;
+    const double slope2 = slope * slope;
+    const double instantaneous2 = settings->instantaneousThresholdA * settings->instantaneousThresholdA;
+    const double minOperating2 = settings->minOperatingCurrentA * settings->minOperatingCurrentA;
+    const double minRestraint2 = settings->minRestraintCurrentA * settings->minRestraintCurrentA;
+
+    alignas(64) std::array<double, BLOCK_CHUNK> operatingSquared;
+    alignas(64) std::array<double, BLOCK_CHUNK> restraintSquared;
+    alignas(64) std::array<uint8_t, BLOCK_CHUNK> trip;
+    alignas(64) std::array<uint8_t, BLOCK_CHUNK> instantaneous;
+    alignas(64) std::array<uint8_t, BLOCK_CHUNK> blocked;
+
+    const auto now = std::chrono::steady_clock::now();
+
+    for (size_t offset = 0; offset < current1A.size(); offset += BLOCK_CHUNK)
+    {
+        const size_t count = std::min(BLOCK_CHUNK, current1A.size() - offset);
+        const std::complex<double>* i1 = current1A.data() + offset;
+        const std::complex<double>* i2 = current2A.data() + offset;
+        const uint8_t* restraint = restrained.empty() ? nullptr : restrained.data() + offset;
+
+        for (size_t k = 0; k < count; ++k)
         {
-            callback_(result);
+            const double opR = i1[k].real() - i2[k].real();
+            const double opI = i1[k].imag() - i2[k].imag();
+            const double resR = 0.5 * (i1[k].real() + i2[k].real());
+            const double resI = 0.5 * (i1[k].imag() + i2[k].imag());
+
+            const double op = opR * opR + opI * opI;
+            const double res = resR * resR + resI * resI;
+
+            // Thresholds are compared on squared magnitudes and bitwise operators keep the loop free of branches
+            const bool instant = op >= instantaneous2;
+            const bool characteristic = (op >= minOperating2) & ((res < minRestraint2) | (op >= res * slope2));
+            const bool restrain = restraint != nullptr && restraint[k] != 0;
+
+            operatingSquared[k] = op;
+            restraintSquared[k] = res;
+            instantaneous[k] = static_cast<uint8_t>(instant);
+            trip[k] = static_cast<uint8_t>(instant | (characteristic & !restrain));
+            blocked[k] = static_cast<uint8_t>(!instant & characteristic & restrain);
+        }
+
+        for (size_t k = 0; k < count; ++k)
+        {
+            DifferentialProtectionResult& result = results[offset + k];
+            result = DifferentialProtectionResult{};
+            result.operatingCurrentA = std::sqrt(operatingSquared[k]);
+            result.restraintCurrentA = std::sqrt(restraintSquared[k]);
+
+            if (trip[k])
+            {
+                result.trip = true;
+                result.instantaneous = instantaneous[k] != 0;
+                result.tripTime = now;
+            }
+            else
+            {
+                result.restrained = blocked[k] != 0;
+            }
+            invokeCallBack(result);
         }
     }
 
-    return result;
+    PipelineLatency::mark(PipelineStage::DECISION);
 }
 
 void DifferentialProtection::reset()
 {
+    tripped_ = false;
 }
 
 void DifferentialProtection::setSettings(const DifferentialProtectionSettings& settings)
@@ -264,14 +539,12 @@ void DifferentialProtection::setSettings(const DifferentialProtectionSettings& s
     {
         throw std::invalid_argument("Invalid differential protection settings");
     }
-    std::lock_guard<std::mutex> lock(settingsMutex_);
-    settings_ = settings;
+    settings_.store(settings);
 }
 
 DifferentialProtectionSettings DifferentialProtection::getSettings() const
 {
-    std::lock_guard<std::mutex> lock(settingsMutex_);
-    return settings_;
+    return settings_.load();
 }
 
 void DifferentialProtection::setEnabled(const bool enabled) noexcept
@@ -288,20 +561,65 @@ void DifferentialProtection::onTrip(std::function<void(const DifferentialProtect
 {
     std::lock_guard<std::mutex> lock(callbackMutex_);
     callback_ = std::move(callback);
+    hasCallback_.store(static_cast<bool>(callback_), std::memory_order_release);
+}
+
+void DifferentialProtection::setTripDispatcher(TripEventDispatcher::Ptr dispatcher, const uint32_t elementId)
+{
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    elementId_ = elementId;
+    dispatcherRaw_.store(dispatcher.get(), std::memory_order_release);
+    dispatcher_ = std::move(dispatcher);
+}
+
+void DifferentialProtection::invokeCallBack(const DifferentialProtectionResult& result)
+{
+    const bool trip = result.trip;
+    const bool wasTripped = std::exchange(tripped_, trip);
+    if (!trip)
+    {
+        return;
+    }
+
+    // A standing fault yields one event per element: only the rising edge is published
+    TripEventDispatcher* dispatcher = wasTripped ? nullptr : dispatcherRaw_.load(std::memory_order_acquire);
+    if (dispatcher != nullptr)
+    {
+        TripEvent event;
+        event.source = TripSource::DIFFERENTIAL;
+        event.elementId = elementId_;
+        event.originNs = PipelineLatency::frameOrigin();
+        event.decisionNs = TripEvent::toNs(result.tripTime);
+        event.flags = result.instantaneous ? TripEvent::FLAG_INSTANTANEOUS : 0;
+        event.value = result.operatingCurrentA;
+        event.secondary = result.restraintCurrentA;
+        static_cast<void>(dispatcher->publish(event));
+    }
+
+    // The deprecated onTrip callback is the only locked step; skip it when none is registered
+    if (hasCallback_.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        if (callback_)
+        {
+            callback_(result);
+        }
+    }
 }
 
-bool DifferentialProtection::checkCharacteristic(const double operating, const double restraint) const noexcept
+bool DifferentialProtection::checkCharacteristic(const DifferentialProtectionSettings& settings, const double operating,
+                                                 const double restraint) noexcept
 {
-    if (operating < settings_.minOperatingCurrentA)
+    if (operating < settings.minOperatingCurrentA)
     {
         return false;
     }
 
-    if (restraint < settings_.minRestraintCurrentA)
+    if (restraint < settings.minRestraintCurrentA)
     {
-        return operating >= settings_.minOperatingCurrentA;
+        return operating >= settings.minOperatingCurrentA;
     }
 
-    const double slopeThreshold = restraint * (settings_.slopePercent / 100.0);
+    const double slopeThreshold = restraint * (settings.slopePercent / 100.0);
     return operating >= slopeThreshold;
 }
@@ -0,0 +1,407 @@
+#include "../include/sv/protection/ProtectionEngine.h"
+#include "../include/sv/core/alloc.h"
+#include "../include/sv/core/pipeline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <pthread.h>
+#include <sched.h>
+#include <stdexcept>
+
+using namespace sv;
+
+namespace
+{
+    /// @brief Generation polls before a waiting thread falls back to yield or futex wait
+    constexpr int SPIN_LIMIT = 4096;
+
+    /// @brief Partitions are aligned to this many relays so sweeps start on a vector boundary
+    constexpr size_t PARTITION_ALIGNMENT = 8;
+
+    void updateMax(std::atomic<uint64_t>& max, const uint64_t value) noexcept
+    {
+        uint64_t current = max.load(std::memory_order_relaxed);
+        while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+ProtectionEngine::Ptr ProtectionEngine::create(const size_t workers, const bool pinWorkers)
+{
+    if (workers == 0)
+    {
+        throw std::invalid_argument("Protection engine needs at least one worker");
+    }
+    return Ptr(new ProtectionEngine(workers, pinWorkers));
+}
+
+ProtectionEngine::ProtectionEngine(const size_t workers, const bool pinWorkers)
+    : pinWorkers_(pinWorkers)
+{
+    workers_.reserve(workers);
+    for (size_t w = 0; w < workers; ++w)
+    {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+ProtectionEngine::~ProtectionEngine()
+{
+    stop();
+}
+
+size_t ProtectionEngine::addRelay(const RelaySettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid relay settings");
+    }
+    if (isRunning())
+    {
+        throw std::logic_error("Relays cannot be added while the protection engine is running");
+    }
+
+    elementId_.push_back(settings.elementId);
+    distanceEnabled_.push_back(static_cast<uint8_t>(settings.distanceEnabled));
+
+    const DistanceProtectionSettings& distance = settings.distance;
+    voltageThreshold_.push_back(distance.voltageThresholdV * distance.voltageThresholdV);
+    currentThreshold_.push_back(distance.currentThresholdA * distance.currentThresholdA);
+    direction_.push_back(distance.directionForward ? 1.0 : -1.0);
+
+    // Same |Z|^2 and R|R| >= |Z|^2 cos|cos| formulation as DistanceProtection::updateBlock
+    const std::array<const DistanceZone*, 3> zones = {&distance.zone1, &distance.zone2, &distance.zone3};
+    for (size_t z = 0; z < zones.size(); ++z)
+    {
+        const double cosAngle = std::cos(zones[z]->angleRad);
+        reachSquared_[z].push_back(zones[z]->enabled ? zones[z]->reachOhm * zones[z]->reachOhm : -1.0);
+        cosSigned_[z].push_back(cosAngle * std::abs(cosAngle));
+        delayNs_[z].push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(zones[z]->delay).count());
+        zoneStartNs_[z].push_back(-1);
+    }
+
+    const DifferentialProtectionSettings& differential = settings.differential;
+    const double slope = differential.slopePercent / 100.0;
+    differentialEnabled_.push_back(static_cast<uint8_t>(differential.enabled));
+    slopeSquared_.push_back(slope * slope);
+    minOperatingSquared_.push_back(differential.minOperatingCurrentA * differential.minOperatingCurrentA);
+    minRestraintSquared_.push_back(differential.minRestraintCurrentA * differential.minRestraintCurrentA);
+    instantaneousSquared_.push_back(differential.instantaneousThresholdA * differential.instantaneousThresholdA);
+
+    impedanceSquared_.push_back(0.0);
+    operatingSquared_.push_back(0.0);
+    trips_.push_back(0);
+    previousTrips_.push_back(0);
+
+    partition();
+    return trips_.size() - 1;
+}
+
+void ProtectionEngine::setTripDispatcher(TripEventDispatcher::Ptr dispatcher)
+{
+    if (isRunning())
+    {
+        throw std::logic_error("The dispatcher cannot be changed while the protection engine is running");
+    }
+    dispatcher_ = std::move(dispatcher);
+}
+
+void ProtectionEngine::start()
+{
+    if (running_.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    partition();
+    completed_.store(0, std::memory_order_relaxed);
+    const uint64_t generation = generation_.load(std::memory_order_acquire);
+    for (size_t w = 1; w < workers_.size(); ++w)
+    {
+        threads_.emplace_back(&ProtectionEngine::workerLoop, this, w, generation);
+    }
+}
+
+void ProtectionEngine::stop()
+{
+    if (!running_.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+    for (auto& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    threads_.clear();
+}
+
+bool ProtectionEngine::isRunning() const noexcept
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+void ProtectionEngine::evaluate(const std::span<const std::complex<double>> voltagesV,
+                                const std::span<const std::complex<double>> currentsA,
+                                const std::span<const std::complex<double>> remoteCurrentsA,
+                                const int64_t timestampNs)
+{
+    const size_t relays = trips_.size();
+    if (voltagesV.size() != relays || currentsA.size() != relays || remoteCurrentsA.size() != relays)
+    {
+        throw std::invalid_argument("Protection engine inputs must have one entry per relay");
+    }
+
+    voltages_ = voltagesV.data();
+    currents_ = currentsA.data();
+    remoteCurrents_ = remoteCurrentsA.data();
+    timestampNs_ = timestampNs;
+    originNs_ = PipelineLatency::frameOrigin();
+
+    if (!isRunning() || workers_.size() == 1)
+    {
+        for (const auto& worker : workers_)
+        {
+            runPartition(*worker);
+        }
+        PipelineLatency::mark(PipelineStage::DECISION);
+        return;
+    }
+
+    // The release increment publishes the input pointers; workers acknowledge through completed_
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+
+    runPartition(*workers_[0]);
+
+    const size_t expected = workers_.size() - 1;
+    int spins = 0;
+    while (completed_.load(std::memory_order_acquire) != expected)
+    {
+        if (++spins > SPIN_LIMIT)
+        {
+            std::this_thread::yield();
+        }
+    }
+    completed_.store(0, std::memory_order_relaxed);
+    PipelineLatency::mark(PipelineStage::DECISION);
+}
+
+std::span<const uint8_t> ProtectionEngine::getTrips() const noexcept
+{
+    return trips_;
+}
+
+void ProtectionEngine::reset() noexcept
+{
+    for (auto& start : zoneStartNs_)
+    {
+        std::fill(start.begin(), start.end(), -1);
+    }
+    std::fill(trips_.begin(), trips_.end(), 0);
+    std::fill(previousTrips_.begin(), previousTrips_.end(), 0);
+}
+
+size_t ProtectionEngine::getRelayCount() const noexcept
+{
+    return trips_.size();
+}
+
+size_t ProtectionEngine::getWorkerCount() const noexcept
+{
+    return workers_.size();
+}
+
+EngineWorkerStats ProtectionEngine::getWorkerStats(const size_t worker) const
+{
+    const Worker& source = *workers_.at(worker);
+
+    EngineWorkerStats stats;
+    stats.worker = worker;
+    stats.cpu = source.cpu.load(std::memory_order_relaxed);
+    stats.relays = source.end - source.begin;
+    stats.sweeps = source.sweeps.load(std::memory_order_relaxed);
+    stats.totalNs = source.totalNs.load(std::memory_order_relaxed);
+    stats.maxNs = source.maxNs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ProtectionEngine::resetStats() noexcept
+{
+    for (const auto& worker : workers_)
+    {
+        worker->sweeps.store(0, std::memory_order_relaxed);
+        worker->totalNs.store(0, std::memory_order_relaxed);
+        worker->maxNs.store(0, std::memory_order_relaxed);
+    }
+}
+
+void ProtectionEngine::partition() noexcept
+{
+    const size_t relays = trips_.size();
+    const size_t workers = workers_.size();
+    const size_t blocks = (relays + PARTITION_ALIGNMENT - 1) / PARTITION_ALIGNMENT;
+
+    for (size_t w = 0; w < workers; ++w)
+    {
+        workers_[w]->begin = std::min(relays, blocks * w / workers * PARTITION_ALIGNMENT);
+        workers_[w]->end = std::min(relays, blocks * (w + 1) / workers * PARTITION_ALIGNMENT);
+    }
+}
+
+void ProtectionEngine::runPartition(Worker& worker) noexcept
+{
+    const AllocationScopeGuard scope(AllocationScope::PROTECT);
+
+    if (worker.begin == worker.end)
+    {
+        return;
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    sweep(worker.begin, worker.end);
+    const auto end = std::chrono::steady_clock::now();
+
+    const auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    worker.sweeps.fetch_add(1, std::memory_order_relaxed);
+    worker.totalNs.fetch_add(elapsed, std::memory_order_relaxed);
+    updateMax(worker.maxNs, elapsed);
+    worker.cpu.store(sched_getcpu(), std::memory_order_relaxed);
+
+    // Only rising edges are published so a standing fault yields one event per element
+    const int64_t decisionNs = TripEvent::toNs(end);
+    for (size_t k = worker.begin; k < worker.end; ++k)
+    {
+        const uint8_t rising = trips_[k] & ~previousTrips_[k];
+        previousTrips_[k] = trips_[k];
+        if (!rising || !dispatcher_)
+        {
+            continue;
+        }
+
+        TripEvent event;
+        event.originNs = originNs_;
+        event.decisionNs = decisionNs;
+        event.elementId = elementId_[k];
+
+        const uint8_t zones = rising & (TRIP_ZONE1 | TRIP_ZONE2 | TRIP_ZONE3);
+        if (zones)
+        {
+            event.source = TripSource::DISTANCE;
+            static_assert(TRIP_ZONE1 == TripEvent::FLAG_ZONE1 && TRIP_ZONE2 == TripEvent::FLAG_ZONE2 &&
+                          TRIP_ZONE3 == TripEvent::FLAG_ZONE3, "Engine zone bits are published as TripEvent flags");
+            event.flags = zones;
+            event.value = std::sqrt(impedanceSquared_[k]);
+            static_cast<void>(dispatcher_->publish(event));
+        }
+        if (rising & TRIP_DIFFERENTIAL)
+        {
+            event.source = TripSource::DIFFERENTIAL;
+            event.flags = (trips_[k] & TRIP_INSTANTANEOUS) ? TripEvent::FLAG_INSTANTANEOUS : 0;
+            event.value = std::sqrt(operatingSquared_[k]);
+            static_cast<void>(dispatcher_->publish(event));
+        }
+    }
+}
+
+void ProtectionEngine::sweep(const size_t begin, const size_t end) noexcept
+{
+    const std::complex<double>* v = voltages_;
+    const std::complex<double>* i = currents_;
+    const std::complex<double>* remote = remoteCurrents_;
+    const int64_t now = timestampNs_;
+
+    for (size_t k = begin; k < end; ++k)
+    {
+        const double vr = v[k].real();
+        const double vi = v[k].imag();
+        const double ir = i[k].real();
+        const double ii = i[k].imag();
+
+        // Distance: the DistanceProtection::updateBlock flags pass, with the settings read per relay
+        const double currentSquared = ir * ir + ii * ii;
+        const bool supervised = (vr * vr + vi * vi >= voltageThreshold_[k]) & (currentSquared >= currentThreshold_[k]);
+        const double scale = 1.0 / std::max(currentSquared, currentThreshold_[k]);
+
+        const double r = (vr * ir + vi * ii) * scale;
+        const double x = (vi * ir - vr * ii) * scale;
+        const double m = r * r + x * x;
+        const double rSigned = r * std::abs(r);
+        const bool armed = (distanceEnabled_[k] != 0) & supervised & (r * direction_[k] > 0.0);
+        impedanceSquared_[k] = m;
+
+        // Zone timers hold the sample time of pickup, -1 while dropped out
+        uint8_t trip = 0;
+        for (size_t z = 0; z < 3; ++z)
+        {
+            const bool pickup = armed & (m <= reachSquared_[z][k]) & (rSigned >= m * cosSigned_[z][k]);
+            const int64_t start = zoneStartNs_[z][k];
+            const int64_t running = start < 0 ? now : start;
+            zoneStartNs_[z][k] = pickup ? running : -1;
+            trip |= static_cast<uint8_t>(pickup & (now - running >= delayNs_[z][k])) << z;
+        }
+
+        // Differential: operating |I1 - I2| against the restraint (I1 + I2) / 2
+        const double opR = ir - remote[k].real();
+        const double opI = ii - remote[k].imag();
+        const double resR = 0.5 * (ir + remote[k].real());
+        const double resI = 0.5 * (ii + remote[k].imag());
+        const double op = opR * opR + opI * opI;
+        const double res = resR * resR + resI * resI;
+
+        const bool differentialEnabled = differentialEnabled_[k] != 0;
+        const bool instant = differentialEnabled & (op >= instantaneousSquared_[k]);
+        const bool characteristic = differentialEnabled & (op >= minOperatingSquared_[k]) &
+                                    ((res < minRestraintSquared_[k]) | (op >= res * slopeSquared_[k]));
+        operatingSquared_[k] = op;
+
+        trip |= static_cast<uint8_t>(instant | characteristic) * TRIP_DIFFERENTIAL;
+        trip |= static_cast<uint8_t>(instant) * TRIP_INSTANTANEOUS;
+        trips_[k] = trip;
+    }
+}
+
+void ProtectionEngine::workerLoop(const size_t index, uint64_t seen)
+{
+    Worker& worker = *workers_[index];
+
+    if (pinWorkers_)
+    {
+        const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(index % cpus, &set);
+        static_cast<void>(pthread_setaffinity_np(pthread_self(), sizeof(set), &set));
+    }
+    worker.cpu.store(sched_getcpu(), std::memory_order_relaxed);
+
+    while (true)
+    {
+        // Samples arrive every few hundred microseconds, so spin briefly before sleeping on the futex
+        uint64_t current = generation_.load(std::memory_order_acquire);
+        for (int spins = 0; current == seen && spins < SPIN_LIMIT; ++spins)
+        {
+            current = generation_.load(std::memory_order_acquire);
+        }
+        while (current == seen)
+        {
+            generation_.wait(seen, std::memory_order_acquire);
+            current = generation_.load(std::memory_order_acquire);
+        }
+        seen = current;
+
+        if (!running_.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        runPartition(worker);
+        completed_.fetch_add(1, std::memory_order_acq_rel);
+    }
+}
@@ -0,0 +1,169 @@
+#include "../include/sv/protection/SequenceProtection.h"
+#include "../include/sv/core/alloc.h"
+#include "../include/sv/core/pipeline.h"
+#include <stdexcept>
+#include <utility>
+
+using namespace sv;
+
+SequenceProtection::Ptr SequenceProtection::create(const SequenceProtectionSettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid sequence protection settings");
+    }
+    return Ptr(new SequenceProtection(settings));
+}
+
+SequenceProtection::SequenceProtection(const SequenceProtectionSettings& settings)
+    : settings_(settings)
+{
+}
+
+SequenceProtectionResult SequenceProtection::update(const ThreePhaseMeasurement& measurement)
+{
+    return update(measurement, std::chrono::steady_clock::now().time_since_epoch());
+}
+
+SequenceProtectionResult SequenceProtection::update(const ThreePhaseMeasurement& measurement,
+                                                    const std::chrono::nanoseconds sampleTime)
+{
+    const AllocationScopeGuard scope(AllocationScope::PROTECT);
+
+    SequenceProtectionResult result;
+    result.sampleTime = sampleTime;
+
+    if (!enabled_.load(std::memory_order_acquire))
+    {
+        return result;
+    }
+
+    const auto settings = settings_.read();
+
+    const SequenceComponents& current = measurement.getCurrentSequence();
+    const double negative = std::abs(current.negative);
+    const double positive = std::abs(current.positive);
+    result.negativeSequenceA = negative;
+    result.residualA = current.residual();
+
+    const bool ratioMet = settings->minNegativeToPositiveRatio <= 0.0 ||
+                          negative >= settings->minNegativeToPositiveRatio * positive;
+    const bool negativePickup = negative >= settings->negativeSequence.pickupA && ratioMet;
+    const bool earthFaultPickup = result.residualA >= settings->earthFault.pickupA;
+
+    result.negativeSequenceTrip = evaluate(settings->negativeSequence, negativePickup, negativeSequenceTimer_, sampleTime);
+    result.earthFaultTrip = evaluate(settings->earthFault, earthFaultPickup, earthFaultTimer_, sampleTime);
+
+    if (result.negativeSequenceTrip || result.earthFaultTrip)
+    {
+        result.tripTime = std::chrono::steady_clock::now();
+    }
+    invokeCallBack(result);
+
+    PipelineLatency::mark(PipelineStage::DECISION);
+    return result;
+}
+
+bool SequenceProtection::evaluate(const SequenceElementSettings& element, const bool pickedUp, ElementTimer& timer,
+                                  const std::chrono::nanoseconds now) noexcept
+{
+    if (!element.enabled || !pickedUp)
+    {
+        timer.active = false;
+        return false;
+    }
+
+    if (!timer.active)
+    {
+        timer.active = true;
+        timer.startTime = now;
+    }
+
+    return now - timer.startTime >= element.delay;
+}
+
+void SequenceProtection::reset()
+{
+    negativeSequenceTimer_.active = false;
+    earthFaultTimer_.active = false;
+    tripped_ = false;
+}
+
+void SequenceProtection::setSettings(const SequenceProtectionSettings& settings)
+{
+    if (!settings.isValid())
+    {
+        throw std::invalid_argument("Invalid sequence protection settings");
+    }
+    settings_.store(settings);
+}
+
+SequenceProtectionSettings SequenceProtection::getSettings() const
+{
+    return settings_.load();
+}
+
+void SequenceProtection::setEnabled(const bool enabled) noexcept
+{
+    enabled_.store(enabled, std::memory_order_release);
+    if (!enabled)
+    {
+        reset();
+    }
+}
+
+bool SequenceProtection::isEnabled() const noexcept
+{
+    return enabled_.load(std::memory_order_acquire);
+}
+
+void SequenceProtection::onTrip(std::function<void(const SequenceProtectionResult&)> callback)
+{
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    callback_ = std::move(callback);
+    hasCallback_.store(static_cast<bool>(callback_), std::memory_order_release);
+}
+
+void SequenceProtection::setTripDispatcher(TripEventDispatcher::Ptr dispatcher, const uint32_t elementId)
+{
+    std::lock_guard<std::mutex> lock(callbackMutex_);
+    elementId_ = elementId;
+    dispatcherRaw_.store(dispatcher.get(), std::memory_order_release);
+    dispatcher_ = std::move(dispatcher);
+}
+
+void SequenceProtection::invokeCallBack(const SequenceProtectionResult& result)
+{
+    const bool trip = result.negativeSequenceTrip || result.earthFaultTrip;
+    const bool wasTripped = std::exchange(tripped_, trip);
+    if (!trip)
+    {
+        return;
+    }
+
+    // A standing fault yields one event per element: only the rising edge is published
+    TripEventDispatcher* dispatcher = wasTripped ? nullptr : dispatcherRaw_.load(std::memory_order_acquire);
+    if (dispatcher != nullptr)
+    {
+        TripEvent event;
+        event.source = TripSource::SEQUENCE;
+        event.elementId = elementId_;
+        event.originNs = PipelineLatency::frameOrigin();
+        event.decisionNs = TripEvent::toNs(result.tripTime);
+        event.flags = static_cast<uint8_t>((result.negativeSequenceTrip ? TripEvent::FLAG_NEGATIVE_SEQUENCE : 0u) |
+                                           (result.earthFaultTrip ? TripEvent::FLAG_EARTH_FAULT : 0u));
+        event.value = result.negativeSequenceA;
+        event.secondary = result.residualA;
+        static_cast<void>(dispatcher->publish(event));
+    }
+
+    // The deprecated onTrip callback is the only locked step; skip it when none is registered
+    if (hasCallback_.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock(callbackMutex_);
+        if (callback_)
+        {
+            callback_(result);
+        }
+    }
+}
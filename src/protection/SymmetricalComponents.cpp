@@ -0,0 +1,52 @@
+#include "../include/sv/protection/SymmetricalComponents.h"
+#include "../include/sv/protection/PhasorEstimator.h"
+#include "../include/sv/protection/PhasorKernel.h"
+
+using namespace sv;
+
+void ThreePhaseMeasurement::update(const std::span<const std::complex<double>, 3> currents,
+                                   const std::span<const std::complex<double>, 3> voltages) noexcept
+{
+    for (size_t phase = 0; phase < 3; ++phase)
+    {
+        currents_[phase] = currents[phase];
+        voltages_[phase] = voltages[phase];
+    }
+    currentSequence_ = SequenceComponents::fromPhases(currents_[0], currents_[1], currents_[2]);
+    voltageSequence_ = SequenceComponents::fromPhases(voltages_[0], voltages_[1], voltages_[2]);
+}
+
+void ThreePhaseMeasurement::update(const PhasorEstimator& estimator) noexcept
+{
+    const std::array<std::complex<double>, 3> currents = {estimator.getCurrent(0), estimator.getCurrent(1), estimator.getCurrent(2)};
+    const std::array<std::complex<double>, 3> voltages = {estimator.getVoltage(0), estimator.getVoltage(1), estimator.getVoltage(2)};
+    update(currents, voltages);
+}
+
+void ThreePhaseMeasurement::update(const PhasorKernel& kernel) noexcept
+{
+    constexpr size_t v = PhasorKernel::FIRST_VOLTAGE_CHANNEL;
+    const std::array<std::complex<double>, 3> currents = {kernel.getPhasor(0), kernel.getPhasor(1), kernel.getPhasor(2)};
+    const std::array<std::complex<double>, 3> voltages = {kernel.getPhasor(v), kernel.getPhasor(v + 1), kernel.getPhasor(v + 2)};
+    update(currents, voltages);
+}
+
+std::complex<double> ThreePhaseMeasurement::getPhaseCurrent(const size_t phase) const noexcept
+{
+    return phase < 3 ? currents_[phase] : std::complex<double>{};
+}
+
+std::complex<double> ThreePhaseMeasurement::getPhaseVoltage(const size_t phase) const noexcept
+{
+    return phase < 3 ? voltages_[phase] : std::complex<double>{};
+}
+
+const SequenceComponents& ThreePhaseMeasurement::getCurrentSequence() const noexcept
+{
+    return currentSequence_;
+}
+
+const SequenceComponents& ThreePhaseMeasurement::getVoltageSequence() const noexcept
+{
+    return voltageSequence_;
+}
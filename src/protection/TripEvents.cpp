@@ -0,0 +1,132 @@
+#include "../include/sv/protection/TripEvents.h"
+#include "../include/sv/core/pipeline.h"
+
+using namespace sv;
+
+TripEventDispatcher::Ptr TripEventDispatcher::create(const size_t capacity)
+{
+    return Ptr(new TripEventDispatcher(capacity));
+}
+
+TripEventDispatcher::TripEventDispatcher(const size_t capacity)
+    : queue_(capacity)
+{
+}
+
+TripEventDispatcher::~TripEventDispatcher()
+{
+    stop();
+}
+
+bool TripEventDispatcher::publish(TripEvent event) noexcept
+{
+    event.sequence = sequence_.fetch_add(1, std::memory_order_relaxed);
+    event.enqueueNs = TripEvent::toNs(std::chrono::steady_clock::now());
+
+    if (!queue_.tryPush(event))
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    if (event.decisionNs > 0 && event.enqueueNs >= event.decisionNs)
+    {
+        enqueueLatency_.record(static_cast<uint64_t>(event.enqueueNs - event.decisionNs));
+    }
+
+    pending_.fetch_add(1, std::memory_order_release);
+    pending_.notify_one();
+    return true;
+}
+
+void TripEventDispatcher::subscribe(Subscriber subscriber)
+{
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    subscribers_.push_back(std::move(subscriber));
+}
+
+void TripEventDispatcher::start()
+{
+    if (running_.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    thread_ = std::thread(&TripEventDispatcher::run, this);
+}
+
+void TripEventDispatcher::stop()
+{
+    if (!running_.exchange(false, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    pending_.fetch_add(1, std::memory_order_release);
+    pending_.notify_one();
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+    static_cast<void>(drain());
+}
+
+bool TripEventDispatcher::isRunning() const noexcept
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+size_t TripEventDispatcher::drain()
+{
+    size_t delivered = 0;
+    TripEvent event;
+
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    while (queue_.tryPop(event))
+    {
+        const int64_t now = TripEvent::toNs(std::chrono::steady_clock::now());
+        if (now >= event.enqueueNs)
+        {
+            dispatchLatency_.record(static_cast<uint64_t>(now - event.enqueueNs));
+        }
+
+        for (const auto& subscriber : subscribers_)
+        {
+            subscriber(event);
+        }
+        PipelineLatency::recordSince(PipelineStage::TRIP, event.originNs);
+        ++delivered;
+    }
+    return delivered;
+}
+
+void TripEventDispatcher::run()
+{
+    while (running_.load(std::memory_order_acquire))
+    {
+        const uint64_t seen = pending_.load(std::memory_order_acquire);
+        if (drain() == 0)
+        {
+            pending_.wait(seen, std::memory_order_acquire);
+        }
+    }
+}
+
+const LatencyHistogram& TripEventDispatcher::getEnqueueLatency() const noexcept
+{
+    return enqueueLatency_;
+}
+
+const LatencyHistogram& TripEventDispatcher::getDispatchLatency() const noexcept
+{
+    return dispatchLatency_;
+}
+
+uint64_t TripEventDispatcher::getPublished() const noexcept
+{
+    return sequence_.load(std::memory_order_relaxed) - dropped_.load(std::memory_order_relaxed);
+}
+
+uint64_t TripEventDispatcher::getDropped() const noexcept
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
@@ -1,35 +1,223 @@
 #include "../include/sv/sim/Breaker.h"
+#include "../include/sv/sim/BreakerScheduler.h"
+#include "../include/sv/core/util.h"
 
+#include <algorithm>
 #include <iostream>
 #include <numeric>
 #include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace sv::sim;
+using sv::detail::toDuration;
+
+namespace
+{
+    constexpr char RESULT_MAGIC[8] = {'S', 'V', 'B', 'R', 'K', 'R', '0', '1'};
+
+    /// @brief Fixed part of an exported SimulationResult
+    struct ResultHeader
+    {
+        char magic[8];
+        uint64_t steps;
+        uint64_t transitions;
+        uint64_t tripOccurred;
+        double tripTime;
+    };
+
+    /// @brief Exported StateTransition
+    struct TransitionRecord
+    {
+        uint64_t step;
+        double time;
+        uint64_t state;
+    };
+
+    /// @brief Closes a file descriptor and unmaps a mapping on scope exit
+    struct Mapping
+    {
+        int fd{-1};
+        void* data{MAP_FAILED};
+        size_t size{0};
+
+        ~Mapping()
+        {
+            if (data != MAP_FAILED)
+            {
+                munmap(data, size);
+            }
+            if (fd >= 0)
+            {
+                ::close(fd);
+            }
+        }
+    };
+}
+
+void SimulationResult::reserve(const size_t steps)
+{
+    timePoints.reserve(steps);
+    currentValues.reserve(steps);
+}
+
+void SimulationResult::append(const double time, const double current, const BreakerState state)
+{
+    if (stateTransitions.empty() || stateTransitions.back().state != state)
+    {
+        stateTransitions.push_back({timePoints.size(), time, state});
+    }
+    timePoints.push_back(time);
+    currentValues.push_back(current);
+}
+
+size_t SimulationResult::size() const noexcept
+{
+    return timePoints.size();
+}
+
+BreakerState SimulationResult::stateAt(const size_t step) const
+{
+    if (step >= timePoints.size() || stateTransitions.empty())
+    {
+        throw std::out_of_range("Simulation step out of range");
+    }
+    const auto next = std::upper_bound(stateTransitions.begin(), stateTransitions.end(), step,
+                                       [](const size_t value, const StateTransition& transition) { return value < transition.step; });
+    return std::prev(next)->state;
+}
+
+void SimulationResult::exportBinary(const std::string& path) const
+{
+    const size_t steps = timePoints.size();
+    const size_t size = sizeof(ResultHeader) + 2 * steps * sizeof(double) + stateTransitions.size() * sizeof(TransitionRecord);
+
+    Mapping mapping;
+    mapping.fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (mapping.fd < 0 || ftruncate(mapping.fd, static_cast<off_t>(size)) != 0)
+    {
+        throw std::runtime_error("Cannot create simulation result file: " + path);
+    }
+    mapping.size = size;
+    mapping.data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, mapping.fd, 0);
+    if (mapping.data == MAP_FAILED)
+    {
+        throw std::runtime_error("Cannot map simulation result file: " + path);
+    }
+
+    auto* out = static_cast<char*>(mapping.data);
+    ResultHeader header{};
+    std::memcpy(header.magic, RESULT_MAGIC, sizeof(RESULT_MAGIC));
+    header.steps = steps;
+    header.transitions = stateTransitions.size();
+    header.tripOccurred = tripOccurred;
+    header.tripTime = tripTime;
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    std::memcpy(out, timePoints.data(), steps * sizeof(double));
+    out += steps * sizeof(double);
+    std::memcpy(out, currentValues.data(), steps * sizeof(double));
+    out += steps * sizeof(double);
+    for (const auto& transition : stateTransitions)
+    {
+        const TransitionRecord record{transition.step, transition.time, static_cast<uint64_t>(transition.state)};
+        std::memcpy(out, &record, sizeof(record));
+        out += sizeof(record);
+    }
+
+    if (msync(mapping.data, size, MS_SYNC) != 0)
+    {
+        throw std::runtime_error("Cannot write simulation result file: " + path);
+    }
+}
+
+SimulationResult SimulationResult::importBinary(const std::string& path)
+{
+    Mapping mapping;
+    struct stat info{};
+    mapping.fd = ::open(path.c_str(), O_RDONLY);
+    if (mapping.fd < 0 || fstat(mapping.fd, &info) != 0)
+    {
+        throw std::runtime_error("Cannot open simulation result file: " + path);
+    }
+
+    const auto size = static_cast<size_t>(info.st_size);
+    ResultHeader header{};
+    if (size >= sizeof(header))
+    {
+        mapping.size = size;
+        mapping.data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, mapping.fd, 0);
+    }
+    if (mapping.data == MAP_FAILED)
+    {
+        throw std::runtime_error("Not a simulation result file: " + path);
+    }
+
+    const auto* in = static_cast<const char*>(mapping.data);
+    std::memcpy(&header, in, sizeof(header));
+    const bool complete = header.steps <= size / (2 * sizeof(double)) && header.transitions <= size / sizeof(TransitionRecord) &&
+                          size == sizeof(header) + 2 * header.steps * sizeof(double) + header.transitions * sizeof(TransitionRecord);
+    if (std::memcmp(header.magic, RESULT_MAGIC, sizeof(RESULT_MAGIC)) != 0 || !complete)
+    {
+        throw std::runtime_error("Not a simulation result file: " + path);
+    }
+    in += sizeof(header);
+
+    SimulationResult result;
+    result.tripOccurred = header.tripOccurred != 0;
+    result.tripTime = header.tripTime;
+    result.timePoints.resize(header.steps);
+    result.currentValues.resize(header.steps);
+    std::memcpy(result.timePoints.data(), in, header.steps * sizeof(double));
+    in += header.steps * sizeof(double);
+    std::memcpy(result.currentValues.data(), in, header.steps * sizeof(double));
+    in += header.steps * sizeof(double);
+
+    result.stateTransitions.resize(header.transitions);
+    for (auto& transition : result.stateTransitions)
+    {
+        TransitionRecord record{};
+        std::memcpy(&record, in, sizeof(record));
+        in += sizeof(record);
+        transition = {record.step, record.time, static_cast<BreakerState>(record.state)};
+    }
+    return result;
+}
 
 BreakerModel::BreakerPtr BreakerModel::create()
 {
-    return BreakerPtr(new BreakerModel());
+    return BreakerPtr(new BreakerModel(BreakerDefinition(), BreakerClock::SIMULATED));
 }
 
 BreakerModel::BreakerPtr BreakerModel::create(const BreakerDefinition &definition)
 {
-    return BreakerPtr(new BreakerModel(definition));
+    return BreakerPtr(new BreakerModel(definition, BreakerClock::SIMULATED));
 }
 
-BreakerModel::BreakerModel()
-    : definition_()
+BreakerModel::BreakerPtr BreakerModel::create(const BreakerDefinition &definition, const BreakerClock clock)
 {
-    startSimulation();
+    return BreakerPtr(new BreakerModel(definition, clock));
 }
 
-BreakerModel::BreakerModel(const BreakerDefinition &definition)
-    : definition_(definition)
+BreakerModel::BreakerModel(const BreakerDefinition &definition, const BreakerClock clock)
+    : clock_(clock)
+    , definition_(definition)
 {
     if (!definition.isValid())
     {
         throw std::invalid_argument("Invalid BreakerDefinition provided");
     }
-    startSimulation();
+    if (clock_ == BreakerClock::REAL_TIME)
+    {
+        startSimulation();
+    }
 }
 
 BreakerModel::~BreakerModel()
@@ -90,10 +278,7 @@ bool BreakerModel::open()
         return false;
     }
 
-    transitionToState(BreakerState::OPENING);
-    targetState_ = BreakerState::OPEN;
-    transitionDuration_ = definition_.openTimeSec;
-    transitionStartTime_ = std::chrono::steady_clock::now();
+    beginTransition(BreakerState::OPEN, definition_.openTimeSec);
 
     return true;
 }
@@ -113,10 +298,7 @@ bool BreakerModel::close()
         return false;
     }
 
-    transitionToState(BreakerState::CLOSING);
-    targetState_ = BreakerState::CLOSED;
-    transitionDuration_ = definition_.closeTimeSec;
-    transitionStartTime_ = std::chrono::steady_clock::now();
+    beginTransition(BreakerState::CLOSED, definition_.closeTimeSec);
 
     return true;
 }
@@ -182,9 +364,9 @@ double BreakerModel::getResistance() const
     }
     else if (isInTransition())
     {
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration<double>(now - transitionStartTime_).count();
-        const double progress = std::clamp(elapsed / transitionDuration_, 0.0, 1.0);
+        const auto elapsed = getTime() - transitionStartTime_;
+        const double progress = std::clamp(static_cast<double>(elapsed.count()) /
+                                           static_cast<double>(transitionDuration_.count()), 0.0, 1.0);
         constexpr double arcResistanceMuliplier = 100.0;
         const double baseResistance = definition_.resistanceOhm;
         const double arcResistance = definition_.arcResistanceOhm;
@@ -206,8 +388,7 @@ double BreakerModel::getArcVoltage() const
 {
     if (isInTransition() && std::abs(currentA_.load()) > 1.0)
     {
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration<double>(now - transitionStartTime_).count();
+        const double elapsed = std::chrono::duration<double>(getTime() - transitionStartTime_).count();
 
         if (elapsed < definition_.arcDurationSec)
         {
@@ -248,46 +429,103 @@ void BreakerModel::onStateChange(BreakerCallback callback)
     callback_ = std::move(callback);
 }
 
-void BreakerModel::startSimulation()
+void BreakerModel::step(const std::chrono::nanoseconds dt)
 {
-    if (running_.load())
+    if (isScheduled())
+    {
+        throw std::logic_error("A breaker driven by a scheduler cannot be stepped");
+    }
+    if (dt.count() < 0)
     {
-        return;
+        throw std::invalid_argument("Time step must not be negative");
     }
 
-    running_.store(true);
-    simulationThread_ = std::thread(&BreakerModel::simulationLoop, this);
+    simulatedTimeNs_.fetch_add(dt.count(), std::memory_order_acq_rel);
+    advance();
+}
+
+std::chrono::nanoseconds BreakerModel::getTime() const
+{
+    if (const auto* scheduler = scheduler_.load(std::memory_order_acquire))
+    {
+        return scheduler->now();
+    }
+    return std::chrono::nanoseconds(simulatedTimeNs_.load(std::memory_order_acquire));
+}
+
+BreakerClock BreakerModel::getClock() const
+{
+    return clock_;
+}
+
+bool BreakerModel::isScheduled() const
+{
+    return scheduler_.load(std::memory_order_acquire) != nullptr;
+}
+
+void BreakerModel::startSimulation()
+{
+    if (!isScheduled())
+    {
+        BreakerScheduler::shared().attachModel(*this);
+    }
 }
 
 void BreakerModel::stopSimulation()
 {
-    running_.store(false);
-    if (simulationThread_.joinable())
+    if (auto* scheduler = scheduler_.load(std::memory_order_acquire))
+    {
+        scheduler->detachModel(*this);
+    }
+}
+
+void BreakerModel::advance()
+{
+    const auto now = getTime();
+    const auto dt = now - lastUpdateTime_;
+    lastUpdateTime_ = now;
+    updateState(dt);
+}
+
+void BreakerModel::beginTransition(const BreakerState target, const double durationSec)
+{
+    targetState_ = target;
+    transitionDuration_ = toDuration(durationSec);
+    transitionStartTime_ = getTime();
+    lastUpdateTime_ = transitionStartTime_;
+    transitionToState(target == BreakerState::OPEN ? BreakerState::OPENING : BreakerState::CLOSING);
+
+    if (auto* scheduler = scheduler_.load(std::memory_order_acquire))
     {
-        simulationThread_.join();
+        scheduler->schedule(*this);
     }
 }
 
-void BreakerModel::simulationLoop()
+std::chrono::nanoseconds BreakerModel::nextUpdateTime(const std::chrono::nanoseconds tick) const
 {
-    while (running_.load())
+    const auto state = state_.load();
+    if (state != BreakerState::OPENING && state != BreakerState::CLOSING)
     {
-        updateState();
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::chrono::nanoseconds(-1);
     }
+
+    // The arc current decays continuously, so an opening breaker with current is updated every tick
+    const auto deadline = transitionStartTime_ + transitionDuration_;
+    if (state == BreakerState::OPENING && currentA_.load() > 0.0)
+    {
+        return std::min(deadline, lastUpdateTime_ + tick);
+    }
+    return deadline;
 }
 
-void BreakerModel::updateState()
+void BreakerModel::updateState(const std::chrono::nanoseconds dt)
 {
     const auto currentState = state_.load();
 
     if (currentState == BreakerState::OPENING ||
         currentState == BreakerState::CLOSING)
     {
-        const auto now = std::chrono::steady_clock::now();
-        const auto elapsed = std::chrono::duration<double>(now - transitionStartTime_).count();
-
-        if (elapsed >= transitionDuration_)
+        if (getTime() - transitionStartTime_ >= transitionDuration_)
         {
             transitionToState(targetState_);
 
@@ -301,7 +539,7 @@ void BreakerModel::updateState()
     if (currentState == BreakerState::OPENING && currentA_.load() > 0.0)
     {
         const double arcDecayRate = currentA_.load() / definition_.arcDurationSec;
-        const double newCurrent = std::max(0.0, currentA_.load() - arcDecayRate * 0.01);
+        const double newCurrent = std::max(0.0, currentA_.load() - arcDecayRate * std::chrono::duration<double>(dt).count());
         currentA_.store(newCurrent);
     }
 }
@@ -331,12 +569,31 @@ SimulationResult BreakerModel::runSimulation(
         throw std::invalid_argument("Invalid simulation parameters provided");
     }
 
+    const bool simulated = !isScheduled();
+    const auto timeStep = toDuration(timeStepS);
+    if (simulated && timeStep.count() <= 0)
+    {
+        throw std::invalid_argument("Time step is below the simulated clock resolution");
+    }
+
     SimulationResult result;
     result.tripOccurred = false;
     result.tripTime = 0.0;
 
-    close();
-    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(definition_.closeTimeSec * 1000 + 50)));
+    if (close())
+    {
+        if (simulated)
+        {
+            step(transitionDuration_);
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(definition_.closeTimeSec * 1000 + 50)));
+        }
+    }
+
+    // One spare slot covers the rounding of the accumulated step time
+    result.reserve(static_cast<size_t>(std::ceil(durationS / timeStepS)) + 1);
 
     double timeElapsed = 0.0;
     bool faultInjected = false;
@@ -349,7 +606,10 @@ SimulationResult BreakerModel::runSimulation(
         {
             current = faultCurrentA;
             faultInjected = true;
-            std::cout << "Fault injected at t=" << timeElapsed << "s, current=" << current << "A" << std::endl;
+            if (!simulated)
+            {
+                std::cout << "Fault injected at t=" << timeElapsed << "s, current=" << current << "A" << std::endl;
+            }
         }
         else if (faultInjected)
         {
@@ -365,28 +625,42 @@ SimulationResult BreakerModel::runSimulation(
             setCurrent(0.0);
         }
 
-        result.timePoints.push_back(timeElapsed);
-        result.currentValues.push_back(getCurrent());
-        result.stateHistory.push_back(getState());
+        result.append(timeElapsed, getCurrent(), getState());
 
         if (!result.tripOccurred && isOpen() && timeElapsed > 0.0)
         {
             result.tripOccurred = true;
             result.tripTime = timeElapsed;
-            std::cout << "Breaker tripped at t=" << timeElapsed << "s" << std::endl;
+            if (!simulated)
+            {
+                std::cout << "Breaker tripped at t=" << timeElapsed << "s" << std::endl;
+            }
         }
 
-        std::this_thread::sleep_for(std::chrono::duration<double>(timeStepS));
+        if (simulated)
+        {
+            step(timeStep);
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::duration<double>(timeStepS));
+        }
         timeElapsed += timeStepS;
     }
 
+    std::ostringstream summary;
     if (result.tripOccurred)
     {
-        std::cout << "Simulation completed: Breaker tripped at t=" << result.tripTime << "s" << std::endl;
+        summary << "Simulation completed: Breaker tripped at t=" << result.tripTime << "s";
     }
     else
     {
-        std::cout << "Simulation completed: Breaker did not trip." << std::endl;
+        summary << "Simulation completed: Breaker did not trip.";
+    }
+    result.summary = summary.str();
+    if (!simulated)
+    {
+        std::cout << result.summary << std::endl;
     }
 
     return result;
@@ -0,0 +1,293 @@
+#include "../include/sv/sim/BreakerScheduler.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace sv::sim;
+
+BreakerScheduler::Ptr BreakerScheduler::create(const std::chrono::nanoseconds tick, const size_t slots)
+{
+    if (tick.count() <= 0 || slots == 0)
+    {
+        throw std::invalid_argument("Scheduler tick and slot count must be positive");
+    }
+    return Ptr(new BreakerScheduler(tick, slots));
+}
+
+BreakerScheduler& BreakerScheduler::shared()
+{
+    static const Ptr instance = []
+    {
+        auto scheduler = create();
+        scheduler->start();
+        return scheduler;
+    }();
+    return *instance;
+}
+
+BreakerScheduler::BreakerScheduler(const std::chrono::nanoseconds tick, const size_t slots)
+    : tick_(tick)
+    , wheel_(slots)
+{
+}
+
+BreakerScheduler::~BreakerScheduler()
+{
+    stop();
+
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    const auto time = now();
+    for (const auto& [breaker, dueTick] : breakers_)
+    {
+        breaker->simulatedTimeNs_.store(time.count(), std::memory_order_release);
+        breaker->scheduler_.store(nullptr, std::memory_order_release);
+    }
+    breakers_.clear();
+}
+
+void BreakerScheduler::attach(const BreakerModel::BreakerPtr& breaker)
+{
+    if (breaker)
+    {
+        attachModel(*breaker);
+    }
+}
+
+void BreakerScheduler::detach(const BreakerModel::BreakerPtr& breaker)
+{
+    if (breaker)
+    {
+        detachModel(*breaker);
+    }
+}
+
+void BreakerScheduler::attachModel(BreakerModel& breaker)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    const auto* current = breaker.scheduler_.load(std::memory_order_acquire);
+    if (current == this)
+    {
+        return;
+    }
+    if (current != nullptr)
+    {
+        throw std::logic_error("Breaker is already driven by another scheduler");
+    }
+    if (breaker.isInTransition())
+    {
+        throw std::logic_error("Cannot attach a breaker during a transition");
+    }
+
+    breaker.lastUpdateTime_ = now();
+    breakers_.emplace(&breaker, 0);
+    breaker.scheduler_.store(this, std::memory_order_release);
+}
+
+void BreakerScheduler::detachModel(BreakerModel& breaker)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    const auto it = breakers_.find(&breaker);
+    if (it == breakers_.end())
+    {
+        return;
+    }
+    if (it->second != 0)
+    {
+        --pending_;
+    }
+    breakers_.erase(it);
+
+    // The breaker keeps counting from the scheduler time, so a running transition stays consistent
+    breaker.simulatedTimeNs_.store(now().count(), std::memory_order_release);
+    breaker.scheduler_.store(nullptr, std::memory_order_release);
+}
+
+void BreakerScheduler::schedule(BreakerModel& breaker)
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    const auto it = breakers_.find(&breaker);
+    if (it == breakers_.end())
+    {
+        return;
+    }
+
+    // With nothing pending the wheel may lag behind the clock; skip the empty ticks
+    const int64_t tick = tick_.count();
+    if (pending_ == 0)
+    {
+        currentTick_ = std::max(currentTick_, static_cast<uint64_t>(now().count() / tick));
+    }
+
+    const auto due = breaker.nextUpdateTime(tick_);
+    if (due.count() < 0)
+    {
+        if (it->second != 0)
+        {
+            it->second = 0;
+            --pending_;
+        }
+        return;
+    }
+
+    const auto dueTick = std::max(currentTick_ + 1, static_cast<uint64_t>((due.count() + tick - 1) / tick));
+    if (it->second == 0)
+    {
+        ++pending_;
+    }
+    it->second = dueTick;
+    wheel_[dueTick % wheel_.size()].push_back({&breaker, dueTick});
+    wakeup_.notify_all();
+}
+
+void BreakerScheduler::advance(const std::chrono::nanoseconds dt)
+{
+    if (running_.load(std::memory_order_acquire))
+    {
+        throw std::logic_error("Cannot advance a running scheduler");
+    }
+    if (dt.count() < 0)
+    {
+        throw std::invalid_argument("Time step must not be negative");
+    }
+
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    advanceTo(now() + dt);
+}
+
+void BreakerScheduler::advanceTo(const std::chrono::nanoseconds target)
+{
+    const auto targetTick = static_cast<uint64_t>(target.count() / tick_.count());
+    while (currentTick_ < targetTick)
+    {
+        if (pending_ == 0)
+        {
+            currentTick_ = targetTick;
+            break;
+        }
+        ++currentTick_;
+        nowNs_.store(static_cast<int64_t>(currentTick_) * tick_.count(), std::memory_order_release);
+        processTick(currentTick_);
+    }
+    nowNs_.store(std::max(nowNs_.load(std::memory_order_relaxed), target.count()), std::memory_order_release);
+}
+
+void BreakerScheduler::processTick(const uint64_t tick)
+{
+    auto& slot = wheel_[tick % wheel_.size()];
+    if (slot.empty())
+    {
+        return;
+    }
+
+    // Entries of later wheel rounds stay; stale entries of rescheduled or detached breakers are dropped
+    std::vector<TimerEntry> entries;
+    entries.swap(slot);
+    std::vector<BreakerModel*> due;
+    for (const auto& entry : entries)
+    {
+        if (entry.dueTick > tick)
+        {
+            slot.push_back(entry);
+            continue;
+        }
+        const auto it = breakers_.find(entry.breaker);
+        if (entry.dueTick == tick && it != breakers_.end() && it->second == tick)
+        {
+            it->second = 0;
+            --pending_;
+            due.push_back(entry.breaker);
+        }
+    }
+
+    for (auto* breaker : due)
+    {
+        breaker->advance();
+        schedule(*breaker);
+    }
+}
+
+void BreakerScheduler::start()
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    if (running_.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    origin_ = std::chrono::steady_clock::now() - std::chrono::nanoseconds(nowNs_.load(std::memory_order_acquire));
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&BreakerScheduler::run, this);
+}
+
+void BreakerScheduler::stop()
+{
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        if (!running_.load(std::memory_order_acquire))
+        {
+            return;
+        }
+        running_.store(false, std::memory_order_release);
+        nowNs_.store(now().count(), std::memory_order_release);
+    }
+    wakeup_.notify_all();
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+bool BreakerScheduler::isRunning() const noexcept
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+std::chrono::nanoseconds BreakerScheduler::now() const noexcept
+{
+    const auto time = std::chrono::nanoseconds(nowNs_.load(std::memory_order_acquire));
+    if (!running_.load(std::memory_order_acquire))
+    {
+        return time;
+    }
+    return std::max(time, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin_));
+}
+
+std::chrono::nanoseconds BreakerScheduler::getTick() const noexcept
+{
+    return tick_;
+}
+
+size_t BreakerScheduler::getBreakerCount() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    return breakers_.size();
+}
+
+size_t BreakerScheduler::getPendingCount() const
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+    return pending_;
+}
+
+void BreakerScheduler::run()
+{
+    std::unique_lock<std::recursive_mutex> lock(mutex_);
+    while (running_.load(std::memory_order_acquire))
+    {
+        if (pending_ == 0)
+        {
+            wakeup_.wait(lock, [this] { return !running_.load(std::memory_order_acquire) || pending_ > 0; });
+            continue;
+        }
+
+        const auto next = origin_ + tick_ * static_cast<int64_t>(currentTick_ + 1);
+        if (wakeup_.wait_until(lock, next, [this] { return !running_.load(std::memory_order_acquire); }))
+        {
+            break;
+        }
+        advanceTo(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - origin_));
+    }
+}
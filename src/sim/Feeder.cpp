@@ -0,0 +1,345 @@
+#include "../include/sv/sim/Feeder.h"
+#include "../include/sv/model/IedServer.h"
+#include "../include/sv/model/SampledValueControlBlock.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+using namespace sv::sim;
+
+namespace
+{
+    using Phasor = std::complex<double>;
+    using Phasors = std::array<Phasor, 3>;
+
+    /// @brief The 120 degree rotation operator
+    const Phasor A = std::polar(1.0, 2.0 * std::numbers::pi / 3.0);
+
+    /// @brief Converts sequence components into phase values
+    Phasors toPhases(const Phasor zero, const Phasor positive, const Phasor negative)
+    {
+        return {zero + positive + negative,
+                zero + A * A * positive + A * negative,
+                zero + A * positive + A * A * negative};
+    }
+
+    /// @brief Instantaneous value of an RMS phasor at a rotation
+    double instantaneous(const Phasor phasor, const Phasor rotation)
+    {
+        return std::numbers::sqrt2 * (phasor * rotation).real();
+    }
+
+    int32_t toCount(const double value, const double scaling)
+    {
+        constexpr double low = std::numeric_limits<int32_t>::min();
+        constexpr double high = std::numeric_limits<int32_t>::max();
+        return static_cast<int32_t>(std::clamp(std::round(value * scaling), low, high));
+    }
+}
+
+FeederSimulator::Ptr FeederSimulator::create(const FeederDefinition& definition,
+                                             const SamplesPerPeriod samplesPerPeriod,
+                                             const SignalFrequency frequency,
+                                             const int32_t currentScaling,
+                                             const int32_t voltageScaling)
+{
+    if (!definition.isValid())
+    {
+        throw std::invalid_argument("Invalid feeder definition");
+    }
+    if (currentScaling <= 0 || voltageScaling <= 0)
+    {
+        throw std::invalid_argument("Scaling must be positive");
+    }
+    return Ptr(new FeederSimulator(definition, samplesPerPeriod, frequency, currentScaling, voltageScaling));
+}
+
+FeederSimulator::Ptr FeederSimulator::create(const FeederDefinition& definition, const SampledValueControlBlock& svcb)
+{
+    return create(definition, svcb.getSamplesPerPeriod(), svcb.getSignalFrequency(),
+                  svcb.getCurrentScaling(), svcb.getVoltageScaling());
+}
+
+FeederSimulator::FeederSimulator(const FeederDefinition& definition, const SamplesPerPeriod samplesPerPeriod,
+                                 const SignalFrequency frequency, const int32_t currentScaling,
+                                 const int32_t voltageScaling)
+    : definition_(definition)
+    , clock_(samplesPerPeriod, frequency)
+    , breaker_(BreakerModel::create(definition.breaker))
+    , currentScaling_(currentScaling)
+    , voltageScaling_(voltageScaling)
+    , values_(VALUES_PER_ASDU)
+{
+    // One rotation per sample of a cycle: the phase of sample n is exact for any run length
+    const auto samples = static_cast<size_t>(samplesPerPeriod);
+    rotations_.reserve(samples);
+    for (size_t n = 0; n < samples; ++n)
+    {
+        rotations_.push_back(std::polar(1.0, 2.0 * std::numbers::pi * static_cast<double>(n) / static_cast<double>(samples)));
+    }
+
+    breaker_->close();
+    breaker_->step(std::chrono::nanoseconds(std::llround(definition.breaker.closeTimeSec * 1e9)));
+
+    solve();
+}
+
+void FeederSimulator::solve()
+{
+    const Phasor source = definition_.sourceVoltageV / std::numbers::sqrt3;
+    const Phasor lineImpedance = definition_.lineImpedanceOhmPerKm * definition_.lineLengthKm;
+    const Phasor load = source / (definition_.sourceImpedanceOhm + lineImpedance + definition_.loadImpedanceOhm);
+
+    sourceVoltages_ = toPhases(0.0, source, 0.0);
+    loadCurrents_ = toPhases(0.0, load, 0.0);
+    loadVoltages_ = toPhases(0.0, source - definition_.sourceImpedanceOhm * load, 0.0);
+    faultCurrents_ = {};
+    voltages_ = loadVoltages_;
+    dcDecay_ = 0.0;
+
+    const auto& fault = definition_.fault;
+    if (fault.type == FaultType::NONE)
+    {
+        return;
+    }
+
+    // Thevenin impedances seen from the fault, the load branch beyond it neglected
+    const double distanceKm = fault.location * definition_.lineLengthKm;
+    const Phasor positive = definition_.sourceImpedanceOhm + definition_.lineImpedanceOhmPerKm * distanceKm;
+    const Phasor zero = definition_.sourceZeroImpedanceOhm + definition_.lineZeroImpedanceOhmPerKm * distanceKm;
+    const Phasor prefault = source - positive * load;
+    const double resistance = fault.resistanceOhm;
+
+    Phasor i0 = 0.0;
+    Phasor i1 = 0.0;
+    Phasor i2 = 0.0;
+    switch (fault.type)
+    {
+        case FaultType::A_GROUND:
+            i1 = prefault / (2.0 * positive + zero + 3.0 * resistance);
+            i2 = i1;
+            i0 = i1;
+            break;
+        case FaultType::B_C:
+            i1 = prefault / (2.0 * positive + resistance);
+            i2 = -i1;
+            break;
+        case FaultType::B_C_GROUND:
+        {
+            const Phasor earth = zero + 3.0 * resistance;
+            i1 = prefault / (positive + positive * earth / (positive + earth));
+            i2 = -i1 * earth / (positive + earth);
+            i0 = -i1 * positive / (positive + earth);
+            break;
+        }
+        case FaultType::THREE_PHASE:
+            i1 = prefault / (positive + resistance);
+            break;
+        default:
+            break;
+    }
+
+    faultCurrents_ = toPhases(i0, i1, i2);
+    voltages_ = toPhases(-definition_.sourceZeroImpedanceOhm * i0,
+                         source - definition_.sourceImpedanceOhm * (load + i1),
+                         -definition_.sourceImpedanceOhm * i2);
+
+    // The offset decays with the X/R ratio of the positive sequence fault loop
+    const Phasor loop = positive + resistance;
+    dcDecay_ = loop.imag() > 0.0
+                   ? std::exp(-loop.real() * 2.0 * std::numbers::pi / (loop.imag() * static_cast<double>(rotations_.size())))
+                   : 0.0;
+}
+
+void FeederSimulator::startFault(const Phasor rotation)
+{
+    faulted_ = true;
+    for (size_t phase = 0; phase < 3; ++phase)
+    {
+        dcOffsetA_[phase] = breaker_->isClosed() ? -instantaneous(faultCurrents_[phase], rotation) : 0.0;
+    }
+}
+
+const FeederSample& FeederSimulator::step()
+{
+    const uint64_t index = next_++;
+    const Phasor rotation = rotations_[index % rotations_.size()];
+    sample_.index = index;
+    sample_.time = clock_.toTime(index);
+
+    const auto& fault = definition_.fault;
+    if (fault.type != FaultType::NONE && !faulted_ &&
+        sample_.time >= std::chrono::nanoseconds(std::llround(fault.inceptionS * 1e9)))
+    {
+        startFault(rotation);
+    }
+
+    // The arc current decays from the current at contact separation
+    const bool closed = breaker_->isClosed();
+    const bool opening = breaker_->isOpening();
+    if (opening && !arcing_)
+    {
+        arcStartCurrentA_ = breaker_->getCurrent();
+    }
+    arcing_ = opening;
+
+    double factor = closed ? 1.0 : 0.0;
+    if (opening && arcStartCurrentA_ > 0.0)
+    {
+        factor = breaker_->getCurrent() / arcStartCurrentA_;
+    }
+    const double arcVoltage = opening ? breaker_->getArcVoltage() : 0.0;
+
+    double maxCurrentA = 0.0;
+    sample_.currentsA[3] = 0.0;
+    sample_.voltagesV[3] = 0.0;
+    for (size_t phase = 0; phase < 3; ++phase)
+    {
+        const Phasor current = faulted_ ? loadCurrents_[phase] + faultCurrents_[phase] : loadCurrents_[phase];
+        const Phasor voltage = faulted_ ? voltages_[phase] : loadVoltages_[phase];
+        maxCurrentA = std::max(maxCurrentA, std::abs(current));
+
+        const double i = factor * (instantaneous(current, rotation) + dcOffsetA_[phase]);
+        double v = 0.0;
+        if (closed || opening)
+        {
+            // The source drop shrinks with the arc current; the arc voltage opposes the current
+            const Phasor source = sourceVoltages_[phase];
+            v = instantaneous(source - factor * (source - voltage), rotation);
+            if (i != 0.0)
+            {
+                v -= std::copysign(arcVoltage, i);
+            }
+        }
+
+        sample_.currentsA[phase] = i;
+        sample_.voltagesV[phase] = v;
+        sample_.currentsA[3] += i;
+        sample_.voltagesV[3] += v;
+        dcOffsetA_[phase] = closed || opening ? dcOffsetA_[phase] * dcDecay_ : 0.0;
+    }
+
+    if (closed)
+    {
+        breaker_->setCurrent(maxCurrentA);
+    }
+    breaker_->step(clock_.toTime(index + 1) - sample_.time);
+    return sample_;
+}
+
+void FeederSimulator::generate(std::span<int32_t> out)
+{
+    if (out.size() % VALUES_PER_ASDU != 0)
+    {
+        throw std::invalid_argument("Output size must be a multiple of VALUES_PER_ASDU");
+    }
+
+    for (size_t offset = 0; offset < out.size(); offset += VALUES_PER_ASDU)
+    {
+        const auto& sample = step();
+        for (size_t n = 0; n < 4; ++n)
+        {
+            out[offset + n] = toCount(sample.currentsA[n], currentScaling_);
+            out[offset + 4 + n] = toCount(sample.voltagesV[n], voltageScaling_);
+        }
+    }
+}
+
+void FeederSimulator::publish(const IedServer& server, const std::shared_ptr<SampledValueControlBlock>& svcb)
+{
+    toAnalogValues(step(), values_);
+    server.updateSampledValue(svcb, values_);
+}
+
+void FeederSimulator::toAnalogValues(const FeederSample& sample, std::vector<AnalogValue>& values) const
+{
+    values.resize(VALUES_PER_ASDU);
+    for (size_t n = 0; n < 4; ++n)
+    {
+        values[n].value = toCount(sample.currentsA[n], currentScaling_);
+        values[4 + n].value = toCount(sample.voltagesV[n], voltageScaling_);
+    }
+}
+
+void FeederSimulator::setFault(const FaultDefinition& fault)
+{
+    if (!fault.isValid())
+    {
+        throw std::invalid_argument("Invalid fault definition");
+    }
+
+    definition_.fault = fault;
+    definition_.fault.inceptionS = 0.0;
+    faulted_ = false;
+    dcOffsetA_ = {};
+    solve();
+}
+
+const BreakerModel::BreakerPtr& FeederSimulator::getBreaker() const noexcept
+{
+    return breaker_;
+}
+
+const FeederSample& FeederSimulator::getSample() const noexcept
+{
+    return sample_;
+}
+
+std::array<std::complex<double>, 3> FeederSimulator::getFaultCurrents() const noexcept
+{
+    return faultCurrents_;
+}
+
+bool FeederSimulator::isFaulted() const noexcept
+{
+    return faulted_;
+}
+
+FeederBank::Ptr FeederBank::create(const size_t workers)
+{
+    return Ptr(new FeederBank(workers));
+}
+
+FeederBank::FeederBank(const size_t workers)
+    : pool_(workers)
+{
+}
+
+size_t FeederBank::add(FeederSimulator::Ptr feeder)
+{
+    if (!feeder)
+    {
+        throw std::invalid_argument("Feeder must not be null");
+    }
+    feeders_.push_back(std::move(feeder));
+    samples_.emplace_back();
+    return feeders_.size() - 1;
+}
+
+void FeederBank::generate(const size_t samples)
+{
+    for (size_t n = 0; n < feeders_.size(); ++n)
+    {
+        samples_[n].resize(samples * VALUES_PER_ASDU);
+        pool_.submit([this, n] { feeders_[n]->generate(samples_[n]); });
+    }
+    pool_.wait();
+}
+
+std::span<const int32_t> FeederBank::getSamples(const size_t feeder) const
+{
+    return samples_.at(feeder);
+}
+
+const FeederSimulator::Ptr& FeederBank::getFeeder(const size_t feeder) const
+{
+    return feeders_.at(feeder);
+}
+
+size_t FeederBank::getFeederCount() const noexcept
+{
+    return feeders_.size();
+}
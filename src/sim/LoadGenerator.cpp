@@ -0,0 +1,296 @@
+#include "../include/sv/sim/LoadGenerator.h"
+#include "../include/sv/core/buffer.h"
+#include "../include/sv/core/mac.h"
+#include "../include/sv/model/SampledValueControlBlock.h"
+#include "../include/sv/network/FrameCodec.h"
+#include "../include/sv/network/NetworkSender.h"
+#include "../include/sv/sim/Waveform.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <span>
+#include <stdexcept>
+#include <thread>
+
+using namespace sv::sim;
+
+namespace
+{
+    /// @brief Time between run() and the first sample, for the threads to start
+    constexpr uint64_t START_DELAY_NS = 2'000'000;
+
+    /**
+     * @brief Reads a clock.
+     * @param clock The clock id.
+     * @return The time in nanoseconds.
+     */
+    uint64_t readClockNs(const clockid_t clock) noexcept
+    {
+        timespec ts{};
+        clock_gettime(clock, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    /**
+     * @brief Waits until an absolute CLOCK_MONOTONIC deadline: sleeps until spinNs before it and
+     * polls the clock for the rest, which clock_nanosleep alone overshoots by tens of microseconds.
+     * @param deadlineNs The deadline in nanoseconds.
+     * @param spinNs The time to spin before the deadline.
+     */
+    void waitUntil(const uint64_t deadlineNs, const uint64_t spinNs) noexcept
+    {
+        if (deadlineNs > spinNs && readClockNs(CLOCK_MONOTONIC) < deadlineNs - spinNs)
+        {
+            const uint64_t wakeNs = deadlineNs - spinNs;
+            timespec ts{};
+            ts.tv_sec = static_cast<time_t>(wakeNs / 1'000'000'000ULL);
+            ts.tv_nsec = static_cast<long>(wakeNs % 1'000'000'000ULL);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+            {
+            }
+        }
+        while (readClockNs(CLOCK_MONOTONIC) < deadlineNs)
+        {
+        }
+    }
+
+    /// @brief Streams published by one thread, with their reused frame buffers \struct StreamGroup
+    struct StreamGroup
+    {
+        size_t first{0};
+        std::unique_ptr<sv::NetworkSender> sender;
+        WaveformGenerator::Ptr waveforms;
+        std::vector<std::shared_ptr<sv::SampledValueControlBlock>> controlBlocks;
+        std::vector<sv::ASDU> asdus;
+        std::vector<std::array<uint8_t, 6>> destinations;
+        std::vector<std::array<uint8_t, 6>> sources;
+        std::vector<sv::BufferWriter> writers;
+        std::vector<std::span<const uint8_t>> frames;
+
+        // Results
+        std::vector<uint64_t> sent;
+        std::vector<uint64_t> failed;
+        uint64_t ticks{0};
+        double meanLatenessNs{0.0};
+        double latenessM2{0.0};
+        uint64_t maxLatenessNs{0};
+        uint64_t cpuNs{0};
+        uint64_t wallNs{0};
+    };
+
+    /**
+     * @brief Publishes a group once per sample period from startNs until endNs or a stop request.
+     * @param group The group.
+     * @param sampleRate The samples per second.
+     * @param spinNs The time to spin before each deadline.
+     * @param startNs The CLOCK_MONOTONIC time of the first sample.
+     * @param endNs The CLOCK_MONOTONIC time after the last sample.
+     * @param stopRequested Set to end the run early.
+     */
+    void publish(StreamGroup& group, const uint32_t sampleRate, const uint64_t spinNs, const uint64_t startNs,
+                 const uint64_t endNs, const std::atomic<bool>& stopRequested)
+    {
+        const size_t count = group.asdus.size();
+        const uint64_t cpuStartNs = readClockNs(CLOCK_THREAD_CPUTIME_ID);
+
+        for (uint64_t tick = 0; !stopRequested.load(std::memory_order_relaxed); ++tick)
+        {
+            const uint64_t deadlineNs = startNs + tick * 1'000'000'000ULL / sampleRate;
+            if (deadlineNs >= endNs)
+            {
+                break;
+            }
+
+            // Encode ahead so that only the send is left at the deadline
+            group.waveforms->step();
+            for (size_t n = 0; n < count; ++n)
+            {
+                auto& asdu = group.asdus[n];
+                asdu.smpCnt = static_cast<uint16_t>(tick % sampleRate);
+                group.waveforms->toAnalogValues(n, asdu.dataSet);
+
+                auto& writer = group.writers[n];
+                writer.clear();
+                sv::FrameCodec::encode(writer, *group.controlBlocks[n], asdu, group.destinations[n], group.sources[n]);
+                group.frames[n] = writer.span();
+            }
+
+            waitUntil(deadlineNs, spinNs);
+            const size_t sent = group.sender->sendRawFrames(group.frames);
+            const uint64_t latenessNs = readClockNs(CLOCK_MONOTONIC) - deadlineNs;
+
+            for (size_t n = 0; n < count; ++n)
+            {
+                ++(n < sent ? group.sent[n] : group.failed[n]);
+            }
+
+            // Welford's running mean and variance
+            ++group.ticks;
+            const double delta = static_cast<double>(latenessNs) - group.meanLatenessNs;
+            group.meanLatenessNs += delta / static_cast<double>(group.ticks);
+            group.latenessM2 += delta * (static_cast<double>(latenessNs) - group.meanLatenessNs);
+            group.maxLatenessNs = std::max(group.maxLatenessNs, latenessNs);
+        }
+
+        group.cpuNs = readClockNs(CLOCK_THREAD_CPUTIME_ID) - cpuStartNs;
+        group.wallNs = readClockNs(CLOCK_MONOTONIC) - startNs;
+    }
+}
+
+double LoadReport::framesPerSecond() const noexcept
+{
+    return elapsedSeconds > 0.0 ? static_cast<double>(frames) / elapsedSeconds : 0.0;
+}
+
+LoadGenerator::Ptr LoadGenerator::create(TransportFactory::Ptr transport, const LoadGeneratorOptions& options)
+{
+    if (!transport)
+    {
+        throw std::invalid_argument("Transport must not be null");
+    }
+    if (!options.isValid())
+    {
+        throw std::invalid_argument("Invalid load generator options");
+    }
+    return Ptr(new LoadGenerator(std::move(transport), options));
+}
+
+LoadGenerator::LoadGenerator(TransportFactory::Ptr transport, const LoadGeneratorOptions& options)
+    : transport_(std::move(transport))
+    , options_(options)
+{
+}
+
+LoadStreamIdentity LoadGenerator::getIdentity(const LoadGeneratorOptions& options, const size_t stream)
+{
+    char number[8];
+    std::snprintf(number, sizeof(number), "%04zu", stream + 1);
+
+    const auto high = static_cast<uint8_t>(stream >> 8);
+    const auto low = static_cast<uint8_t>(stream);
+
+    LoadStreamIdentity identity;
+    identity.svId = options.svIdPrefix + number;
+    identity.appId = static_cast<uint16_t>(options.firstAppId + stream);
+    identity.destinationMac = {0x01, 0x0C, 0xCD, 0x04, high, low};
+    identity.sourceMac = {0x02, 0x00, 0x00, 0x01, high, low};
+    return identity;
+}
+
+LoadReport LoadGenerator::run()
+{
+    const size_t streams = options_.streams;
+    const size_t threads = options_.threads;
+    const uint32_t samplesPerPeriod = options_.sampleRate / options_.frequencyHz;
+
+    LoadReport report;
+    report.streams.resize(streams);
+    report.threads.resize(threads);
+
+    // Everything is allocated before the clock starts
+    std::vector<StreamGroup> groups(threads);
+    for (size_t t = 0; t < threads; ++t)
+    {
+        auto& group = groups[t];
+        group.first = t * streams / threads;
+        const size_t count = (t + 1) * streams / threads - group.first;
+
+        group.sender = transport_->createSender();
+        group.waveforms = WaveformGenerator::create(samplesPerPeriod, options_.frequencyHz, t + 1);
+        group.writers.reserve(count);
+        group.frames.resize(count);
+        group.sent.resize(count);
+        group.failed.resize(count);
+
+        for (size_t n = 0; n < count; ++n)
+        {
+            auto identity = getIdentity(options_, group.first + n);
+
+            const auto svcb = SampledValueControlBlock::create(identity.svId);
+            svcb->setAppId(identity.appId);
+            svcb->setMulticastAddress(MacAddress(identity.destinationMac).toString());
+            svcb->setSmpRate(static_cast<uint16_t>(samplesPerPeriod));
+            svcb->setSmpSynch(SmpSynch::Global);
+            group.controlBlocks.push_back(svcb);
+
+            ASDU asdu{};
+            asdu.svID = identity.svId;
+            asdu.confRev = svcb->getConfRev();
+            asdu.smpSynch = svcb->getSmpSynch();
+            asdu.dataSet.resize(VALUES_PER_ASDU);
+            group.asdus.push_back(std::move(asdu));
+
+            group.destinations.push_back(identity.destinationMac);
+            group.sources.push_back(identity.sourceMac);
+            group.waveforms->addStream(WaveformDefinition::balanced(100.0, 6350.0, -0.3));
+            group.writers.emplace_back(FrameCodec::MAX_FRAME_SIZE);
+            report.streams[group.first + n].identity = std::move(identity);
+        }
+    }
+
+    if (running_.exchange(true))
+    {
+        throw std::logic_error("Load generator is already running");
+    }
+    stopRequested_.store(false, std::memory_order_relaxed);
+
+    const uint64_t startNs = readClockNs(CLOCK_MONOTONIC) + START_DELAY_NS;
+    const uint64_t endNs = startNs + static_cast<uint64_t>(std::llround(options_.durationS * 1e9));
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(threads);
+        for (auto& group : groups)
+        {
+            workers.emplace_back([this, &group, startNs, endNs]
+            {
+                publish(group, options_.sampleRate, options_.spinNs, startNs, endNs, stopRequested_);
+            });
+        }
+    }
+
+    for (const auto& group : groups)
+    {
+        report.elapsedSeconds = std::max(report.elapsedSeconds, static_cast<double>(group.wallNs) / 1e9);
+    }
+    for (size_t t = 0; t < threads; ++t)
+    {
+        const auto& group = groups[t];
+        const size_t count = group.asdus.size();
+
+        auto& thread = report.threads[t];
+        thread.firstStream = group.first;
+        thread.streams = count;
+        thread.batches = group.ticks;
+        thread.meanLatenessNs = group.meanLatenessNs;
+        thread.jitterNs = group.ticks > 1 ? std::sqrt(group.latenessM2 / static_cast<double>(group.ticks - 1)) : 0.0;
+        thread.maxLatenessNs = group.maxLatenessNs;
+        thread.cpuPercent = group.wallNs > 0 ? 100.0 * static_cast<double>(group.cpuNs) / static_cast<double>(group.wallNs) : 0.0;
+
+        for (size_t n = 0; n < count; ++n)
+        {
+            auto& stats = report.streams[group.first + n];
+            stats.frames = group.sent[n];
+            stats.failed = group.failed[n];
+            stats.framesPerSecond = report.elapsedSeconds > 0.0 ? static_cast<double>(stats.frames) / report.elapsedSeconds : 0.0;
+
+            report.frames += stats.frames;
+            report.failed += stats.failed;
+        }
+    }
+
+    running_.store(false);
+    return report;
+}
+
+void LoadGenerator::stop() noexcept
+{
+    stopRequested_.store(true, std::memory_order_relaxed);
+}
+
+const LoadGeneratorOptions& LoadGenerator::getOptions() const noexcept
+{
+    return options_;
+}
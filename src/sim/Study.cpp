@@ -0,0 +1,434 @@
+#include "../include/sv/sim/Study.h"
+#include "../include/sv/core/util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+using namespace sv::sim;
+using sv::detail::mix;
+using sv::detail::toDuration;
+
+namespace
+{
+    constexpr char COLUMNAR_MAGIC[8] = {'S', 'V', 'S', 'T', 'U', 'D', 'Y', '1'};
+    constexpr uint8_t COLUMN_FLOAT64 = 0;
+    constexpr uint8_t COLUMN_UINT8 = 1;
+
+    std::chrono::microseconds toDelay(const double seconds)
+    {
+        return std::chrono::microseconds(std::llround(seconds * 1e6));
+    }
+
+    TripTimeDistribution distribution(std::vector<double> times)
+    {
+        TripTimeDistribution result;
+        result.count = times.size();
+        if (times.empty())
+        {
+            return result;
+        }
+
+        std::ranges::sort(times);
+        const auto percentile = [&times](const double p)
+        {
+            const auto rank = static_cast<size_t>(std::ceil(p / 100.0 * static_cast<double>(times.size())));
+            return times[std::clamp<size_t>(rank, 1, times.size()) - 1];
+        };
+
+        const double count = static_cast<double>(times.size());
+        result.minS = times.front();
+        result.maxS = times.back();
+        result.meanS = std::accumulate(times.begin(), times.end(), 0.0) / count;
+        double variance = 0.0;
+        for (const double time : times)
+        {
+            variance += (time - result.meanS) * (time - result.meanS);
+        }
+        result.stddevS = std::sqrt(variance / count);
+        result.p50S = percentile(50.0);
+        result.p90S = percentile(90.0);
+        result.p99S = percentile(99.0);
+        return result;
+    }
+
+    template<typename T>
+    void writeValue(std::ofstream& file, const T value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template<typename T>
+    T readValue(std::ifstream& file)
+    {
+        T value{};
+        if (!file.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        {
+            throw std::runtime_error("Truncated study file");
+        }
+        return value;
+    }
+}
+
+double StudyScenario::get(const StudyParameter parameter) const
+{
+    switch (parameter)
+    {
+        case StudyParameter::FAULT_CURRENT_A: return faultCurrentA;
+        case StudyParameter::FAULT_TIME_S: return faultTimeS;
+        case StudyParameter::FAULT_IMPEDANCE_OHM: return faultImpedanceOhm;
+        case StudyParameter::FAULT_ANGLE_RAD: return faultAngleRad;
+        case StudyParameter::LOAD_CURRENT_A: return loadCurrentA;
+        case StudyParameter::BREAKER_OPEN_TIME_S: return breaker.openTimeSec;
+        case StudyParameter::BREAKER_MAX_CURRENT_A: return breaker.maxCurrentA;
+        case StudyParameter::BREAKER_ARC_DURATION_S: return breaker.arcDurationSec;
+        case StudyParameter::ZONE1_REACH_OHM: return protection.zone1.reachOhm;
+        case StudyParameter::ZONE2_REACH_OHM: return protection.zone2.reachOhm;
+        case StudyParameter::ZONE2_DELAY_S: return std::chrono::duration<double>(protection.zone2.delay).count();
+        case StudyParameter::ZONE3_REACH_OHM: return protection.zone3.reachOhm;
+        case StudyParameter::ZONE3_DELAY_S: return std::chrono::duration<double>(protection.zone3.delay).count();
+        default: return 0.0;
+    }
+}
+
+void StudyScenario::set(const StudyParameter parameter, const double value)
+{
+    switch (parameter)
+    {
+        case StudyParameter::FAULT_CURRENT_A: faultCurrentA = value; break;
+        case StudyParameter::FAULT_TIME_S: faultTimeS = value; break;
+        case StudyParameter::FAULT_IMPEDANCE_OHM: faultImpedanceOhm = value; break;
+        case StudyParameter::FAULT_ANGLE_RAD: faultAngleRad = value; break;
+        case StudyParameter::LOAD_CURRENT_A: loadCurrentA = value; break;
+        case StudyParameter::BREAKER_OPEN_TIME_S: breaker.openTimeSec = value; break;
+        case StudyParameter::BREAKER_MAX_CURRENT_A: breaker.maxCurrentA = value; break;
+        case StudyParameter::BREAKER_ARC_DURATION_S: breaker.arcDurationSec = value; break;
+        case StudyParameter::ZONE1_REACH_OHM: protection.zone1.reachOhm = value; break;
+        case StudyParameter::ZONE2_REACH_OHM: protection.zone2.reachOhm = value; break;
+        case StudyParameter::ZONE2_DELAY_S: protection.zone2.delay = toDelay(value); break;
+        case StudyParameter::ZONE3_REACH_OHM: protection.zone3.reachOhm = value; break;
+        case StudyParameter::ZONE3_DELAY_S: protection.zone3.delay = toDelay(value); break;
+        default: break;
+    }
+}
+
+bool StudyScenario::isValid() const
+{
+    return breaker.isValid() && breaker.arcDurationSec > 0.0 && protection.isValid() &&
+           voltageV > 0.0 && loadCurrentA >= 0.0 && faultCurrentA >= 0.0 && faultImpedanceOhm > 0.0 &&
+           faultTimeS >= 0.0 && durationS > 0.0 && toDuration(timeStepS).count() > 0;
+}
+
+void StudyResult::writeColumnar(const std::string& path) const
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open study file: " + path);
+    }
+
+    const auto writeHeader = [&file](const uint8_t type, const std::string& name)
+    {
+        writeValue(file, type);
+        writeValue(file, static_cast<uint16_t>(name.size()));
+        file.write(name.data(), static_cast<std::streamsize>(name.size()));
+    };
+
+    constexpr size_t outcomeColumns = 6;
+    file.write(COLUMNAR_MAGIC, sizeof(COLUMNAR_MAGIC));
+    writeValue(file, static_cast<uint32_t>(std::size(STUDY_PARAMETERS) + outcomeColumns));
+    writeValue(file, static_cast<uint64_t>(outcomes.size()));
+    for (const auto parameter : STUDY_PARAMETERS)
+    {
+        writeHeader(COLUMN_FLOAT64, toString(parameter));
+    }
+    writeHeader(COLUMN_UINT8, "relay_operated");
+    writeHeader(COLUMN_UINT8, "zone");
+    writeHeader(COLUMN_UINT8, "overload_trip");
+    writeHeader(COLUMN_UINT8, "cleared");
+    writeHeader(COLUMN_FLOAT64, "relay_time_s");
+    writeHeader(COLUMN_FLOAT64, "clearing_time_s");
+
+    // Each column is gathered into one contiguous block
+    std::vector<double> column(outcomes.size());
+    std::vector<uint8_t> flags(outcomes.size());
+    const auto writeColumn = [&file](const auto& values)
+    {
+        file.write(reinterpret_cast<const char*>(values.data()),
+                   static_cast<std::streamsize>(values.size() * sizeof(values[0])));
+    };
+
+    for (const auto parameter : STUDY_PARAMETERS)
+    {
+        std::ranges::transform(scenarios, column.begin(), [parameter](const StudyScenario& s) { return s.get(parameter); });
+        writeColumn(column);
+    }
+    std::ranges::transform(outcomes, flags.begin(), [](const StudyOutcome& o) -> uint8_t { return o.relayOperated; });
+    writeColumn(flags);
+    std::ranges::transform(outcomes, flags.begin(), [](const StudyOutcome& o) { return o.zone; });
+    writeColumn(flags);
+    std::ranges::transform(outcomes, flags.begin(), [](const StudyOutcome& o) -> uint8_t { return o.overloadTrip; });
+    writeColumn(flags);
+    std::ranges::transform(outcomes, flags.begin(), [](const StudyOutcome& o) -> uint8_t { return o.cleared; });
+    writeColumn(flags);
+    std::ranges::transform(outcomes, column.begin(), [](const StudyOutcome& o) { return o.relayTimeS; });
+    writeColumn(column);
+    std::ranges::transform(outcomes, column.begin(), [](const StudyOutcome& o) { return o.clearingTimeS; });
+    writeColumn(column);
+
+    if (!file)
+    {
+        throw std::runtime_error("Failed to write study file: " + path);
+    }
+}
+
+std::map<std::string, std::vector<double>> StudyResult::readColumnar(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open study file: " + path);
+    }
+
+    char magic[sizeof(COLUMNAR_MAGIC)];
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, COLUMNAR_MAGIC, sizeof(magic)) != 0)
+    {
+        throw std::runtime_error("Not a study file: " + path);
+    }
+
+    const auto columnCount = readValue<uint32_t>(file);
+    const auto rows = readValue<uint64_t>(file);
+    std::vector<std::pair<std::string, uint8_t>> headers;
+    for (uint32_t c = 0; c < columnCount; ++c)
+    {
+        const auto type = readValue<uint8_t>(file);
+        std::string name(readValue<uint16_t>(file), '\0');
+        if (type > COLUMN_UINT8 || !file.read(name.data(), static_cast<std::streamsize>(name.size())))
+        {
+            throw std::runtime_error("Malformed study file: " + path);
+        }
+        headers.emplace_back(std::move(name), type);
+    }
+
+    std::map<std::string, std::vector<double>> columns;
+    for (const auto& [name, type] : headers)
+    {
+        auto& values = columns[name];
+        values.resize(rows);
+        if (type == COLUMN_FLOAT64)
+        {
+            file.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(rows * sizeof(double)));
+        }
+        else
+        {
+            std::vector<uint8_t> raw(rows);
+            file.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(rows));
+            std::ranges::copy(raw, values.begin());
+        }
+        if (!file)
+        {
+            throw std::runtime_error("Truncated study file: " + path);
+        }
+    }
+    return columns;
+}
+
+StudyRunner::Ptr StudyRunner::create(const size_t workers)
+{
+    return Ptr(new StudyRunner(workers));
+}
+
+StudyRunner::StudyRunner(const size_t workers)
+    : pool_(workers)
+{
+}
+
+std::vector<StudyScenario> StudyRunner::expand(const StudySpec& spec)
+{
+    for (const auto& axis : spec.grid)
+    {
+        if (axis.values.empty())
+        {
+            throw std::invalid_argument(std::string("Empty study axis: ") + toString(axis.parameter));
+        }
+    }
+    for (const auto& range : spec.random)
+    {
+        if (!(range.min <= range.max))
+        {
+            throw std::invalid_argument(std::string("Inverted study range: ") + toString(range.parameter));
+        }
+    }
+
+    // Cartesian product, last axis varying fastest
+    std::vector<StudyScenario> points{spec.base};
+    for (const auto& axis : spec.grid)
+    {
+        std::vector<StudyScenario> next;
+        next.reserve(points.size() * axis.values.size());
+        for (const auto& point : points)
+        {
+            for (const double value : axis.values)
+            {
+                next.push_back(point);
+                next.back().set(axis.parameter, value);
+            }
+        }
+        points = std::move(next);
+    }
+
+    if (spec.samples == 0 || spec.random.empty())
+    {
+        return points;
+    }
+
+    std::vector<StudyScenario> scenarios;
+    scenarios.reserve(points.size() * spec.samples);
+    for (const auto& point : points)
+    {
+        for (size_t sample = 0; sample < spec.samples; ++sample)
+        {
+            auto& scenario = scenarios.emplace_back(point);
+            uint64_t state = mix(spec.seed ^ mix(scenarios.size()));
+            for (const auto& range : spec.random)
+            {
+                state = mix(state);
+                const double unit = static_cast<double>(state >> 11) * 0x1.0p-53;
+                scenario.set(range.parameter, range.min + unit * (range.max - range.min));
+            }
+        }
+    }
+    return scenarios;
+}
+
+StudyOutcome StudyRunner::simulate(const StudyScenario& scenario)
+{
+    if (!scenario.isValid())
+    {
+        throw std::invalid_argument("Invalid study scenario");
+    }
+
+    const auto breaker = BreakerModel::create(scenario.breaker);
+    const auto relay = DistanceProtection::create(scenario.protection);
+
+    breaker->close();
+    breaker->step(toDuration(scenario.breaker.closeTimeSec));
+
+    const auto timeStep = toDuration(scenario.timeStepS);
+    const auto faultTime = toDuration(scenario.faultTimeS);
+    const auto duration = toDuration(scenario.durationS);
+
+    const std::complex<double> loadVoltage(scenario.voltageV, 0.0);
+    const auto loadCurrent = std::polar(scenario.loadCurrentA, -scenario.loadAngleRad);
+    const auto faultCurrent = std::polar(scenario.faultCurrentA, -scenario.faultAngleRad);
+    const auto faultVoltage = faultCurrent * std::polar(scenario.faultImpedanceOhm, scenario.faultAngleRad);
+
+    StudyOutcome outcome;
+    for (std::chrono::nanoseconds time{0}; time < duration; time += timeStep)
+    {
+        const bool faulted = time >= faultTime;
+
+        if (breaker->isClosed())
+        {
+            const auto current = faulted ? faultCurrent : loadCurrent;
+            breaker->setCurrent(std::abs(current));
+
+            if (breaker->isClosed() && !outcome.relayOperated)
+            {
+                const auto result = relay->update(faulted ? faultVoltage : loadVoltage, current, time);
+                if (result.zone1Trip || result.zone2Trip || result.zone3Trip)
+                {
+                    outcome.relayOperated = true;
+                    outcome.zone = result.zone1Trip ? 1 : (result.zone2Trip ? 2 : 3);
+                    outcome.relayTimeS = std::chrono::duration<double>(time - faultTime).count();
+                    breaker->open();
+                }
+            }
+        }
+
+        if (faulted && !outcome.cleared && breaker->isOpen())
+        {
+            outcome.cleared = true;
+            outcome.overloadTrip = !outcome.relayOperated;
+            outcome.clearingTimeS = std::chrono::duration<double>(time - faultTime).count();
+            break;
+        }
+
+        breaker->step(timeStep);
+    }
+    return outcome;
+}
+
+StudyResult StudyRunner::run(const StudySpec& spec)
+{
+    return run(expand(spec));
+}
+
+StudyResult StudyRunner::run(std::vector<StudyScenario> scenarios)
+{
+    for (const auto& scenario : scenarios)
+    {
+        if (!scenario.isValid())
+        {
+            throw std::invalid_argument("Invalid study scenario");
+        }
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    StudyResult result;
+    result.scenarios = std::move(scenarios);
+    result.outcomes.resize(result.scenarios.size());
+
+    // Several chunks per worker leave room for stealing when scenarios differ in length
+    const size_t count = result.scenarios.size();
+    const size_t chunk = std::max<size_t>(1, count / (pool_.getWorkerCount() * 8));
+    for (size_t first = 0; first < count; first += chunk)
+    {
+        const size_t last = std::min(count, first + chunk);
+        pool_.submit([&result, first, last]
+        {
+            for (size_t i = first; i < last; ++i)
+            {
+                result.outcomes[i] = simulate(result.scenarios[i]);
+            }
+        });
+    }
+    pool_.wait();
+
+    std::vector<double> relayTimes;
+    std::vector<double> clearingTimes;
+    for (const auto& outcome : result.outcomes)
+    {
+        if (outcome.relayOperated)
+        {
+            relayTimes.push_back(outcome.relayTimeS);
+        }
+        if (outcome.cleared)
+        {
+            clearingTimes.push_back(outcome.clearingTimeS);
+        }
+        else
+        {
+            ++result.notCleared;
+        }
+    }
+    result.relayTime = distribution(std::move(relayTimes));
+    result.clearingTime = distribution(std::move(clearingTimes));
+    result.wallTime = std::chrono::steady_clock::now() - start;
+    return result;
+}
+
+size_t StudyRunner::getWorkerCount() const noexcept
+{
+    return pool_.getWorkerCount();
+}
+
+uint64_t StudyRunner::getStealCount() const noexcept
+{
+    return pool_.getStealCount();
+}
@@ -0,0 +1,256 @@
+#include "../include/sv/sim/Waveform.h"
+#include "../include/sv/core/util.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+using namespace sv::sim;
+using sv::detail::mix;
+
+namespace
+{
+    /// @brief Rotates phasors by a step in place
+    void rotate(double* real, double* imag, const double* stepCos, const double* stepSin, const size_t count)
+    {
+        for (size_t n = 0; n < count; ++n)
+        {
+            const double r = real[n];
+            real[n] = r * stepCos[n] - imag[n] * stepSin[n];
+            imag[n] = imag[n] * stepCos[n] + r * stepSin[n];
+        }
+    }
+}
+
+WaveformDefinition WaveformDefinition::balanced(const double currentRms, const double voltageRms,
+                                                const double currentAngleRad)
+{
+    WaveformDefinition definition;
+    for (size_t phase = 0; phase < 3; ++phase)
+    {
+        const double angle = -2.0 * std::numbers::pi * static_cast<double>(phase) / 3.0;
+        definition.channels[phase].rms = currentRms;
+        definition.channels[phase].phaseRad = angle + currentAngleRad;
+        definition.channels[4 + phase].rms = voltageRms;
+        definition.channels[4 + phase].phaseRad = angle;
+    }
+    return definition;
+}
+
+WaveformGenerator::Ptr WaveformGenerator::create(const SamplesPerPeriod samplesPerPeriod,
+                                                 const SignalFrequency frequency,
+                                                 const uint64_t seed)
+{
+    // SignalFrequency counts tenths of a hertz
+    return Ptr(new WaveformGenerator(static_cast<size_t>(samplesPerPeriod), static_cast<double>(frequency) / 10.0, seed));
+}
+
+WaveformGenerator::Ptr WaveformGenerator::create(const size_t samplesPerPeriod, const double frequencyHz,
+                                                 const uint64_t seed)
+{
+    if (samplesPerPeriod < 4 || !(frequencyHz > 0.0))
+    {
+        throw std::invalid_argument("Need at least 4 samples per period and a positive frequency");
+    }
+    return Ptr(new WaveformGenerator(samplesPerPeriod, frequencyHz, seed));
+}
+
+WaveformGenerator::WaveformGenerator(const size_t samplesPerPeriod, const double frequencyHz, const uint64_t seed)
+    : samplesPerPeriod_(samplesPerPeriod)
+    , samplePeriodS_(1.0 / (frequencyHz * static_cast<double>(samplesPerPeriod)))
+    , stepCos_(std::cos(2.0 * std::numbers::pi / static_cast<double>(samplesPerPeriod)))
+    , stepSin_(std::sin(2.0 * std::numbers::pi / static_cast<double>(samplesPerPeriod)))
+    , seed_(seed)
+{
+}
+
+size_t WaveformGenerator::addStream(const WaveformDefinition& definition)
+{
+    if (definition.currentScaling <= 0 || definition.voltageScaling <= 0)
+    {
+        throw std::invalid_argument("Scaling must be positive");
+    }
+    for (const auto& channel : definition.channels)
+    {
+        if (channel.dcTimeConstantS < 0.0 || channel.noiseRms < 0.0)
+        {
+            throw std::invalid_argument("DC time constant and noise must not be negative");
+        }
+        for (const auto& harmonic : channel.harmonics)
+        {
+            if (harmonic.order < 2 || 2 * harmonic.order >= samplesPerPeriod_)
+            {
+                throw std::invalid_argument("Harmonic order must be between 2 and half the samples per period");
+            }
+        }
+    }
+
+    // A stream added later starts at the phase of the current sample
+    const double cycleAngle = 2.0 * std::numbers::pi * static_cast<double>(samples_ % samplesPerPeriod_) /
+                              static_cast<double>(samplesPerPeriod_);
+    const size_t stream = getStreamCount();
+    auto& state = streams_.emplace_back();
+    output_.resize(output_.size() + VALUES_PER_ASDU);
+
+    for (size_t n = 0; n < VALUES_PER_ASDU; ++n)
+    {
+        const auto& channel = definition.channels[n];
+        const size_t index = stream * VALUES_PER_ASDU + n;
+
+        const auto start = std::polar(std::numbers::sqrt2 * channel.rms, channel.phaseRad);
+        const auto now = start * std::polar(1.0, cycleAngle);
+        state.startReal[n] = start.real();
+        state.startImag[n] = start.imag();
+        state.real[n] = now.real();
+        state.imag[n] = now.imag();
+
+        state.dc[n] = channel.dcOffset;
+        state.dcDecay[n] = channel.dcTimeConstantS > 0.0 ? std::exp(-samplePeriodS_ / channel.dcTimeConstantS) : 1.0;
+        state.scale[n] = n < VALUES_PER_ASDU / 2 ? definition.currentScaling : definition.voltageScaling;
+        state.extra[n] = 0.0;
+
+        // Uniform noise in [-a, a] has an RMS of a / sqrt(3)
+        state.noise[n] = mix(seed_ ^ mix(index)) | 1;
+        state.noiseScale[n] = channel.noiseRms * std::numbers::sqrt3;
+        noisy_ = noisy_ || channel.noiseRms > 0.0;
+
+        for (const auto& harmonic : channel.harmonics)
+        {
+            const double order = harmonic.order;
+            const auto harmonicStart = std::polar(std::numbers::sqrt2 * harmonic.rms, harmonic.phaseRad);
+            const auto harmonicNow = harmonicStart * std::polar(1.0, order * cycleAngle);
+            harmonicStartReal_.push_back(harmonicStart.real());
+            harmonicStartImag_.push_back(harmonicStart.imag());
+            harmonicReal_.push_back(harmonicNow.real());
+            harmonicImag_.push_back(harmonicNow.imag());
+            harmonicStepCos_.push_back(std::cos(2.0 * std::numbers::pi * order / static_cast<double>(samplesPerPeriod_)));
+            harmonicStepSin_.push_back(std::sin(2.0 * std::numbers::pi * order / static_cast<double>(samplesPerPeriod_)));
+            harmonicChannel_.push_back(static_cast<uint32_t>(index));
+        }
+    }
+    return stream;
+}
+
+std::span<const int32_t> WaveformGenerator::step()
+{
+    // Every oscillator completes whole turns per cycle: restart from the exact phasors
+    if (samples_ % samplesPerPeriod_ == 0)
+    {
+        for (auto& state : streams_)
+        {
+            state.real = state.startReal;
+            state.imag = state.startImag;
+        }
+        std::copy(harmonicStartReal_.begin(), harmonicStartReal_.end(), harmonicReal_.begin());
+        std::copy(harmonicStartImag_.begin(), harmonicStartImag_.end(), harmonicImag_.begin());
+    }
+
+    // Noise and harmonics are summed into the extra lanes first
+    if (noisy_)
+    {
+        // xorshift64 per channel; the top 52 bits as the mantissa of [2, 4) map to [-1, 1) without
+        // an integer conversion, which SSE and AVX2 lack for 64-bit lanes
+        for (auto& state : streams_)
+        {
+            for (size_t n = 0; n < VALUES_PER_ASDU; ++n)
+            {
+                uint64_t noise = state.noise[n];
+                noise ^= noise << 13;
+                noise ^= noise >> 7;
+                noise ^= noise << 17;
+                state.noise[n] = noise;
+                state.extra[n] = (std::bit_cast<double>((noise >> 12) | 0x4000000000000000ull) - 3.0) * state.noiseScale[n];
+            }
+        }
+    }
+
+    const size_t harmonics = harmonicReal_.size();
+    if (harmonics > 0)
+    {
+        if (!noisy_)
+        {
+            for (auto& state : streams_)
+            {
+                state.extra.fill(0.0);
+            }
+        }
+        for (size_t n = 0; n < harmonics; ++n)
+        {
+            const uint32_t channel = harmonicChannel_[n];
+            streams_[channel / VALUES_PER_ASDU].extra[channel % VALUES_PER_ASDU] += harmonicReal_[n];
+        }
+        rotate(harmonicReal_.data(), harmonicImag_.data(), harmonicStepCos_.data(), harmonicStepSin_.data(), harmonics);
+    }
+
+    // Round half away from zero by truncation. The step is copied and the lanes are scaled into
+    // a local array, so that no store can alias them and every loop maps onto vector registers.
+    constexpr double low = std::numeric_limits<int32_t>::min();
+    constexpr double high = std::numeric_limits<int32_t>::max();
+    const double stepCos = stepCos_;
+    const double stepSin = stepSin_;
+    int32_t* output = output_.data();
+    for (auto& state : streams_)
+    {
+        std::array<double, VALUES_PER_ASDU> scaled;
+        for (size_t n = 0; n < VALUES_PER_ASDU; ++n)
+        {
+            const double r = state.real[n];
+            scaled[n] = (r + state.dc[n] + state.extra[n]) * state.scale[n];
+            scaled[n] += scaled[n] < 0.0 ? -0.5 : 0.5;
+            state.dc[n] *= state.dcDecay[n];
+            state.real[n] = r * stepCos - state.imag[n] * stepSin;
+            state.imag[n] = state.imag[n] * stepCos + r * stepSin;
+        }
+        for (size_t n = 0; n < VALUES_PER_ASDU; ++n)
+        {
+            output[n] = static_cast<int32_t>(std::clamp(scaled[n], low, high));
+        }
+        output += VALUES_PER_ASDU;
+    }
+
+    ++samples_;
+    return output_;
+}
+
+void WaveformGenerator::generate(std::span<int32_t> out)
+{
+    const size_t width = output_.size();
+    if (width == 0 || out.size() % width != 0)
+    {
+        throw std::invalid_argument("Output size must be a multiple of one sample of all streams");
+    }
+
+    for (size_t offset = 0; offset < out.size(); offset += width)
+    {
+        const auto sample = step();
+        std::copy(sample.begin(), sample.end(), out.begin() + static_cast<std::ptrdiff_t>(offset));
+    }
+}
+
+void WaveformGenerator::toAnalogValues(const size_t stream, std::vector<AnalogValue>& values) const
+{
+    if (stream >= getStreamCount())
+    {
+        throw std::out_of_range("Stream index out of range");
+    }
+
+    values.resize(VALUES_PER_ASDU);
+    for (size_t n = 0; n < VALUES_PER_ASDU; ++n)
+    {
+        values[n].value = output_[stream * VALUES_PER_ASDU + n];
+    }
+}
+
+size_t WaveformGenerator::getStreamCount() const noexcept
+{
+    return output_.size() / VALUES_PER_ASDU;
+}
+
+uint64_t WaveformGenerator::getSampleCount() const noexcept
+{
+    return samples_;
+}
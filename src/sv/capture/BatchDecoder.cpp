@@ -0,0 +1,364 @@
+#include "sv/capture/BatchDecoder.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <execution>
+#include <stdexcept>
+
+using namespace sv;
+
+namespace
+{
+    /// @brief SV header size before the first ASDU (APPID, length, reserved 1/2, noASDU).
+    constexpr size_t SV_HEADER_SIZE = 9;
+
+    /// @brief Offsets inside the ASDU.
+    constexpr size_t SVID_SIZE = 64;
+    constexpr size_t SMPCNT_OFFSET = SVID_SIZE;
+    constexpr size_t CONFREV_OFFSET = SMPCNT_OFFSET + 2;
+    constexpr size_t SMPSYNCH_OFFSET = CONFREV_OFFSET + 4;
+    constexpr size_t DATASET_OFFSET = SMPSYNCH_OFFSET + 1;
+
+    /// @brief Sizes of the optional gmIdentity, the dataset and the timestamp.
+    constexpr size_t GM_IDENTITY_SIZE = 8;
+    constexpr size_t DATASET_SIZE = VALUES_PER_ASDU * 8;
+    constexpr size_t TIMESTAMP_SIZE = 8;
+
+    /**
+     * @brief Reads an unaligned big-endian 16-bit value.
+     * @param p The source pointer.
+     * @return The value.
+     */
+    uint16_t loadBe16(const uint8_t* p) noexcept
+    {
+        uint16_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return std::byteswap(value);
+    }
+
+    /**
+     * @brief Reads an unaligned big-endian 32-bit value.
+     * @param p The source pointer.
+     * @return The value.
+     */
+    uint32_t loadBe32(const uint8_t* p) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return std::byteswap(value);
+    }
+
+    /**
+     * @brief Reads an unaligned big-endian 64-bit value.
+     * @param p The source pointer.
+     * @return The value.
+     */
+    uint64_t loadBe64(const uint8_t* p) noexcept
+    {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return std::byteswap(value);
+    }
+
+    /// @brief Locates the identity fields of a decoded frame without copying them. \struct StreamKey
+    struct StreamKey
+    {
+        const uint8_t* frame{nullptr};
+        uint16_t svOffset{0};
+        uint16_t tci{0};
+
+        /// @brief Start of the SV header (APPID).
+        [[nodiscard]] const uint8_t* sv() const noexcept { return frame + svOffset; }
+        /// @brief Start of the first ASDU (svID).
+        [[nodiscard]] const uint8_t* asdu() const noexcept { return sv() + SV_HEADER_SIZE; }
+
+        /// @brief Compares addresses, VLAN, APPID, simulate, svID, confRev and smpSynch.
+        [[nodiscard]] bool sameStream(const StreamKey& other) const noexcept
+        {
+            return (tci & 0x0FFF) == (other.tci & 0x0FFF)
+                && std::memcmp(frame, other.frame, 12) == 0                       // MAC addresses
+                && std::memcmp(sv(), other.sv(), 2) == 0                          // APPID
+                && ((sv()[4] ^ other.sv()[4]) & 0x80) == 0                        // simulate bit
+                && std::memcmp(asdu(), other.asdu(), SVID_SIZE) == 0
+                && std::memcmp(asdu() + CONFREV_OFFSET, other.asdu() + CONFREV_OFFSET, 5) == 0;
+        }
+    };
+
+    /// @brief A run of rows of one stream within a chunk. \struct ChunkRun
+    struct ChunkRun
+    {
+        StreamKey key;
+        size_t firstRow{0};
+        size_t rowCount{0};
+    };
+
+    /// @brief Per-chunk decode result. \struct ChunkResult
+    struct ChunkResult
+    {
+        size_t decoded{0};
+        size_t rejected{0};
+        std::vector<ChunkRun> runs;
+    };
+
+    /**
+     * @brief Clears a row of frames that could not be decoded.
+     * @param columns The output columns.
+     * @param row The row index.
+     */
+    void clearRow(const SampleColumns& columns, const size_t row) noexcept
+    {
+        columns.smpCnt[row] = 0;
+        columns.timestampNs[row] = 0;
+        for (size_t ch = 0; ch < VALUES_PER_ASDU; ++ch)
+        {
+            columns.value[ch][row] = 0;
+            if (!columns.quality[ch].empty())
+            {
+                columns.quality[ch][row] = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Decodes one frame into a row.
+     * @param frame The frame bytes.
+     * @param columns The output columns.
+     * @param row The row index.
+     * @param key Receives the stream identity location.
+     * @return false if the frame is not a decodable SV frame.
+     */
+    bool decodeRow(const std::span<const uint8_t> frame, const SampleColumns& columns, const size_t row, StreamKey& key) noexcept
+    {
+        const uint8_t* p = frame.data();
+        const size_t size = frame.size();
+
+        size_t offset = 12;
+        if (size < offset + 2)
+        {
+            return false;
+        }
+
+        uint16_t etherType = loadBe16(p + offset);
+        uint16_t tci = 0;
+        if (etherType == VLAN_TAG_TPID)
+        {
+            if (size < offset + 6)
+            {
+                return false;
+            }
+            tci = loadBe16(p + offset + 2);
+            offset += 4;
+            etherType = loadBe16(p + offset);
+        }
+        offset += 2;
+
+        if (etherType != SV_ETHER_TYPE || size < offset + SV_HEADER_SIZE + DATASET_OFFSET + DATASET_SIZE)
+        {
+            return false;
+        }
+
+        const uint8_t* sv = p + offset;
+        const uint8_t numASDUs = sv[8];
+        if (numASDUs == 0 || numASDUs > MAX_ASDUS_PER_MESSAGE)
+        {
+            return false;
+        }
+
+        const uint8_t* asdu = sv + SV_HEADER_SIZE;
+        if (asdu[0] == 0 || asdu[1] == 0)
+        {
+            return false;   // svID shorter than two characters
+        }
+
+        // The SV length field counts the bytes after itself; it tells whether gmIdentity is present
+        const size_t svPayload = std::min<size_t>(loadBe16(sv + 2), size - offset - 4);
+        if (svPayload < (SV_HEADER_SIZE - 4) + DATASET_OFFSET + DATASET_SIZE)
+        {
+            return false;
+        }
+        const size_t afterSynch = svPayload - (SV_HEADER_SIZE - 4) - DATASET_OFFSET;
+        const bool hasGmIdentity = afterSynch >= GM_IDENTITY_SIZE + DATASET_SIZE + TIMESTAMP_SIZE;
+        const uint8_t* data = asdu + DATASET_OFFSET + (hasGmIdentity ? GM_IDENTITY_SIZE : 0);
+        if (data + DATASET_SIZE > p + size)
+        {
+            return false;
+        }
+
+        columns.smpCnt[row] = loadBe16(asdu + SMPCNT_OFFSET);
+        for (size_t ch = 0; ch < VALUES_PER_ASDU; ++ch)
+        {
+            columns.value[ch][row] = static_cast<int32_t>(loadBe32(data + ch * 8));
+            if (!columns.quality[ch].empty())
+            {
+                columns.quality[ch][row] = loadBe32(data + ch * 8 + 4);
+            }
+        }
+
+        const uint8_t* ts = data + DATASET_SIZE;
+        columns.timestampNs[row] = ts + TIMESTAMP_SIZE <= p + size ? static_cast<int64_t>(loadBe64(ts)) : 0;
+
+        key.frame = p;
+        key.svOffset = static_cast<uint16_t>(offset);
+        key.tci = tci;
+        return true;
+    }
+
+    /**
+     * @brief Decodes a contiguous range of frames.
+     * @param frames All frames.
+     * @param columns The output columns.
+     * @param begin First frame of the chunk.
+     * @param end One past the last frame of the chunk.
+     * @param result Receives the chunk counters and runs.
+     */
+    void decodeChunk(const std::span<const std::span<const uint8_t>> frames, const SampleColumns& columns,
+                     const size_t begin, const size_t end, ChunkResult& result)
+    {
+        for (size_t row = begin; row < end; ++row)
+        {
+            StreamKey key;
+            if (!decodeRow(frames[row], columns, row, key))
+            {
+                clearRow(columns, row);
+                ++result.rejected;
+                continue;
+            }
+
+            ++result.decoded;
+            if (!result.runs.empty())
+            {
+                ChunkRun& last = result.runs.back();
+                if (last.firstRow + last.rowCount == row && last.key.sameStream(key))
+                {
+                    ++last.rowCount;
+                    continue;
+                }
+            }
+            result.runs.push_back({key, row, 1});
+        }
+    }
+
+    /**
+     * @brief Materialises the identity of a run.
+     * @param run The chunk run.
+     * @return The StreamRun.
+     */
+    StreamRun toStreamRun(const ChunkRun& run)
+    {
+        const StreamKey& key = run.key;
+        const uint8_t* asdu = key.asdu();
+
+        StreamRun stream;
+        const auto* svId = reinterpret_cast<const char*>(asdu);
+        stream.svID.assign(svId, strnlen(svId, SVID_SIZE));
+        while (!stream.svID.empty() && stream.svID.back() == ' ')
+        {
+            stream.svID.pop_back();
+        }
+        stream.appID = loadBe16(key.sv());
+        stream.simulate = (key.sv()[4] & 0x80) != 0;
+        stream.confRev = loadBe32(asdu + CONFREV_OFFSET);
+        const uint8_t synch = asdu[SMPSYNCH_OFFSET];
+        stream.smpSynch = synch <= static_cast<uint8_t>(SmpSynch::Global) ? static_cast<SmpSynch>(synch) : SmpSynch::None;
+        stream.vlanID = key.tci & 0x0FFF;
+        std::copy_n(key.frame, 6, stream.destMac.begin());
+        std::copy_n(key.frame + 6, 6, stream.srcMac.begin());
+        stream.firstRow = run.firstRow;
+        stream.rowCount = run.rowCount;
+        return stream;
+    }
+}
+
+size_t SampleColumns::capacity() const noexcept
+{
+    size_t rows = std::min(smpCnt.size(), timestampNs.size());
+    for (size_t ch = 0; ch < VALUES_PER_ASDU; ++ch)
+    {
+        rows = std::min(rows, value[ch].size());
+        if (!quality[ch].empty())
+        {
+            rows = std::min(rows, quality[ch].size());
+        }
+    }
+    return rows;
+}
+
+BatchDecodeResult BatchDecoder::decode(const std::span<const std::span<const uint8_t>> frames, const SampleColumns& columns,
+                                       const size_t chunkSize)
+{
+    if (columns.capacity() < frames.size())
+    {
+        throw std::invalid_argument("Columns hold " + std::to_string(columns.capacity()) + " rows, " +
+                                    std::to_string(frames.size()) + " frames given");
+    }
+
+    const size_t step = chunkSize == 0 ? std::max<size_t>(frames.size(), 1) : chunkSize;
+    std::vector<ChunkResult> chunks((frames.size() + step - 1) / step);
+
+    const auto decodeOne = [&](ChunkResult& chunk)
+    {
+        const size_t begin = static_cast<size_t>(&chunk - chunks.data()) * step;
+        decodeChunk(frames, columns, begin, std::min(begin + step, frames.size()), chunk);
+    };
+
+    if (chunks.size() > 1)
+    {
+        std::for_each(std::execution::par, chunks.begin(), chunks.end(), decodeOne);
+    }
+    else
+    {
+        std::for_each(chunks.begin(), chunks.end(), decodeOne);
+    }
+
+    // Merge chunk runs, joining runs of the same stream that span a chunk boundary
+    BatchDecodeResult result;
+    const ChunkRun* previous = nullptr;
+    for (const ChunkResult& chunk : chunks)
+    {
+        result.decoded += chunk.decoded;
+        result.rejected += chunk.rejected;
+
+        for (const ChunkRun& run : chunk.runs)
+        {
+            if (previous != nullptr && !result.runs.empty())
+            {
+                StreamRun& last = result.runs.back();
+                if (last.firstRow + last.rowCount == run.firstRow && previous->key.sameStream(run.key))
+                {
+                    last.rowCount += run.rowCount;
+                    previous = &run;
+                    continue;
+                }
+            }
+            result.runs.push_back(toStreamRun(run));
+            previous = &run;
+        }
+    }
+
+    return result;
+}
+
+BatchDecoder::Storage::Storage(const size_t rows)
+    : smpCnt(rows)
+    , timestampNs(rows)
+{
+    for (size_t ch = 0; ch < VALUES_PER_ASDU; ++ch)
+    {
+        value[ch].resize(rows);
+        quality[ch].resize(rows);
+    }
+}
+
+SampleColumns BatchDecoder::Storage::columns()
+{
+    SampleColumns columns;
+    columns.smpCnt = smpCnt;
+    columns.timestampNs = timestampNs;
+    for (size_t ch = 0; ch < VALUES_PER_ASDU; ++ch)
+    {
+        columns.value[ch] = value[ch];
+        columns.quality[ch] = quality[ch];
+    }
+    return columns;
+}
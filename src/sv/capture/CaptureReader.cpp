@@ -0,0 +1,303 @@
+#include "sv/capture/CaptureReader.h"
+#include "sv/capture/PcapngWriter.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace sv;
+
+namespace
+{
+    /// @brief Classic pcap magic numbers as read in host order.
+    constexpr uint32_t PCAP_MAGIC_US = 0xA1B2C3D4;
+    constexpr uint32_t PCAP_MAGIC_NS = 0xA1B23C4D;
+
+    /// @brief Classic pcap global and record header sizes.
+    constexpr size_t PCAP_GLOBAL_HEADER_SIZE = 24;
+    constexpr size_t PCAP_RECORD_HEADER_SIZE = 16;
+
+    /// @brief pcapng Simple Packet Block type.
+    constexpr uint32_t SIMPLE_PACKET_BLOCK = 0x00000003;
+
+    /// @brief Minimum size of a pcapng block (type, two lengths).
+    constexpr size_t PCAPNG_MIN_BLOCK_SIZE = 12;
+
+    /**
+     * @brief Reads an unaligned host-order 32-bit value.
+     * @param p The source pointer.
+     * @return The value.
+     */
+    uint32_t loadRaw32(const uint8_t* p) noexcept
+    {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+}
+
+std::unique_ptr<CaptureReader> CaptureReader::open(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Failed to open capture file " + path + ": " + std::string(strerror(errno)));
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) < 0 || st.st_size < static_cast<off_t>(PCAPNG_MIN_BLOCK_SIZE))
+    {
+        ::close(fd);
+        throw std::runtime_error("Capture file " + path + " is empty or unreadable");
+    }
+
+    const auto size = static_cast<size_t>(st.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Failed to map capture file " + path + ": " + std::string(strerror(errno)));
+    }
+    madvise(mapping, size, MADV_SEQUENTIAL);
+
+    std::unique_ptr<CaptureReader> reader(new CaptureReader(static_cast<const uint8_t*>(mapping), size));
+
+    const uint32_t magic = loadRaw32(reader->data_);
+    if (magic == pcapng::SECTION_HEADER_BLOCK)
+    {
+        reader->format_ = CaptureFormat::Pcapng;
+        reader->firstRecord_ = 0;
+    }
+    else if (magic == PCAP_MAGIC_US || magic == PCAP_MAGIC_NS ||
+             magic == std::byteswap(PCAP_MAGIC_US) || magic == std::byteswap(PCAP_MAGIC_NS))
+    {
+        if (size < PCAP_GLOBAL_HEADER_SIZE)
+        {
+            throw std::runtime_error("Truncated pcap header in " + path);
+        }
+        reader->format_ = CaptureFormat::Pcap;
+        reader->swapped_ = magic == std::byteswap(PCAP_MAGIC_US) || magic == std::byteswap(PCAP_MAGIC_NS);
+        reader->pcapNanoseconds_ = magic == PCAP_MAGIC_NS || magic == std::byteswap(PCAP_MAGIC_NS);
+        reader->firstRecord_ = PCAP_GLOBAL_HEADER_SIZE;
+    }
+    else
+    {
+        throw std::runtime_error("Not a pcap or pcapng file: " + path);
+    }
+
+    reader->rewind();
+    return reader;
+}
+
+CaptureReader::CaptureReader(const uint8_t* data, const size_t size)
+    : data_(data)
+    , size_(size)
+{
+}
+
+CaptureReader::~CaptureReader()
+{
+    munmap(const_cast<uint8_t*>(data_), size_);
+}
+
+uint16_t CaptureReader::read16(const size_t offset) const noexcept
+{
+    uint16_t value;
+    std::memcpy(&value, data_ + offset, sizeof(value));
+    return swapped_ ? std::byteswap(value) : value;
+}
+
+uint32_t CaptureReader::read32(const size_t offset) const noexcept
+{
+    const uint32_t value = loadRaw32(data_ + offset);
+    return swapped_ ? std::byteswap(value) : value;
+}
+
+std::optional<CapturedFrame> CaptureReader::next()
+{
+    return format_ == CaptureFormat::Pcap ? nextPcap() : nextPcapng();
+}
+
+void CaptureReader::rewind()
+{
+    offset_ = firstRecord_;
+    interfaces_.clear();
+}
+
+std::vector<CapturedFrame> CaptureReader::readAll()
+{
+    std::vector<CapturedFrame> frames;
+    while (auto frame = next())
+    {
+        frames.push_back(*frame);
+    }
+    return frames;
+}
+
+CaptureFormat CaptureReader::getFormat() const noexcept
+{
+    return format_;
+}
+
+size_t CaptureReader::getFileSize() const noexcept
+{
+    return size_;
+}
+
+std::optional<CapturedFrame> CaptureReader::nextPcap()
+{
+    if (offset_ + PCAP_RECORD_HEADER_SIZE > size_)
+    {
+        return std::nullopt;
+    }
+
+    const uint64_t seconds = read32(offset_);
+    const uint64_t fraction = read32(offset_ + 4);
+    const uint32_t capturedLength = read32(offset_ + 8);
+    const uint32_t originalLength = read32(offset_ + 12);
+
+    const size_t dataOffset = offset_ + PCAP_RECORD_HEADER_SIZE;
+    if (capturedLength > size_ - dataOffset)
+    {
+        return std::nullopt;
+    }
+
+    CapturedFrame frame;
+    frame.data = std::span<const uint8_t>(data_ + dataOffset, capturedLength);
+    frame.timestampNs = seconds * 1'000'000'000ULL + (pcapNanoseconds_ ? fraction : fraction * 1000ULL);
+    frame.originalLength = originalLength;
+
+    offset_ = dataOffset + capturedLength;
+    return frame;
+}
+
+std::optional<CapturedFrame> CaptureReader::nextPcapng()
+{
+    while (offset_ + PCAPNG_MIN_BLOCK_SIZE <= size_)
+    {
+        const uint32_t rawType = loadRaw32(data_ + offset_);
+
+        if (rawType == pcapng::SECTION_HEADER_BLOCK)
+        {
+            // Every section may switch byte order and redefines its interfaces
+            const uint32_t magic = loadRaw32(data_ + offset_ + 8);
+            if (magic == pcapng::BYTE_ORDER_MAGIC)
+            {
+                swapped_ = false;
+            }
+            else if (magic == std::byteswap(pcapng::BYTE_ORDER_MAGIC))
+            {
+                swapped_ = true;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+            interfaces_.clear();
+        }
+
+        const uint32_t type = read32(offset_);
+        const uint32_t length = read32(offset_ + 4);
+        if (length < PCAPNG_MIN_BLOCK_SIZE || (length & 3) != 0 || length > size_ - offset_)
+        {
+            return std::nullopt;
+        }
+
+        const size_t block = offset_;
+        offset_ += length;
+
+        if (type == pcapng::INTERFACE_DESCRIPTION_BLOCK)
+        {
+            parseInterfaceDescription(block, length);
+        }
+        else if (type == pcapng::ENHANCED_PACKET_BLOCK && length >= 32)
+        {
+            const uint32_t interfaceId = read32(block + 8);
+            const uint64_t raw = (static_cast<uint64_t>(read32(block + 12)) << 32) | read32(block + 16);
+            const uint32_t capturedLength = read32(block + 20);
+            if (capturedLength > length - 32)
+            {
+                return std::nullopt;
+            }
+
+            CapturedFrame frame;
+            frame.data = std::span<const uint8_t>(data_ + block + 28, capturedLength);
+            frame.timestampNs = toNanoseconds(interfaceId, raw);
+            frame.originalLength = read32(block + 24);
+            return frame;
+        }
+        else if (type == SIMPLE_PACKET_BLOCK && length >= 16)
+        {
+            const uint32_t originalLength = read32(block + 8);
+
+            CapturedFrame frame;
+            frame.data = std::span<const uint8_t>(data_ + block + 12, std::min<size_t>(originalLength, length - 16));
+            frame.originalLength = originalLength;
+            return frame;
+        }
+    }
+
+    return std::nullopt;
+}
+
+void CaptureReader::parseInterfaceDescription(const size_t offset, const uint32_t length)
+{
+    Resolution resolution;
+
+    // Options start after type, length, linktype, reserved and snaplen
+    size_t option = offset + 16;
+    const size_t end = offset + length - 4;
+    while (option + 4 <= end)
+    {
+        const uint16_t code = read16(option);
+        const uint16_t optionLength = read16(option + 2);
+        if (code == pcapng::OPTION_END || option + 4 + optionLength > end)
+        {
+            break;
+        }
+        if (code == pcapng::OPTION_IF_TSRESOL && optionLength >= 1)
+        {
+            const uint8_t value = data_[option + 4];
+            resolution.base2 = (value & 0x80) != 0;
+            resolution.exponent = value & 0x7F;
+        }
+        option += 4 + ((static_cast<size_t>(optionLength) + 3) & ~static_cast<size_t>(3));
+    }
+
+    interfaces_.push_back(resolution);
+}
+
+uint64_t CaptureReader::toNanoseconds(const uint32_t interfaceId, const uint64_t raw) const noexcept
+{
+    const Resolution resolution = interfaceId < interfaces_.size() ? interfaces_[interfaceId] : Resolution{};
+
+    if (resolution.base2)
+    {
+        const long double seconds = std::ldexp(static_cast<long double>(raw), -static_cast<int>(resolution.exponent));
+        return static_cast<uint64_t>(seconds * 1e9L);
+    }
+
+    uint64_t value = raw;
+    if (resolution.exponent <= 9)
+    {
+        for (int i = resolution.exponent; i < 9; ++i)
+        {
+            value *= 10;
+        }
+    }
+    else
+    {
+        for (int i = 9; i < resolution.exponent; ++i)
+        {
+            value /= 10;
+        }
+    }
+    return value;
+}
@@ -0,0 +1,157 @@
+#include "sv/capture/CaptureReplayer.h"
+#include "sv/network/FrameCodec.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <ctime>
+#include <stdexcept>
+
+using namespace sv;
+
+namespace
+{
+    /**
+     * @brief Reads CLOCK_MONOTONIC.
+     * @return The time in nanoseconds.
+     */
+    uint64_t monotonicNs() noexcept
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    /**
+     * @brief Sleeps until an absolute CLOCK_MONOTONIC deadline.
+     * @param deadlineNs The deadline in nanoseconds.
+     */
+    void sleepUntil(const uint64_t deadlineNs) noexcept
+    {
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(deadlineNs / 1'000'000'000ULL);
+        ts.tv_nsec = static_cast<long>(deadlineNs % 1'000'000'000ULL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+        {
+        }
+    }
+}
+
+double ReplayStats::framesPerSecond() const noexcept
+{
+    return elapsedSeconds > 0.0 ? static_cast<double>(frames) / elapsedSeconds : 0.0;
+}
+
+std::unique_ptr<CaptureReplayer> CaptureReplayer::create(const std::string& path)
+{
+    return std::unique_ptr<CaptureReplayer>(new CaptureReplayer(CaptureReader::open(path)));
+}
+
+CaptureReplayer::CaptureReplayer(std::unique_ptr<CaptureReader> reader)
+    : reader_(std::move(reader))
+    , frames_(reader_->readAll())
+{
+}
+
+ReplayStats CaptureReplayer::replay(const ReplayOptions& options, const FrameSink& sink)
+{
+    if (options.timing == ReplayTiming::Scaled && !(options.speed > 0.0))
+    {
+        throw std::invalid_argument("Replay speed must be positive");
+    }
+
+    const double scale = options.timing == ReplayTiming::Scaled ? 1.0 / options.speed : 1.0;
+    const bool paced = options.timing != ReplayTiming::AsFastAsPossible;
+
+    stopRequested_.store(false, std::memory_order_relaxed);
+
+    ReplayStats stats;
+    const uint64_t startNs = monotonicNs();
+
+    for (size_t loop = 0; loop < options.loops && !stopRequested_.load(std::memory_order_relaxed); ++loop)
+    {
+        const uint64_t loopStartNs = monotonicNs();
+        const uint64_t firstTimestampNs = frames_.empty() ? 0 : frames_.front().timestampNs;
+
+        for (const CapturedFrame& frame : frames_)
+        {
+            if (stopRequested_.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            if (paced && frame.timestampNs > firstTimestampNs)
+            {
+                const auto offsetNs = static_cast<uint64_t>(static_cast<double>(frame.timestampNs - firstTimestampNs) * scale);
+                const uint64_t deadlineNs = loopStartNs + offsetNs;
+                const uint64_t nowNs = monotonicNs();
+                if (nowNs < deadlineNs)
+                {
+                    sleepUntil(deadlineNs);
+                }
+                else
+                {
+                    const uint64_t latenessNs = nowNs - deadlineNs;
+                    stats.maxLatenessNs = std::max(stats.maxLatenessNs, latenessNs);
+                    if (latenessNs > LATE_THRESHOLD_NS)
+                    {
+                        ++stats.lateFrames;
+                    }
+                }
+            }
+
+            if (sink(frame))
+            {
+                ++stats.frames;
+                stats.bytes += frame.data.size();
+            }
+            else
+            {
+                ++stats.rejected;
+            }
+        }
+    }
+
+    stats.elapsedSeconds = static_cast<double>(monotonicNs() - startNs) / 1e9;
+    return stats;
+}
+
+ReplayStats CaptureReplayer::replayTo(NetworkSender& sender, const ReplayOptions& options)
+{
+    return replay(options, [&sender](const CapturedFrame& frame)
+    {
+        return sender.sendRawFrame(frame.data);
+    });
+}
+
+ReplayStats CaptureReplayer::replayToParser(const NetworkReceiver::Callback& callback, const ReplayOptions& options)
+{
+    return replay(options, [&callback](const CapturedFrame& frame)
+    {
+        const auto asdu = FrameCodec::decode(frame.data);
+        if (!asdu.has_value())
+        {
+            return false;
+        }
+        callback(*asdu);
+        return true;
+    });
+}
+
+void CaptureReplayer::stop() noexcept
+{
+    stopRequested_.store(true, std::memory_order_relaxed);
+}
+
+size_t CaptureReplayer::getFrameCount() const noexcept
+{
+    return frames_.size();
+}
+
+uint64_t CaptureReplayer::getCaptureDurationNs() const noexcept
+{
+    if (frames_.size() < 2 || frames_.back().timestampNs < frames_.front().timestampNs)
+    {
+        return 0;
+    }
+    return frames_.back().timestampNs - frames_.front().timestampNs;
+}
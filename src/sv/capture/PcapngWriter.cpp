@@ -0,0 +1,250 @@
+#include "sv/capture/PcapngWriter.h"
+#include "sv/core/logging.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+using namespace sv;
+
+namespace
+{
+    /**
+     * @brief Appends a host-order integer to a buffer position.
+     * @tparam T The integer type.
+     * @param dest The destination pointer; advanced past the value.
+     * @param value The value to store.
+     */
+    template<typename T>
+    void put(uint8_t*& dest, const T value)
+    {
+        std::memcpy(dest, &value, sizeof(T));
+        dest += sizeof(T);
+    }
+
+    /// @brief Size of an Enhanced Packet Block without packet data and options.
+    constexpr size_t EPB_OVERHEAD = 32;
+}
+
+std::unique_ptr<PcapngWriter> PcapngWriter::create(const std::string& path, const size_t bufferSize)
+{
+    const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Failed to open capture file " + path + ": " + std::string(strerror(errno)));
+    }
+    return std::unique_ptr<PcapngWriter>(new PcapngWriter(path, fd, bufferSize));
+}
+
+PcapngWriter::PcapngWriter(std::string path, const int fd, const size_t bufferSize)
+    : path_(std::move(path))
+    , fd_(fd)
+    , active_(&buffers_[0])
+{
+    const size_t size = std::max(bufferSize, EPB_OVERHEAD + DEFAULT_SNAPLEN);
+    buffers_[0].data.resize(size);
+    buffers_[1].data.resize(size);
+
+    writeHeaders();
+    writerThread_ = std::thread(&PcapngWriter::writerLoop, this);
+}
+
+PcapngWriter::~PcapngWriter()
+{
+    close();
+}
+
+void PcapngWriter::writeHeaders()
+{
+    uint8_t* p = active_->data.data();
+
+    // Section Header Block
+    constexpr uint32_t shbLength = 28;
+    put(p, pcapng::SECTION_HEADER_BLOCK);
+    put(p, shbLength);
+    put(p, pcapng::BYTE_ORDER_MAGIC);
+    put(p, static_cast<uint16_t>(1));   // major version
+    put(p, static_cast<uint16_t>(0));   // minor version
+    put(p, static_cast<int64_t>(-1));   // section length unknown
+    put(p, shbLength);
+
+    // Interface Description Block with nanosecond timestamp resolution
+    constexpr uint32_t idbLength = 32;
+    put(p, pcapng::INTERFACE_DESCRIPTION_BLOCK);
+    put(p, idbLength);
+    put(p, pcapng::LINKTYPE_ETHERNET);
+    put(p, static_cast<uint16_t>(0));   // reserved
+    put(p, DEFAULT_SNAPLEN);
+    put(p, pcapng::OPTION_IF_TSRESOL);
+    put(p, static_cast<uint16_t>(1));
+    put(p, static_cast<uint8_t>(9));    // 10^-9
+    put(p, static_cast<uint8_t>(0));    // padding
+    put(p, static_cast<uint16_t>(0));
+    put(p, pcapng::OPTION_END);
+    put(p, static_cast<uint16_t>(0));
+    put(p, idbLength);
+
+    active_->used = static_cast<size_t>(p - active_->data.data());
+}
+
+bool PcapngWriter::capture(const std::span<const uint8_t> frame, const uint64_t timestampNs)
+{
+    const auto capturedLength = static_cast<uint32_t>(std::min<size_t>(frame.size(), DEFAULT_SNAPLEN));
+    const size_t paddedLength = (static_cast<size_t>(capturedLength) + 3) & ~static_cast<size_t>(3);
+    const size_t blockLength = EPB_OVERHEAD + paddedLength;
+
+    if (lastSwapNs_ == 0)
+    {
+        lastSwapNs_ = timestampNs;
+    }
+
+    const bool full = active_->used + blockLength > active_->data.size();
+    const bool stale = active_->used > 0 && timestampNs >= lastSwapNs_ + DEFAULT_FLUSH_INTERVAL_NS;
+
+    if (full || stale)
+    {
+        if (swapBuffers())
+        {
+            lastSwapNs_ = timestampNs;
+        }
+        else if (full)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    uint8_t* p = active_->data.data() + active_->used;
+    put(p, pcapng::ENHANCED_PACKET_BLOCK);
+    put(p, static_cast<uint32_t>(blockLength));
+    put(p, static_cast<uint32_t>(0));   // interface id
+    put(p, static_cast<uint32_t>(timestampNs >> 32));
+    put(p, static_cast<uint32_t>(timestampNs & 0xFFFFFFFF));
+    put(p, capturedLength);
+    put(p, static_cast<uint32_t>(frame.size()));
+    std::memcpy(p, frame.data(), capturedLength);
+    std::memset(p + capturedLength, 0, paddedLength - capturedLength);
+    p += paddedLength;
+    put(p, static_cast<uint32_t>(blockLength));
+
+    active_->used += blockLength;
+    captured_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PcapngWriter::flush()
+{
+    if (active_->used > 0)
+    {
+        swapBuffers();
+    }
+}
+
+bool PcapngWriter::swapBuffers()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_ != nullptr)
+    {
+        return false;
+    }
+
+    pending_ = active_;
+    active_ = (active_ == &buffers_[0]) ? &buffers_[1] : &buffers_[0];
+    cv_.notify_one();
+    return true;
+}
+
+void PcapngWriter::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    for (;;)
+    {
+        cv_.wait(lock, [this]() { return pending_ != nullptr || stopping_; });
+
+        if (pending_ != nullptr)
+        {
+            Buffer* buffer = pending_;
+            lock.unlock();
+            writeBuffer(*buffer);
+            buffer->used = 0;
+            lock.lock();
+            pending_ = nullptr;
+            cv_.notify_all();
+            continue;
+        }
+
+        if (stopping_)
+        {
+            break;
+        }
+    }
+}
+
+void PcapngWriter::writeBuffer(const Buffer& buffer)
+{
+    const uint8_t* data = buffer.data.data();
+    size_t remaining = buffer.used;
+
+    while (remaining > 0)
+    {
+        const ssize_t written = write(fd_, data, remaining);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            LOG_ERROR("Failed to write capture file " + path_ + ": " + std::string(strerror(errno)));
+            return;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+        bytesWritten_.fetch_add(static_cast<uint64_t>(written), std::memory_order_relaxed);
+    }
+}
+
+void PcapngWriter::close()
+{
+    if (fd_ < 0)
+    {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return pending_ == nullptr; });
+        if (active_->used > 0)
+        {
+            pending_ = active_;
+            active_ = (active_ == &buffers_[0]) ? &buffers_[1] : &buffers_[0];
+        }
+        stopping_ = true;
+    }
+    cv_.notify_all();
+
+    if (writerThread_.joinable())
+    {
+        writerThread_.join();
+    }
+
+    ::close(fd_);
+    fd_ = -1;
+}
+
+CaptureStats PcapngWriter::getStats() const noexcept
+{
+    CaptureStats stats;
+    stats.capturedFrames = captured_.load(std::memory_order_relaxed);
+    stats.droppedFrames = dropped_.load(std::memory_order_relaxed);
+    stats.bytesWritten = bytesWritten_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const std::string& PcapngWriter::getPath() const noexcept
+{
+    return path_;
+}
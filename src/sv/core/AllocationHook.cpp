@@ -0,0 +1,106 @@
+/**
+ * @file AllocationHook.cpp
+ * @brief Replacement global operator new/delete reporting to AllocationTracker
+ * @details Not part of iec61850_sv. Binaries opt in by linking the iec61850_sv_alloc_hook
+ *          object library; the nothrow forms of the standard library forward to these.
+ */
+
+#include "sv/core/alloc.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    [[maybe_unused]] const bool installed = (sv::AllocationTracker::install(), true);
+
+    void* allocate(const std::size_t size)
+    {
+        sv::AllocationTracker::recordAllocation(size);
+        if (void* pointer = std::malloc(size == 0 ? 1 : size))
+        {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    void* allocateAligned(const std::size_t size, const std::align_val_t alignment)
+    {
+        sv::AllocationTracker::recordAllocation(size);
+        const auto align = static_cast<std::size_t>(alignment);
+        if (void* pointer = std::aligned_alloc(align, (size + align - 1) / align * align))
+        {
+            return pointer;
+        }
+        throw std::bad_alloc();
+    }
+
+    void deallocate(void* pointer) noexcept
+    {
+        if (pointer != nullptr)
+        {
+            sv::AllocationTracker::recordDeallocation();
+            std::free(pointer);
+        }
+    }
+}
+
+void* operator new(const std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](const std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](const std::size_t size, const std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
@@ -0,0 +1,228 @@
+#include "sv/core/pipeline.h"
+#include "sv/core/logging.h"
+
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace sv;
+
+namespace
+{
+    /// @brief Every shard ever handed out; shards outlive their threads so their counts stay merged
+    struct ShardRegistry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<PipelineLatency::Shard>> shards;
+    };
+
+    ShardRegistry& registry()
+    {
+        static ShardRegistry instance;
+        return instance;
+    }
+
+    /// @brief Returns the calling thread's shard to the registry when the thread exits \struct ShardLease
+    struct ShardLease
+    {
+        PipelineLatency::Shard* shard{nullptr};
+
+        ~ShardLease()
+        {
+            if (shard != nullptr)
+            {
+                shard->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    thread_local ShardLease lease;
+
+    StageLatency summarize(const LatencyHistogram& histogram)
+    {
+        StageLatency stage;
+        stage.count = histogram.count();
+        stage.meanNs = histogram.meanNs();
+        stage.p50Ns = histogram.percentileNs(50.0);
+        stage.p99Ns = histogram.percentileNs(99.0);
+        stage.p999Ns = histogram.percentileNs(99.9);
+        stage.maxNs = histogram.maxNs();
+        return stage;
+    }
+}
+
+std::string PipelineSnapshot::toString() const
+{
+    std::ostringstream oss;
+    oss << "Pipeline latency (" << threads << " threads)";
+    for (size_t n = 0; n < PIPELINE_STAGES; ++n)
+    {
+        const auto& stage = stages[n];
+        oss << "\n  " << std::left << std::setw(10) << sv::toString(static_cast<PipelineStage>(n)) << std::right
+            << " count=" << stage.count
+            << " mean=" << std::fixed << std::setprecision(0) << stage.meanNs << " ns"
+            << " p50=" << stage.p50Ns << " ns"
+            << " p99=" << stage.p99Ns << " ns"
+            << " p99.9=" << stage.p999Ns << " ns"
+            << " max=" << stage.maxNs << " ns";
+    }
+    return oss.str();
+}
+
+PipelineLatency::Shard* PipelineLatency::acquireShard() noexcept
+{
+    auto& shards = registry();
+    std::lock_guard<std::mutex> lock(shards.mutex);
+
+    Shard* shard = nullptr;
+    for (const auto& candidate : shards.shards)
+    {
+        bool expected = false;
+        if (candidate->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            shard = candidate.get();
+            break;
+        }
+    }
+
+    if (shard == nullptr)
+    {
+        try
+        {
+            shards.shards.push_back(std::make_unique<Shard>());
+        }
+        catch (const std::bad_alloc&)
+        {
+            return nullptr;
+        }
+        shard = shards.shards.back().get();
+        shard->inUse.store(true, std::memory_order_relaxed);
+    }
+
+    lease.shard = shard;
+    shard_ = shard;
+    return shard;
+}
+
+PipelineSnapshot PipelineLatency::snapshot()
+{
+    PipelineSnapshot result;
+    const auto merged = std::make_unique<std::array<LatencyHistogram, PIPELINE_STAGES>>();
+    {
+        auto& shards = registry();
+        std::lock_guard<std::mutex> lock(shards.mutex);
+        for (const auto& shard : shards.shards)
+        {
+            for (size_t n = 0; n < PIPELINE_STAGES; ++n)
+            {
+                (*merged)[n].merge(shard->stages[n]);
+            }
+        }
+        result.threads = shards.shards.size();
+    }
+
+    for (size_t n = 0; n < PIPELINE_STAGES; ++n)
+    {
+        result.stages[n] = summarize((*merged)[n]);
+    }
+    return result;
+}
+
+void PipelineLatency::merge(const PipelineStage stage, LatencyHistogram& out)
+{
+    auto& shards = registry();
+    std::lock_guard<std::mutex> lock(shards.mutex);
+    for (const auto& shard : shards.shards)
+    {
+        out.merge(shard->stages[static_cast<size_t>(stage)]);
+    }
+}
+
+void PipelineLatency::reset() noexcept
+{
+    auto& shards = registry();
+    std::lock_guard<std::mutex> lock(shards.mutex);
+    for (const auto& shard : shards.shards)
+    {
+        for (auto& histogram : shard->stages)
+        {
+            histogram.reset();
+        }
+    }
+}
+
+PipelineLatencyReporter::Ptr PipelineLatencyReporter::create(const std::chrono::milliseconds period, Sink sink)
+{
+    if (period.count() <= 0)
+    {
+        throw std::invalid_argument("Pipeline latency report period must be positive");
+    }
+    return Ptr(new PipelineLatencyReporter(period, std::move(sink)));
+}
+
+PipelineLatencyReporter::PipelineLatencyReporter(const std::chrono::milliseconds period, Sink sink)
+    : period_(period)
+    , sink_(sink ? std::move(sink) : Sink([](const PipelineSnapshot& snapshot) { LOG_INFO(snapshot.toString()); }))
+{
+}
+
+PipelineLatencyReporter::~PipelineLatencyReporter()
+{
+    stop();
+}
+
+void PipelineLatencyReporter::start()
+{
+    if (running_.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    thread_ = std::thread(&PipelineLatencyReporter::run, this);
+}
+
+void PipelineLatencyReporter::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_.exchange(false, std::memory_order_acq_rel))
+        {
+            return;
+        }
+    }
+    wake_.notify_all();
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+bool PipelineLatencyReporter::isRunning() const noexcept
+{
+    return running_.load(std::memory_order_acquire);
+}
+
+uint64_t PipelineLatencyReporter::getReports() const noexcept
+{
+    return reports_.load(std::memory_order_relaxed);
+}
+
+void PipelineLatencyReporter::run()
+{
+    auto next = std::chrono::steady_clock::now() + period_;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (wake_.wait_until(lock, next, [this] { return !running_.load(std::memory_order_acquire); }))
+            {
+                return;
+            }
+        }
+
+        sink_(PipelineLatency::snapshot());
+        reports_.fetch_add(1, std::memory_order_relaxed);
+        next += period_;
+    }
+}
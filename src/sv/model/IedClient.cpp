@@ -19,12 +19,22 @@ IedClient::Ptr IedClient::create(IedModel::Ptr model, const std::string& interfa
             return nullptr;
         }
     }
-    return std::shared_ptr<IedClient>(new IedClient(std::move(model), iface));
+    return create(std::move(model), EthernetTransportFactory::create(iface));
 }
 
-IedClient::IedClient(IedModel::Ptr model, std::string interface)
+IedClient::Ptr IedClient::create(IedModel::Ptr model, TransportFactory::Ptr transport)
+{
+    if (!transport)
+    {
+        LOG_ERROR("Transport is null");
+        return nullptr;
+    }
+    return std::shared_ptr<IedClient>(new IedClient(std::move(model), std::move(transport)));
+}
+
+IedClient::IedClient(IedModel::Ptr model, TransportFactory::Ptr transport)
     : model_(std::move(model))
-    , interface_(std::move(interface))
+    , transport_(std::move(transport))
 {
 }
 
@@ -47,7 +57,7 @@ void IedClient::start(const ASDUCallback& callback)
 
         if (!receiver_)
         {
-            receiver_ = EthernetNetworkReceiver::create(interface_);
+            receiver_ = transport_->createReceiver();
         }
 
         receiver_->start(callback);
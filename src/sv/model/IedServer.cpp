@@ -23,12 +23,22 @@ IedServer::Ptr IedServer::create(IedModel::Ptr model, const std::string& interfa
             return nullptr;
         }
     }
-    return std::shared_ptr<IedServer>(new IedServer(std::move(model), iface));
+    return create(std::move(model), EthernetTransportFactory::create(iface));
 }
 
-IedServer::IedServer(IedModel::Ptr model, std::string interface)
+IedServer::Ptr IedServer::create(IedModel::Ptr model, TransportFactory::Ptr transport)
+{
+    if (!transport)
+    {
+        LOG_ERROR("Transport is null");
+        return nullptr;
+    }
+    return std::shared_ptr<IedServer>(new IedServer(std::move(model), std::move(transport)));
+}
+
+IedServer::IedServer(IedModel::Ptr model, TransportFactory::Ptr transport)
     : model_(std::move(model))
-    , interface_(std::move(interface))
+    , transport_(std::move(transport))
     , running_(false)
 {
 }
@@ -45,7 +55,7 @@ void IedServer::start()
         }
         if (!sender_)
         {
-            sender_ = EthernetNetworkSender::create(interface_);
+            sender_ = transport_->createSender();
         }
         running_.store(true);
         senderThread_ = std::thread([this]() { run(); });
@@ -0,0 +1,251 @@
+#include "sv/network/FrameCodec.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/core/logging.h"
+#include "sv/core/alloc.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace sv;
+
+void FrameCodec::encode(BufferWriter& writer, const SampledValueControlBlock& svcb, const ASDU& asdu,
+                        const std::array<uint8_t, 6>& destMac, const std::array<uint8_t, 6>& srcMac)
+{
+    const AllocationScopeGuard scope(AllocationScope::ENCODE);
+
+    // Ethernet Layer 2 Header....
+    writer.writeBytes(destMac);
+    writer.writeBytes(srcMac);
+
+    const uint16_t vlanId = svcb.getVlanId();
+    const uint8_t userPriority = svcb.getUserPriority();
+
+    if (vlanId > 0)
+    {
+        writer.writeUint16(VLAN_TAG_TPID);
+        // TCI (Tag Control Information): 3 bits priority + 1 bit CFI + 12 bits VID
+        const uint16_t tci = (static_cast<uint16_t>(userPriority) << 13) | (vlanId & 0x0FFF);
+        writer.writeUint16(tci);
+    }
+
+    // Ethertype for SV protocol
+    writer.writeUint16(SV_ETHER_TYPE);
+
+    // SV Protocol Header....
+
+    // APPID from SVCB
+    writer.writeUint16(svcb.getAppId());
+
+    // Length field - will be updated later
+    const size_t lengthPos = writer.size();
+    writer.writeUint16(0);  // Placeholder
+
+    // Reserved 1 (2 bytes) - includes Simulate bit
+    // Bit 15: Simulate flag
+    const uint16_t reserved1 = svcb.getSimulate() ? 0x8000 : 0x0000;
+    writer.writeUint16(reserved1);
+
+    // Reserved 2 (2 bytes) - Reserved Security
+    writer.writeUint16(0x0000);
+
+    // APDU....
+
+    // Number of ASDUs (typically 1)
+    const uint8_t numASDUs = 1;
+    writer.writeUint8(numASDUs);
+
+    // ASDU....
+
+    // svID (64 bytes fixed length, null-padded)
+    writer.writeFixedString(asdu.svID, 64);
+
+    // smpCnt
+    writer.writeUint16(asdu.smpCnt);
+
+    // confRev from SVCB
+    writer.writeUint32(svcb.getConfRev());
+
+    // smpSynch from SVCB (can be overridden by ASDU if needed)
+    writer.writeUint8(static_cast<uint8_t>(svcb.getSmpSynch()));
+
+    // gmIdentity (optional, 8 bytes) - from SVCB if configured
+    const auto gmIdentity = svcb.getGrandmasterIdentity();
+    if (gmIdentity.has_value())
+    {
+        writer.writeBytes(gmIdentity->data(), gmIdentity->size());
+    }
+
+    for (const auto& analogValue : asdu.dataSet)
+    {
+        // write value based on configured data type...
+        if (std::holds_alternative<int32_t>(analogValue.value))
+        {
+            writer.writeInt32(std::get<int32_t>(analogValue.value));
+        }
+        else if (std::holds_alternative<uint32_t>(analogValue.value))
+        {
+            writer.writeUint32(std::get<uint32_t>(analogValue.value));
+        }
+        else if (std::holds_alternative<float>(analogValue.value))
+        {
+            writer.writeFloat(std::get<float>(analogValue.value));
+        }
+        else
+        {
+            throw std::runtime_error("Unsupported value type in ASDU dataset");
+        }
+
+        writer.writeUint32(analogValue.quality.toRaw());
+    }
+
+    const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(asdu.timestamp.time_since_epoch()).count();
+    writer.writeUint64(static_cast<uint64_t>(ts));
+
+    const uint16_t length = static_cast<uint16_t>(writer.size() - lengthPos - 2);
+    writer.writeUint16At(lengthPos, length);
+}
+
+std::optional<ASDU> FrameCodec::decode(const std::span<const uint8_t> frame, SVMessage* header)
+{
+    ASDU asdu{};
+    if (!decode(frame, asdu, header))
+    {
+        return std::nullopt;
+    }
+    return asdu;
+}
+
+bool FrameCodec::decode(const std::span<const uint8_t> frame, ASDU& asdu, SVMessage* header)
+{
+    const AllocationScopeGuard scope(AllocationScope::PARSE);
+
+    if (frame.size() < MIN_FRAME_SIZE)
+    {
+        LOG_ERROR("Frame too short for SV: " + std::to_string(frame.size()) + " bytes");
+        return false;
+    }
+
+    try
+    {
+        BufferReader reader(frame);
+
+        std::array<uint8_t, 6> destMac{};
+        std::array<uint8_t, 6> srcMac{};
+        reader.readBytes(destMac.data(), destMac.size());
+        reader.readBytes(srcMac.data(), srcMac.size());
+
+        // Check for VLAN tag...
+        uint16_t etherType = reader.readUint16();
+        uint16_t vlanId = 0;
+        uint8_t priority = 0;
+
+        if (etherType == VLAN_TAG_TPID)
+        {
+            // Parses VLAN TCI...
+            const uint16_t tci = reader.readUint16();
+            priority = (tci >> 13) & 0x07;
+            vlanId = tci & 0x0FFF;
+            etherType = reader.readUint16();
+        }
+
+        if (etherType != SV_ETHER_TYPE)
+        {
+            return false;
+        }
+
+        // Parse SV header
+        const uint16_t appId = reader.readUint16();
+        const uint16_t svLength = reader.readUint16();
+
+        // Reserved 1 - contains simulate bit
+        const uint16_t reserved1 = reader.readUint16();
+        const bool simulate = (reserved1 & 0x8000) != 0;
+
+        // Reserved 2
+        reader.skip(2);
+
+        const uint8_t numASDUs = reader.readUint8();
+        if (numASDUs == 0 || numASDUs > MAX_ASDUS_PER_MESSAGE)
+        {
+            LOG_ERROR("Invalid number of ASDUs: " + std::to_string(numASDUs));
+            return false;
+        }
+
+        // Parse svID (64 bytes, null-padded), reusing the capacity of the caller's string
+        auto svId = reader.readFixedStringView(64);
+
+        // Trim trailing spaces
+        while (!svId.empty() && svId.back() == ' ')
+        {
+            svId.remove_suffix(1);
+        }
+        asdu.svID.assign(svId);
+
+        asdu.smpCnt = reader.readUint16();
+        asdu.confRev = reader.readUint32();
+
+        // Parse smpSynch
+        const uint8_t synchValue = reader.readUint8();
+        switch (synchValue)
+        {
+            case 0: asdu.smpSynch = SmpSynch::None; break;
+            case 1: asdu.smpSynch = SmpSynch::Local; break;
+            case 2: asdu.smpSynch = SmpSynch::Global; break;
+            default:
+                LOG_ERROR("Invalid SmpSynch value: " + std::to_string(synchValue));
+                asdu.smpSynch = SmpSynch::None;
+                break;
+        }
+
+        // Parse dataset (8 values: I0-I3, V0-V3)
+        asdu.dataSet.resize(VALUES_PER_ASDU);
+        size_t values = 0;
+        for (; values < VALUES_PER_ASDU && reader.remaining() >= 8; ++values)
+        {
+            asdu.dataSet[values].value = reader.readInt32();
+            asdu.dataSet[values].quality = Quality(reader.readUint32());
+        }
+
+        if (values != VALUES_PER_ASDU)
+        {
+            LOG_ERROR("Invalid number of values: " + std::to_string(values));
+            return false;
+        }
+        asdu.gmIdentity.reset();
+
+        if (reader.remaining() >= 8)
+        {
+            const uint64_t ts = reader.readUint64();
+            asdu.timestamp = Timestamp(std::chrono::nanoseconds(ts));
+        }
+        else
+        {
+            asdu.timestamp = std::chrono::system_clock::now();
+            LOG_ERROR("Timestamp missing, using current time");
+        }
+
+        if (!asdu.isValid())
+        {
+            LOG_ERROR("Parsed ASDU invalid: svID='" + asdu.svID + "' (len=" + std::to_string(asdu.svID.length()) + ")");
+            return false;
+        }
+
+        if (header)
+        {
+            header->destMac = destMac;
+            header->srcMac = srcMac;
+            header->userPriority = priority;
+            header->vlanID = vlanId;
+            header->appID = appId;
+            header->length = svLength;
+            header->simulate = simulate;
+        }
+
+        return true;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Exception parsing ASDU: " + std::string(e.what()));
+        return false;
+    }
+}
@@ -1,12 +1,12 @@
 #include "sv/network/NetworkReceiver.h"
+#include "sv/network/FrameCodec.h"
 #include "sv/core/logging.h"
-#include "sv/core/buffer.h"
+#include "sv/core/alloc.h"
+#include "sv/core/pipeline.h"
 
 #include <array>
 #include <vector>
-#include <sstream>
 #include <cstring>
-#include <iomanip>
 #include <algorithm>
 #include <arpa/inet.h>
 #include <cerrno>
@@ -16,6 +16,7 @@
 #include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <ifaddrs.h>
+#include <ctime>
 
 using namespace sv;
 
@@ -75,6 +76,41 @@ std::string sv::getFirstEthernetInterface()
     return "";
 }
 
+uint64_t sv::realtimeNs()
+{
+    timespec now{};
+    clock_gettime(CLOCK_REALTIME, &now);
+    return static_cast<uint64_t>(now.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(now.tv_nsec);
+}
+
+std::optional<uint64_t> sv::kernelReceiveNs(const msghdr& msg)
+{
+    for (const cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(const_cast<msghdr*>(&msg), const_cast<cmsghdr*>(cmsg)))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+        {
+            timespec ts{};
+            std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+            return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+        }
+    }
+    return std::nullopt;
+}
+
+int64_t sv::receiveOrigin(const std::optional<uint64_t> kernelNs)
+{
+    const int64_t now = PipelineLatency::nowNs();
+    if (!kernelNs.has_value())
+    {
+        return now;
+    }
+
+    const uint64_t realNow = realtimeNs();
+    const uint64_t queued = realNow > *kernelNs ? realNow - *kernelNs : 0;
+    PipelineLatency::record(PipelineStage::KERNEL_RX, queued);
+    return now - static_cast<int64_t>(queued);
+}
+
 std::unique_ptr<EthernetNetworkReceiver> EthernetNetworkReceiver::create(const std::string& interface)
 {
     return std::unique_ptr<EthernetNetworkReceiver>(new EthernetNetworkReceiver(interface));
@@ -108,6 +144,18 @@ EthernetNetworkReceiver::EthernetNetworkReceiver(std::string interface)
         {
             throw std::runtime_error("Failed to bind socket to interface " + interface_ + ": " + std::string(strerror(errno)));
         }
+
+        // Kernel receive timestamps feed PipelineStage::KERNEL_RX and the capture file
+        constexpr int enable = 1;
+        if (setsockopt(socket_.get(), SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0)
+        {
+            LOG_ERROR("Failed to enable kernel timestamps on " + interface_ + ": " + std::string(strerror(errno)));
+        }
+
+        // Bounded receive timeout so stop() is honoured on a quiet interface
+        timeval timeout{};
+        timeout.tv_usec = 100000;
+        setsockopt(socket_.get(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
     }
     catch (...)
     {
@@ -158,174 +206,9 @@ void EthernetNetworkReceiver::enablePromiscuousMode() const
     }
 }
 
-std::string EthernetNetworkReceiver::formatMacAddress(const std::array<uint8_t, 6> &mac)
+std::optional<ASDU> EthernetNetworkReceiver::parseASDU(const std::span<const uint8_t> frame)
 {
-    std::ostringstream oss;
-    oss << std::hex << std::setfill('0');
-    for (size_t i = 0; i < mac.size(); ++i)
-    {
-        if (i > 0) oss << ":";
-        oss << std::setw(2) << static_cast<int>(mac[i]);
-    }
-    return oss.str();
-}
-
-std::optional<ASDU> EthernetNetworkReceiver::parseASDU(const std::vector<uint8_t> &buffer, const size_t length)
-{
-    constexpr size_t MIN_SV_FRAME_SIZE = 14 + 8;
-
-    if (length < MIN_SV_FRAME_SIZE)
-    {
-        LOG_ERROR("Frame too short for SV: " + std::to_string(length) + " bytes");
-        return std::nullopt;
-    }
-
-    try
-    {
-        BufferReader reader(buffer);
-        reader.skip(12);  // Skip dest and src MAC
-
-        // Check for VLAN tag...
-        uint16_t etherType = reader.readUint16();
-        uint16_t vlanId = 0;
-        uint8_t priority = 0;
-
-        if (etherType == sv::VLAN_TAG_TPID)
-        {
-            // Parses VLAN TCI...
-            const uint16_t tci = reader.readUint16();
-            priority = (tci >> 13) & 0x07;
-            vlanId = tci & 0x0FFF;
-            etherType = reader.readUint16();
-            LOG_INFO("VLAN tag detected: ID=" + std::to_string(vlanId) + ", Priority=" + std::to_string(priority));
-        }
-
-        if (etherType != sv::SV_ETHER_TYPE)
-        {
-            return std::nullopt;
-        }
-
-        // Parse SV header
-        const uint16_t appId = reader.readUint16();
-        [[maybe_unused]] const uint16_t svLength = reader.readUint16();
-
-        // Reserved 1 - contains simulate bit
-        const uint16_t reserved1 = reader.readUint16();
-        const bool simulate = (reserved1 & 0x8000) != 0;
-
-        // Reserved 2
-        reader.skip(2);
-
-        const uint8_t numASDUs = reader.readUint8();
-        if (numASDUs == 0 || numASDUs > MAX_ASDUS_PER_MESSAGE)
-        {
-            LOG_ERROR("Invalid number of ASDUs: " + std::to_string(numASDUs));
-            return std::nullopt;
-        }
-
-        ASDU asdu;
-
-        // Parse svID (64 bytes, null-padded)
-        asdu.svID = reader.readFixedString(64);
-
-        // Trim null bytes and spaces
-        const size_t nullPos = asdu.svID.find('\0');
-        if (nullPos != std::string::npos)
-        {
-            asdu.svID.erase(nullPos);
-        }
-        while (!asdu.svID.empty() && asdu.svID.back() == ' ')
-        {
-            asdu.svID.pop_back();
-        }
-
-        asdu.smpCnt = reader.readUint16();
-        asdu.confRev = reader.readUint32();
-
-        // Parse smpSynch
-        const uint8_t synchValue = reader.readUint8();
-        switch (synchValue)
-        {
-            case 0: asdu.smpSynch = SmpSynch::None; break;
-            case 1: asdu.smpSynch = SmpSynch::Local; break;
-            case 2: asdu.smpSynch = SmpSynch::Global; break;
-            default:
-                LOG_ERROR("Invalid SmpSynch value: " + std::to_string(synchValue));
-                asdu.smpSynch = SmpSynch::None;
-                break;
-        }
-
-        // Parse dataset (8 values: I0-I3, V0-V3)
-        constexpr size_t EXPECTED_VALUES = VALUES_PER_ASDU;
-        for (size_t i = 0; i < EXPECTED_VALUES && reader.remaining() >= 8; ++i)
-        {
-            const size_t currentPos = reader.position();
-            AnalogValue analogValue;
-            const int32_t value = reader.readInt32();
-            analogValue.value = value;
-            const uint32_t qualityRaw = reader.readUint32();
-            analogValue.quality = Quality(qualityRaw);
-            asdu.dataSet.push_back(analogValue);
-
-            if (i == 0)
-            {
-                LOG_INFO("ASDU[0] at offset " + std::to_string(currentPos) +
-                         ": value=" + std::to_string(value) +
-                         " (0x" + [](int32_t v) {
-                             std::ostringstream oss;
-                             oss << std::hex << std::setw(8) << std::setfill('0') << static_cast<uint32_t>(v);
-                             return oss.str();
-                         }(value) + "), quality=0x" + [](uint32_t q) {
-                             std::ostringstream oss;
-                             oss << std::hex << std::setw(8) << std::setfill('0') << q;
-                             return oss.str();
-                         }(qualityRaw));
-            }
-        }
-
-        if (asdu.dataSet.size() != EXPECTED_VALUES)
-        {
-            LOG_ERROR("Invalid number of values: " + std::to_string(asdu.dataSet.size()));
-            return std::nullopt;
-        }
-
-        if (reader.remaining() >= 8)
-        {
-            const uint64_t ts = reader.readUint64();
-            asdu.timestamp = Timestamp(std::chrono::nanoseconds(ts));
-        }
-        else
-        {
-            asdu.timestamp = std::chrono::system_clock::now();
-            LOG_ERROR("Timestamp missing, using current time");
-        }
-
-        if (!asdu.isValid())
-        {
-            LOG_ERROR("Parsed ASDU invalid: svID='" + asdu.svID + "' (len=" + std::to_string(asdu.svID.length()) + ")");
-            return std::nullopt;
-        }
-
-        LOG_INFO("Parsed SV: svID=" + asdu.svID +
-                 ", smpCnt=" + std::to_string(asdu.smpCnt) +
-                 ", confRev=" + std::to_string(asdu.confRev) +
-                 ", synch=" + smpSynchToString(asdu.smpSynch) +
-                 ", appID=0x" + [](uint16_t id) {
-                     std::ostringstream oss;
-                     oss << std::hex << id;
-                     return oss.str();
-                 }(appId) +
-                 (vlanId > 0 ? ", VLAN=" + std::to_string(vlanId) : "") +
-                 ", simulate=" + (simulate ? "true" : "false") +
-                 ", values=" + std::to_string(asdu.dataSet.size()));
-
-        return asdu;
-    }
-    catch (const std::exception& e)
-    {
-        LOG_ERROR("Exception parsing ASDU: " + std::string(e.what()));
-        return std::nullopt;
-    }
+    return FrameCodec::decode(frame);
 }
 
 void EthernetNetworkReceiver::start(Callback callback)
@@ -344,12 +227,25 @@ void EthernetNetworkReceiver::start(Callback callback)
 
         receiveThread_ = std::thread([this, callback = std::move(callback)]()
         {
-            constexpr size_t BUFFER_SIZE = 1500;
+            const AllocationScopeGuard scope(AllocationScope::DISPATCH);
+
+            // Everything the loop touches per frame is set up here and reused, including the
+            // decoded ASDU; the loop itself does not allocate
+            constexpr size_t BUFFER_SIZE = 1518;
             std::vector<uint8_t> buffer(BUFFER_SIZE);
+            ASDU asdu{};
+            std::array<uint8_t, CMSG_SPACE(sizeof(timespec))> control{};
 
             while (running_.load())
             {
-                const ssize_t len = recv(socket_.get(), buffer.data(), buffer.size(), 0);
+                iovec iov{buffer.data(), buffer.size()};
+                msghdr msg{};
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                msg.msg_control = control.data();
+                msg.msg_controllen = control.size();
+
+                const ssize_t len = recvmsg(socket_.get(), &msg, 0);
 
                 if (len < 0)
                 {
@@ -361,42 +257,25 @@ void EthernetNetworkReceiver::start(Callback callback)
                 }
 
                 const auto lenSize = static_cast<size_t>(len);
+                const auto kernelNs = kernelReceiveNs(msg);
+                const PipelineFrame frame(receiveOrigin(kernelNs));
 
-                if (lenSize < 14)
+                if (capture_)
                 {
-                    LOG_ERROR("Frame too short: " + std::to_string(lenSize) + " bytes");
-                    continue;
+                    capture_->capture(std::span<const uint8_t>(buffer.data(), lenSize), kernelNs.value_or(realtimeNs()));
                 }
 
-                // Extract and log destination MAC
-                std::array<uint8_t, 6> destMac{};
-                std::copy_n(buffer.begin(), 6, destMac.begin());
-
-                const uint16_t etherType = (static_cast<uint16_t>(buffer[12]) << 8) | buffer[13];
-
-                LOG_INFO("RX frame: dstMAC=" + formatMacAddress(destMac) + " etherType=0x" + [](const uint16_t et)
-                {
-                    std::ostringstream oss;
-                    oss << std::hex << std::setw(4) << std::setfill('0') << et;
-                    return oss.str();
-                }(etherType) + " len=" + std::to_string(lenSize));
-
-                if (lenSize >= 106)
+                if (lenSize < 14)
                 {
-                    std::ostringstream hexDump;
-                    hexDump << "Buffer[90-105]: ";
-                    for (size_t i = 90; i < 106 && i < lenSize; ++i)
-                    {
-                        hexDump << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(buffer[i]) << " ";
-                    }
-                    LOG_INFO(hexDump.str());
+                    LOG_ERROR("Frame too short: " + std::to_string(lenSize) + " bytes");
+                    continue;
                 }
 
-                // Parse ASDU
-                auto asduOpt = parseASDU(buffer, lenSize);
-                if (asduOpt.has_value())
+                if (FrameCodec::decode(std::span<const uint8_t>(buffer.data(), lenSize), asdu))
                 {
-                    callback(asduOpt.value());
+                    PipelineLatency::mark(PipelineStage::PARSED);
+                    PipelineLatency::mark(PipelineStage::CALLBACK);
+                    callback(asdu);
                 }
             }
         });
@@ -420,4 +299,33 @@ void EthernetNetworkReceiver::stop()
     {
         receiveThread_.join();
     }
+    if (capture_)
+    {
+        capture_->flush();
+        const auto stats = capture_->getStats();
+        LOG_INFO("Capture " + capture_->getPath() + ": captured=" + std::to_string(stats.capturedFrames) +
+                 ", dropped=" + std::to_string(stats.droppedFrames) +
+                 ", written=" + std::to_string(stats.bytesWritten) + " bytes");
+    }
+}
+
+void EthernetNetworkReceiver::enableCapture(const std::string& path)
+{
+    if (running_.load())
+    {
+        LOG_ERROR("Cannot enable capture while receiver is running");
+        return;
+    }
+
+    capture_ = PcapngWriter::create(path);
+    LOG_INFO("Capturing received frames on " + interface_ + " to " + path);
+}
+
+std::optional<CaptureStats> EthernetNetworkReceiver::getCaptureStats() const
+{
+    if (!capture_)
+    {
+        return std::nullopt;
+    }
+    return capture_->getStats();
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "sv/network/NetworkSender.h"
+#include "sv/network/FrameCodec.h"
 #include "sv/core/logging.h"
 #include "sv/core/buffer.h"
+#include "sv/core/alloc.h"
+#include "sv/core/mac.h"
 
 #include <cstring>
 #include <array>
-#include <sstream>
 #include <algorithm>
 #include <arpa/inet.h>
 #include <cerrno>
@@ -57,38 +59,12 @@ EthernetNetworkSender::EthernetNetworkSender(std::string interface)
 
 std::array<uint8_t, 6> EthernetNetworkSender::parseMacAddress(const std::string& macStr)
 {
-    std::array<uint8_t, 6> mac{};
-    std::istringstream iss(macStr);
-    std::string segment;
-    size_t index = 0;
-
-    while (std::getline(iss, segment, ':') && index < 6)
-    {
-        try
-        {
-            const unsigned long value = std::stoul(segment, nullptr, 16);
-            if (value > 0xFF)
-            {
-                throw std::invalid_argument("Invalid MAC address segment: " + segment);
-            }
-            mac[index++] = static_cast<uint8_t>(value);
-        }
-        catch (const std::invalid_argument&)
-        {
-            throw std::invalid_argument("Invalid MAC address format: " + macStr);
-        }
-        catch (const std::out_of_range&)
-        {
-            throw std::invalid_argument("MAC address segment out of range: " + segment);
-        }
-    }
-
-    if (index != 6)
+    const auto mac = MacAddress::tryParse(macStr);
+    if (!mac.has_value())
     {
-        throw std::invalid_argument("Incomplete MAC address: " + macStr);
+        throw std::invalid_argument("Invalid MAC address format: " + macStr);
     }
-
-    return mac;
+    return mac->bytes();
 }
 
 std::array<uint8_t, 6> EthernetNetworkSender::getSourceMacAddress() const
@@ -147,10 +123,6 @@ void EthernetNetworkSender::sendFrame(const uint8_t* data, const size_t size, co
     {
         LOG_ERROR("Partial send: sent " + std::to_string(sent) + " of " + std::to_string(size) + " bytes");
     }
-    else
-    {
-        LOG_INFO("Sent frame of " + std::to_string(sent) + " bytes");
-    }
 }
 
 void EthernetNetworkSender::sendASDU(const std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu)
@@ -161,123 +133,86 @@ void EthernetNetworkSender::sendASDU(const std::shared_ptr<SampledValueControlBl
         ASSERT(!asdu.svID.empty(), "ASDU svID is empty");
         ASSERT(asdu.dataSet.size() == VALUES_PER_ASDU, "ASDU must contain exactly 8 values");
 
-        BufferWriter writer(1500);
+        const AllocationScopeGuard scope(AllocationScope::ENCODE);
 
-        // Ethernet Layer 2 Header....
+        // One frame buffer per sending thread; steady-state publishing must not allocate
+        thread_local BufferWriter writer(FrameCodec::MAX_FRAME_SIZE);
+        writer.clear();
 
         const auto destMac = parseMacAddress(svcb->getMulticastAddress());
-        writer.writeBytes(destMac.data(), destMac.size());
-
-        const auto srcMac = getSourceMacAddress();
-        writer.writeBytes(srcMac.data(), srcMac.size());
+        FrameCodec::encode(writer, *svcb, asdu, destMac, getSourceMacAddress());
 
-        const uint16_t vlanId = svcb->getVlanId();
-        const uint8_t userPriority = svcb->getUserPriority();
-
-        if (vlanId > 0)
-        {
-            writer.writeUint16(VLAN_TAG_TPID);
-            // TCI (Tag Control Information): 3 bits priority + 1 bit CFI + 12 bits VID
-            const uint16_t tci = (static_cast<uint16_t>(userPriority) << 13) | (vlanId & 0x0FFF);
-            writer.writeUint16(tci);
-        }
-
-        // Ethertype for SV protocol
-        writer.writeUint16(SV_ETHER_TYPE);
-
-        // SV Protocol Header....
-
-        // APPID from SVCB
-        writer.writeUint16(svcb->getAppId());
-
-        // Length field - will be updated later
-        const size_t lengthPos = writer.size();
-        writer.writeUint16(0);  // Placeholder
-
-        // Reserved 1 (2 bytes) - includes Simulate bit
-        // Bit 15: Simulate flag
-        const bool simulate = svcb->getSimulate();
-        const uint16_t reserved1 = simulate ? 0x8000 : 0x0000;
-        writer.writeUint16(reserved1);
+        sendFrame(writer.data(), writer.size(), destMac);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_ERROR("Exception in sendASDU: " + std::string(e.what()));
+        throw;
+    }
+}
 
-        // Reserved 2 (2 bytes) - Reserved Security
-        writer.writeUint16(0x0000);
+bool EthernetNetworkSender::sendRawFrame(const std::span<const uint8_t> frame)
+{
+    if (frame.size() < ETH_HLEN)
+    {
+        return false;
+    }
 
-        // APDU....
+    struct sockaddr_ll addr{};
+    addr.sll_family = AF_PACKET;
+    addr.sll_ifindex = ifIndex_;
+    addr.sll_halen = ETH_ALEN;
+    std::copy_n(frame.begin(), ETH_ALEN, addr.sll_addr);
 
-        // Number of ASDUs (typically 1)
-        const uint8_t numASDUs = 1;
-        writer.writeUint8(numASDUs);
+    // No per-frame logging: replay pushes frames at line rate
+    const ssize_t sent = sendto(socket_.get(), frame.data(), frame.size(), 0, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+    return sent == static_cast<ssize_t>(frame.size());
+}
 
-        // ASDU....
+size_t EthernetNetworkSender::sendRawFrames(const std::span<const std::span<const uint8_t>> frames)
+{
+    std::array<struct sockaddr_ll, MAX_BATCH> addresses{};
+    std::array<struct iovec, MAX_BATCH> vectors{};
+    std::array<struct mmsghdr, MAX_BATCH> messages{};
 
-        // svID (64 bytes fixed length, null-padded)
-        writer.writeFixedString(asdu.svID, 64);
+    size_t sent = 0;
+    while (sent < frames.size())
+    {
+        const size_t count = std::min(MAX_BATCH, frames.size() - sent);
+        for (size_t n = 0; n < count; ++n)
+        {
+            const auto frame = frames[sent + n];
+            if (frame.size() < ETH_HLEN)
+            {
+                return sent;
+            }
 
-        // smpCnt
-        writer.writeUint16(asdu.smpCnt);
+            addresses[n] = {};
+            addresses[n].sll_family = AF_PACKET;
+            addresses[n].sll_ifindex = ifIndex_;
+            addresses[n].sll_halen = ETH_ALEN;
+            std::copy_n(frame.begin(), ETH_ALEN, addresses[n].sll_addr);
 
-        // confRev from SVCB
-        writer.writeUint32(svcb->getConfRev());
+            vectors[n].iov_base = const_cast<uint8_t*>(frame.data());
+            vectors[n].iov_len = frame.size();
 
-        // smpSynch from SVCB (can be overridden by ASDU if needed)
-        const SmpSynch synch = svcb->getSmpSynch();
-        writer.writeUint8(static_cast<uint8_t>(synch));
+            messages[n] = {};
+            messages[n].msg_hdr.msg_name = &addresses[n];
+            messages[n].msg_hdr.msg_namelen = sizeof(struct sockaddr_ll);
+            messages[n].msg_hdr.msg_iov = &vectors[n];
+            messages[n].msg_hdr.msg_iovlen = 1;
+        }
 
-        // gmIdentity (optional, 8 bytes) - from SVCB if configured
-        const auto gmIdentity = svcb->getGrandmasterIdentity();
-        if (gmIdentity.has_value())
+        const int result = sendmmsg(socket_.get(), messages.data(), static_cast<unsigned int>(count), 0);
+        if (result <= 0)
         {
-            writer.writeBytes(gmIdentity->data(), gmIdentity->size());
+            return sent;
         }
-
-        ASSERT(asdu.dataSet.size() == VALUES_PER_ASDU, "Invalid dataset size");
-
-        for (const auto& analogValue : asdu.dataSet)
+        sent += static_cast<size_t>(result);
+        if (static_cast<size_t>(result) < count)
         {
-            // write value based on configured data type...
-            if (std::holds_alternative<int32_t>(analogValue.value))
-            {
-                const int32_t val = std::get<int32_t>(analogValue.value);
-                writer.writeInt32(val);
-            }
-            else if (std::holds_alternative<uint32_t>(analogValue.value))
-            {
-                const uint32_t val = std::get<uint32_t>(analogValue.value);
-                writer.writeUint32(val);
-            }
-            else if (std::holds_alternative<float>(analogValue.value))
-            {
-                const float val = std::get<float>(analogValue.value);
-                writer.writeFloat(val);
-            }
-            else
-            {
-                throw std::runtime_error("Unsupported value type in ASDU dataset");
-            }
-
-            const uint32_t qualityRaw = analogValue.quality.toRaw();
-            writer.writeUint32(qualityRaw);
+            return sent;
         }
-
-        const auto ts = std::chrono::duration_cast<std::chrono::nanoseconds>(asdu.timestamp.time_since_epoch()).count();
-        writer.writeUint64(static_cast<uint64_t>(ts));
-
-        const uint16_t length = static_cast<uint16_t>(writer.size() - lengthPos - 2);
-        writer.writeUint16At(lengthPos, length);
-
-        sendFrame(writer.data(), writer.size(), destMac);
-
-        LOG_INFO("Sent SV frame: svID=" + asdu.svID +
-                 ", smpCnt=" + std::to_string(asdu.smpCnt) +
-                 ", confRev=" + std::to_string(svcb->getConfRev()) +
-                 ", synch=" + smpSynchToString(synch) +
-                 ", simulate=" + (simulate ? "true" : "false") +
-                 ", size=" + std::to_string(writer.size()) + " bytes");
-    }
-    catch (const std::exception& e)
-    {
-        LOG_ERROR("Exception in sendASDU: " + std::string(e.what()));
-        throw;
     }
-}
\ No newline at end of file
+    return sent;
+}
@@ -0,0 +1,81 @@
+#include "sv/network/Transport.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/network/UnixSocketTransport.h"
+#include "sv/core/logging.h"
+
+#include <utility>
+
+using namespace sv;
+
+std::shared_ptr<EthernetTransportFactory> EthernetTransportFactory::create(const std::string& interface)
+{
+    return std::shared_ptr<EthernetTransportFactory>(new EthernetTransportFactory(interface));
+}
+
+EthernetTransportFactory::EthernetTransportFactory(std::string interface)
+    : interface_(std::move(interface))
+{
+}
+
+std::unique_ptr<NetworkSender> EthernetTransportFactory::createSender()
+{
+    return EthernetNetworkSender::create(interface_);
+}
+
+std::unique_ptr<NetworkReceiver> EthernetTransportFactory::createReceiver()
+{
+    auto receiver = EthernetNetworkReceiver::create(interface_);
+    if (!captureFile_.empty())
+    {
+        receiver->enableCapture(captureFile_);
+    }
+    return receiver;
+}
+
+std::string EthernetTransportFactory::describe() const
+{
+    return "ethernet:" + interface_;
+}
+
+void EthernetTransportFactory::setCaptureFile(const std::string& path)
+{
+    captureFile_ = path;
+}
+
+TransportFactory::Ptr sv::createTransport(const std::string& spec)
+{
+    const auto hasPrefix = [&spec](const std::string& prefix) { return spec.rfind(prefix, 0) == 0; };
+
+    if (spec == "loopback")
+    {
+        return LoopbackTransport::create();
+    }
+
+    if (spec == "unix")
+    {
+        return UnixSocketTransportFactory::create();
+    }
+
+    if (hasPrefix("unix:"))
+    {
+        const std::string path = spec.substr(5);
+        if (path.empty())
+        {
+            LOG_ERROR("Empty Unix socket path in transport spec: " + spec);
+            return nullptr;
+        }
+        return UnixSocketTransportFactory::create(path);
+    }
+
+    std::string iface = hasPrefix("eth:") ? spec.substr(4) : spec;
+    if (iface.empty())
+    {
+        iface = getFirstEthernetInterface();
+        if (iface.empty())
+        {
+            LOG_ERROR("No suitable Ethernet interface found");
+            return nullptr;
+        }
+    }
+    return EthernetTransportFactory::create(iface);
+}
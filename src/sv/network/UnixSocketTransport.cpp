@@ -0,0 +1,304 @@
+#include "sv/network/UnixSocketTransport.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/core/logging.h"
+#include "sv/core/alloc.h"
+#include "sv/core/pipeline.h"
+
+#include <array>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+using namespace sv;
+
+namespace
+{
+    /**
+     * @brief Builds a Unix socket address for a path.
+     * @param path The socket path.
+     * @return The socket address.
+     * @throws std::invalid_argument if the path does not fit into sun_path.
+     */
+    sockaddr_un makeAddress(const std::string& path)
+    {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(addr.sun_path))
+        {
+            throw std::invalid_argument("Invalid Unix socket path: '" + path + "'");
+        }
+        std::copy(path.begin(), path.end(), addr.sun_path);
+        return addr;
+    }
+}
+
+std::unique_ptr<UnixSocketNetworkSender> UnixSocketNetworkSender::create(const std::string& path)
+{
+    return std::unique_ptr<UnixSocketNetworkSender>(new UnixSocketNetworkSender(path));
+}
+
+UnixSocketNetworkSender::UnixSocketNetworkSender(std::string path)
+    : path_(std::move(path))
+    , listenSocket_(socket(AF_UNIX, SOCK_SEQPACKET | SOCK_NONBLOCK | SOCK_CLOEXEC, 0))
+{
+    if (listenSocket_.get() < 0)
+    {
+        throw std::runtime_error("Failed to create Unix socket: " + std::string(strerror(errno)));
+    }
+
+    const sockaddr_un addr = makeAddress(path_);
+    unlink(path_.c_str());
+
+    if (bind(listenSocket_.get(), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        throw std::runtime_error("Failed to bind Unix socket " + path_ + ": " + std::string(strerror(errno)));
+    }
+
+    if (listen(listenSocket_.get(), SOMAXCONN) < 0)
+    {
+        throw std::runtime_error("Failed to listen on Unix socket " + path_ + ": " + std::string(strerror(errno)));
+    }
+}
+
+UnixSocketNetworkSender::~UnixSocketNetworkSender()
+{
+    unlink(path_.c_str());
+}
+
+void UnixSocketNetworkSender::acceptPending()
+{
+    for (;;)
+    {
+        const int fd = accept4(listenSocket_.get(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            {
+                LOG_ERROR("Accept failed on " + path_ + ": " + std::string(strerror(errno)));
+            }
+            return;
+        }
+        subscribers_.emplace_back(fd);
+        LOG_INFO("Subscriber connected on " + path_ + " (" + std::to_string(subscribers_.size()) + " total)");
+    }
+}
+
+void UnixSocketNetworkSender::sendASDU(const std::shared_ptr<SampledValueControlBlock> svcb, const ASDU& asdu)
+{
+    ASSERT(svcb, "SVCB is null");
+    ASSERT(asdu.dataSet.size() == VALUES_PER_ASDU, "ASDU must contain exactly 8 values");
+
+    const auto destMac = MacAddress::tryParse(svcb->getMulticastAddress());
+    if (!destMac.has_value())
+    {
+        throw std::invalid_argument("Invalid multicast address: " + svcb->getMulticastAddress());
+    }
+
+    const AllocationScopeGuard scope(AllocationScope::ENCODE);
+
+    // One frame buffer per sending thread; steady-state publishing must not allocate
+    thread_local BufferWriter writer(FrameCodec::MAX_FRAME_SIZE);
+    writer.clear();
+    FrameCodec::encode(writer, *svcb, asdu, destMac->bytes(), FrameCodec::LOCAL_SRC_MAC);
+    publish(writer.span());
+}
+
+bool UnixSocketNetworkSender::sendRawFrame(const std::span<const uint8_t> frame)
+{
+    return publish(frame) > 0;
+}
+
+size_t UnixSocketNetworkSender::publish(const std::span<const uint8_t> frame)
+{
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    acceptPending();
+
+    size_t delivered = 0;
+    std::erase_if(subscribers_, [this, &frame, &delivered](const SocketGuard& subscriber)
+    {
+        const ssize_t sent = send(subscriber.get(), frame.data(), frame.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (sent >= 0)
+        {
+            ++delivered;
+            return false;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        LOG_INFO("Subscriber disconnected from " + path_ + ": " + std::string(strerror(errno)));
+        return true;
+    });
+    return delivered;
+}
+
+uint64_t UnixSocketNetworkSender::getDroppedFrames() const noexcept
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+size_t UnixSocketNetworkSender::getSubscriberCount() const
+{
+    std::lock_guard<std::mutex> lock(subscribersMutex_);
+    return subscribers_.size();
+}
+
+std::unique_ptr<UnixSocketNetworkReceiver> UnixSocketNetworkReceiver::create(const std::string& path)
+{
+    return std::unique_ptr<UnixSocketNetworkReceiver>(new UnixSocketNetworkReceiver(path));
+}
+
+UnixSocketNetworkReceiver::UnixSocketNetworkReceiver(std::string path)
+    : path_(std::move(path))
+{
+    static_cast<void>(makeAddress(path_));
+}
+
+UnixSocketNetworkReceiver::~UnixSocketNetworkReceiver()
+{
+    stop();
+}
+
+ReceiverSocketGuard UnixSocketNetworkReceiver::tryConnect() const
+{
+    ReceiverSocketGuard sock(socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0));
+    if (sock.get() < 0)
+    {
+        LOG_ERROR("Failed to create Unix socket: " + std::string(strerror(errno)));
+        return sock;
+    }
+
+    const sockaddr_un addr = makeAddress(path_);
+    if (connect(sock.get(), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) < 0)
+    {
+        return ReceiverSocketGuard(-1);
+    }
+
+    // Kernel receive timestamps feed PipelineStage::KERNEL_RX, as on the Ethernet receiver
+    constexpr int enable = 1;
+    if (setsockopt(sock.get(), SOL_SOCKET, SO_TIMESTAMPNS, &enable, sizeof(enable)) < 0)
+    {
+        LOG_ERROR("Failed to enable kernel timestamps on " + path_ + ": " + std::string(strerror(errno)));
+    }
+
+    // Bounded receive timeout so stop() is honoured while the publisher is idle
+    timeval timeout{};
+    timeout.tv_usec = 100000;
+    setsockopt(sock.get(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    return sock;
+}
+
+void UnixSocketNetworkReceiver::start(Callback callback)
+{
+    ASSERT(callback, "Callback is null");
+
+    if (running_.load())
+    {
+        LOG_ERROR("Receiver already running");
+        return;
+    }
+
+    running_.store(true);
+
+    receiveThread_ = std::thread([this, callback = std::move(callback)]()
+    {
+        const AllocationScopeGuard scope(AllocationScope::DISPATCH);
+
+        // Decoded in place: the svID and dataset storage are reused from frame to frame
+        std::array<uint8_t, FrameCodec::MAX_FRAME_SIZE> buffer{};
+        ASDU asdu{};
+        std::array<uint8_t, CMSG_SPACE(sizeof(timespec))> control{};
+
+        while (running_.load())
+        {
+            const ReceiverSocketGuard sock = tryConnect();
+            if (sock.get() < 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+
+            LOG_INFO("Connected to publisher on " + path_);
+
+            while (running_.load())
+            {
+                iovec iov{buffer.data(), buffer.size()};
+                msghdr msg{};
+                msg.msg_iov = &iov;
+                msg.msg_iovlen = 1;
+                msg.msg_control = control.data();
+                msg.msg_controllen = control.size();
+
+                const ssize_t len = recvmsg(sock.get(), &msg, 0);
+
+                if (len < 0)
+                {
+                    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+                    {
+                        continue;
+                    }
+                    LOG_ERROR("Receive error on " + path_ + ": " + std::string(strerror(errno)));
+                    break;
+                }
+
+                if (len == 0)
+                {
+                    LOG_INFO("Publisher on " + path_ + " closed the connection");
+                    break;
+                }
+
+                const PipelineFrame frame(receiveOrigin(kernelReceiveNs(msg)));
+                if (FrameCodec::decode(std::span<const uint8_t>(buffer.data(), static_cast<size_t>(len)), asdu))
+                {
+                    PipelineLatency::mark(PipelineStage::PARSED);
+                    PipelineLatency::mark(PipelineStage::CALLBACK);
+                    callback(asdu);
+                }
+            }
+        }
+    });
+}
+
+void UnixSocketNetworkReceiver::stop()
+{
+    if (!running_)
+    {
+        return;
+    }
+    running_ = false;
+    if (receiveThread_.joinable())
+    {
+        receiveThread_.join();
+    }
+}
+
+TransportFactory::Ptr UnixSocketTransportFactory::create(const std::string& path)
+{
+    return Ptr(new UnixSocketTransportFactory(path));
+}
+
+UnixSocketTransportFactory::UnixSocketTransportFactory(std::string path)
+    : path_(std::move(path))
+{
+}
+
+std::unique_ptr<NetworkSender> UnixSocketTransportFactory::createSender()
+{
+    return UnixSocketNetworkSender::create(path_);
+}
+
+std::unique_ptr<NetworkReceiver> UnixSocketTransportFactory::createReceiver()
+{
+    return UnixSocketNetworkReceiver::create(path_);
+}
+
+std::string UnixSocketTransportFactory::describe() const
+{
+    return "unix:" + path_;
+}
@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+#include "sv/core/alloc.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/network/NetworkReceiver.h"
+#include "sv/network/NetworkSender.h"
+#include "sv/network/UnixSocketTransport.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+    /// @brief Longer than the small string buffer, so reusing the decoded svID is what keeps parsing allocation-free
+    constexpr const char* SV_ID = "MERGING_UNIT_0001/LLN0$MS$SV";
+
+    /// @brief Keeps the compiler from eliding a new/delete pair
+    void escape(const void* pointer)
+    {
+        asm volatile("" : : "g"(pointer) : "memory");
+    }
+
+    sv::SampledValueControlBlock::Ptr makeSvcb()
+    {
+        auto svcb = sv::SampledValueControlBlock::create("SV01");
+        svcb->setAppId(0x4001);
+        svcb->setMulticastAddress("01:0C:CD:04:00:01");
+        svcb->setSmpSynch(sv::SmpSynch::Global);
+        return svcb;
+    }
+
+    sv::ASDU makeAsdu()
+    {
+        sv::ASDU asdu{};
+        asdu.svID = SV_ID;
+        asdu.confRev = 1;
+        asdu.smpSynch = sv::SmpSynch::Global;
+        asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+        asdu.timestamp = std::chrono::system_clock::now();
+        return asdu;
+    }
+
+    /// @brief Gap between two frames, so a burst does not overflow the receive buffer of the socket under test
+    constexpr auto SEND_GAP = std::chrono::microseconds(200);
+
+    /**
+     * @brief Sends paced frames until the receiver has counted a number of them.
+     * @return false if they did not arrive within two seconds.
+     */
+    bool sendUntilReceived(sv::NetworkSender& sender, const sv::SampledValueControlBlock::Ptr& svcb, sv::ASDU& asdu,
+                           const std::atomic<size_t>& received, const size_t expected)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (received.load() < expected)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            sender.sendASDU(svcb, asdu);
+            ++asdu.smpCnt;
+            std::this_thread::sleep_for(SEND_GAP);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Waits until a counter has not moved for 50 ms.
+     * @return The settled value, or std::nullopt if it was still moving after two seconds.
+     */
+    std::optional<size_t> waitUntilSettled(const std::atomic<size_t>& counter)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        size_t last = counter.load();
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            const size_t now = counter.load();
+            if (now == last)
+            {
+                return now;
+            }
+            last = now;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Warms the path up until frames arrive, resets the counters, then sends frames and
+     * expects the publishing and subscribing scopes to have allocated nothing for them.
+     * @param lossy Whether the transport may drop frames; only a raw socket is allowed to, and
+     * then only the frames delivered are checked. Every other transport must deliver each frame.
+     */
+    void expectSteadyStateAllocationFree(sv::NetworkSender& sender, const std::atomic<size_t>& received, const bool lossy)
+    {
+        constexpr size_t WARM_UP = 16;
+        constexpr size_t FRAMES = 500;
+
+        const auto svcb = makeSvcb();
+        auto asdu = makeAsdu();
+        ASSERT_TRUE(sendUntilReceived(sender, svcb, asdu, received, WARM_UP));
+        const auto warmedUp = waitUntilSettled(received);
+        ASSERT_TRUE(warmedUp.has_value()) << "receiver did not settle after the warm-up";
+
+        sv::AllocationTracker::reset();
+        for (size_t n = 0; n < FRAMES; ++n)
+        {
+            sender.sendASDU(svcb, asdu);
+            ++asdu.smpCnt;
+            std::this_thread::sleep_for(SEND_GAP);
+        }
+        const auto settled = waitUntilSettled(received);
+        ASSERT_TRUE(settled.has_value()) << "receiver did not settle after the measured frames";
+        const size_t frames = *settled - *warmedUp;
+        if (lossy)
+        {
+            ASSERT_GT(frames, 0u);
+        }
+        else
+        {
+            ASSERT_EQ(frames, FRAMES);
+        }
+
+        for (const auto scope : {sv::AllocationScope::ENCODE, sv::AllocationScope::PARSE, sv::AllocationScope::DISPATCH})
+        {
+            const auto counts = sv::AllocationTracker::get(scope);
+            EXPECT_EQ(counts.allocations, 0u) << sv::toString(scope) << " over " << frames << " frames";
+            EXPECT_EQ(counts.deallocations, 0u) << sv::toString(scope) << " over " << frames << " frames";
+        }
+    }
+}
+
+TEST(AllocationTrackerTest, AttributesAllocationsToTheInnermostScope)
+{
+    ASSERT_TRUE(sv::AllocationTracker::isInstalled());
+    EXPECT_EQ(sv::AllocationTracker::current(), sv::AllocationScope::NONE);
+
+    sv::AllocationTracker::reset();
+    std::unique_ptr<int> encoded;
+    {
+        const sv::AllocationScopeGuard encode(sv::AllocationScope::ENCODE);
+        encoded = std::make_unique<int>(1);
+        escape(encoded.get());
+        {
+            const sv::AllocationScopeGuard parse(sv::AllocationScope::PARSE);
+            EXPECT_EQ(sv::AllocationTracker::current(), sv::AllocationScope::PARSE);
+            const std::vector<int32_t> values(16);
+            escape(values.data());
+        }
+        EXPECT_EQ(sv::AllocationTracker::current(), sv::AllocationScope::ENCODE);
+    }
+    EXPECT_EQ(sv::AllocationTracker::current(), sv::AllocationScope::NONE);
+    encoded.reset();
+
+    const auto encode = sv::AllocationTracker::get(sv::AllocationScope::ENCODE);
+    EXPECT_EQ(encode.allocations, 1u);
+    EXPECT_EQ(encode.deallocations, 0u);
+    EXPECT_EQ(encode.bytes, sizeof(int));
+
+    const auto parse = sv::AllocationTracker::get(sv::AllocationScope::PARSE);
+    EXPECT_EQ(parse.allocations, 1u);
+    EXPECT_EQ(parse.deallocations, 1u);
+    EXPECT_EQ(parse.bytes, 16 * sizeof(int32_t));
+
+    EXPECT_EQ(sv::AllocationTracker::get(sv::AllocationScope::PROTECT).allocations, 0u);
+    EXPECT_GE(sv::AllocationTracker::get(sv::AllocationScope::NONE).deallocations, 1u);
+    EXPECT_GE(sv::AllocationTracker::total().allocations, 2u);
+
+    // Scopes are per thread
+    std::thread([]
+    {
+        EXPECT_EQ(sv::AllocationTracker::current(), sv::AllocationScope::NONE);
+    }).join();
+
+    EXPECT_STREQ(sv::toString(sv::AllocationScope::DISPATCH), "dispatch");
+}
+
+TEST(AllocationTrackerTest, DecodingIntoAnAsduReusesItsStorage)
+{
+    sv::BufferWriter writer(sv::FrameCodec::MAX_FRAME_SIZE);
+    sv::FrameCodec::encode(writer, *makeSvcb(), makeAsdu(), {0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01},
+                           sv::FrameCodec::LOCAL_SRC_MAC);
+
+    sv::ASDU asdu{};
+    ASSERT_TRUE(sv::FrameCodec::decode(writer.span(), asdu));
+    EXPECT_EQ(asdu.svID, SV_ID);
+
+    sv::AllocationTracker::reset();
+    for (int n = 0; n < 10; ++n)
+    {
+        ASSERT_TRUE(sv::FrameCodec::decode(writer.span(), asdu));
+    }
+    EXPECT_EQ(sv::AllocationTracker::get(sv::AllocationScope::PARSE).allocations, 0u);
+    EXPECT_EQ(asdu.dataSet.size(), sv::VALUES_PER_ASDU);
+    EXPECT_EQ(asdu.svID, SV_ID);
+
+    const auto copy = sv::FrameCodec::decode(writer.span());
+    ASSERT_TRUE(copy.has_value());
+    EXPECT_EQ(copy->svID, asdu.svID);
+    EXPECT_GT(sv::AllocationTracker::get(sv::AllocationScope::PARSE).allocations, 0u);
+}
+
+TEST(AllocationTrackerTest, LoopbackPublishAndSubscribeDoNotAllocate)
+{
+    const auto transport = sv::LoopbackTransport::create();
+    const auto sender = transport->createSender();
+    const auto receiver = transport->createReceiver();
+
+    std::atomic<size_t> received{0};
+    receiver->start([&received](const sv::ASDU&) { received.fetch_add(1); });
+
+    expectSteadyStateAllocationFree(*sender, received, false);
+    receiver->stop();
+}
+
+TEST(AllocationTrackerTest, EthernetPublishAndSubscribeDoNotAllocate)
+{
+    std::unique_ptr<sv::EthernetNetworkSender> sender;
+    std::unique_ptr<sv::EthernetNetworkReceiver> receiver;
+    try
+    {
+        sender = sv::EthernetNetworkSender::create("lo");
+        receiver = sv::EthernetNetworkReceiver::create("lo");
+    }
+    catch (const std::exception& e)
+    {
+        GTEST_SKIP() << "Raw sockets unavailable: " << e.what();
+    }
+
+    // The loopback interface may report each frame both outgoing and incoming, and a raw socket
+    // drops frames once its receive buffer is full; either copy counts
+    std::atomic<size_t> received{0};
+    receiver->start([&received](const sv::ASDU& asdu)
+    {
+        if (asdu.svID == SV_ID)
+        {
+            received.fetch_add(1);
+        }
+    });
+
+    expectSteadyStateAllocationFree(*sender, received, true);
+    receiver->stop();
+}
+
+TEST(AllocationTrackerTest, UnixSocketPublishAndSubscribeDoNotAllocate)
+{
+    const std::string path = "/tmp/iec61850_alloc_" + std::to_string(getpid()) + ".sock";
+    const auto sender = sv::UnixSocketNetworkSender::create(path);
+    const auto receiver = sv::UnixSocketNetworkReceiver::create(path);
+
+    // Frames sent before the receiver has connected are not delivered; the warm-up covers that
+    std::atomic<size_t> received{0};
+    receiver->start([&received](const sv::ASDU&) { received.fetch_add(1); });
+
+    expectSteadyStateAllocationFree(*sender, received, false);
+    receiver->stop();
+}
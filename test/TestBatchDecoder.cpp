@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include "sv/capture/BatchDecoder.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/model/SampledValueControlBlock.h"
+
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    std::vector<uint8_t> encodeFrame(const std::string& svId, const uint16_t smpCnt, const uint16_t vlanId = 0)
+    {
+        auto svcb = sv::SampledValueControlBlock::create(svId);
+        svcb->setAppId(0x4001);
+        svcb->setMulticastAddress("01:0C:CD:04:00:01");
+        svcb->setConfRev(3);
+        svcb->setVlanId(vlanId);
+
+        sv::ASDU asdu;
+        asdu.svID = svId;
+        asdu.smpCnt = smpCnt;
+        asdu.confRev = 3;
+        asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+        for (size_t i = 0; i < asdu.dataSet.size(); ++i)
+        {
+            asdu.dataSet[i].value = static_cast<int32_t>(smpCnt) * 100 - static_cast<int32_t>(i);
+            asdu.dataSet[i].quality = sv::Quality(static_cast<uint32_t>(i));
+        }
+        asdu.timestamp = sv::Timestamp(std::chrono::nanoseconds(1'000'000LL * smpCnt));
+
+        sv::BufferWriter writer;
+        sv::FrameCodec::encode(writer, *svcb, asdu, sv::MacAddress::parse("01:0C:CD:04:00:01").bytes(),
+                               sv::FrameCodec::LOCAL_SRC_MAC);
+        const auto span = writer.span();
+        return {span.begin(), span.end()};
+    }
+
+    std::vector<std::span<const uint8_t>> spansOf(const std::vector<std::vector<uint8_t>>& frames)
+    {
+        return {frames.begin(), frames.end()};
+    }
+}
+
+TEST(BatchDecoderTest, MatchesFrameCodecAcrossChunks)
+{
+    std::vector<std::vector<uint8_t>> frames;
+    for (uint16_t i = 0; i < 1000; ++i)
+    {
+        frames.push_back(encodeFrame(i < 600 ? "MU01" : "MU02", i, i < 600 ? 0 : 7));
+    }
+    const auto spans = spansOf(frames);
+
+    sv::BatchDecoder::Storage storage(frames.size());
+    const auto result = sv::BatchDecoder::decode(spans, storage.columns(), 64);
+
+    EXPECT_EQ(result.decoded, 1000u);
+    EXPECT_EQ(result.rejected, 0u);
+    ASSERT_EQ(result.runs.size(), 2u);
+    EXPECT_EQ(result.runs[0].svID, "MU01");
+    EXPECT_EQ(result.runs[0].firstRow, 0u);
+    EXPECT_EQ(result.runs[0].rowCount, 600u);
+    EXPECT_EQ(result.runs[0].appID, 0x4001);
+    EXPECT_EQ(result.runs[0].confRev, 3u);
+    EXPECT_EQ(result.runs[1].svID, "MU02");
+    EXPECT_EQ(result.runs[1].vlanID, 7);
+    EXPECT_EQ(result.runs[1].rowCount, 400u);
+
+    for (const size_t row : {size_t{0}, size_t{599}, size_t{600}, size_t{999}})
+    {
+        const auto asdu = sv::FrameCodec::decode(spans[row]);
+        ASSERT_TRUE(asdu.has_value());
+        EXPECT_EQ(storage.smpCnt[row], asdu->smpCnt);
+        EXPECT_EQ(storage.timestampNs[row], asdu->timestamp.time_since_epoch().count());
+        for (size_t ch = 0; ch < sv::VALUES_PER_ASDU; ++ch)
+        {
+            EXPECT_EQ(storage.value[ch][row], asdu->dataSet[ch].getScaledInt());
+            EXPECT_EQ(storage.quality[ch][row], asdu->dataSet[ch].quality.toRaw());
+        }
+    }
+}
+
+TEST(BatchDecoderTest, RejectedFramesSplitRunsAndClearRows)
+{
+    std::vector<std::vector<uint8_t>> frames = {
+        encodeFrame("MU01", 1),
+        std::vector<uint8_t>(60, 0xFF),
+        encodeFrame("MU01", 3),
+    };
+    const auto spans = spansOf(frames);
+
+    sv::BatchDecoder::Storage storage(frames.size());
+    storage.value[0][1] = 42;
+    const auto result = sv::BatchDecoder::decode(spans, storage.columns(), 0);
+
+    EXPECT_EQ(result.decoded, 2u);
+    EXPECT_EQ(result.rejected, 1u);
+    ASSERT_EQ(result.runs.size(), 2u);
+    EXPECT_EQ(result.runs[0].rowCount, 1u);
+    EXPECT_EQ(result.runs[1].firstRow, 2u);
+    EXPECT_EQ(storage.value[0][1], 0);
+    EXPECT_EQ(storage.smpCnt[2], 3);
+}
+
+TEST(BatchDecoderTest, RejectsUndersizedColumns)
+{
+    std::vector<std::vector<uint8_t>> frames = {encodeFrame("MU01", 1), encodeFrame("MU01", 2)};
+    const auto spans = spansOf(frames);
+
+    sv::BatchDecoder::Storage storage(1);
+    EXPECT_THROW(sv::BatchDecoder::decode(spans, storage.columns()), std::invalid_argument);
+}
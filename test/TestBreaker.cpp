@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <cmath>
+#include <filesystem>
 
 using namespace sv::sim;
 
@@ -11,7 +12,7 @@ class BreakerModelTest : public ::testing::Test
 protected:
     void SetUp() override
     {
-        breaker = BreakerModel::create();
+        breaker = BreakerModel::create(BreakerDefinition(), BreakerClock::REAL_TIME);
     }
 
     void TearDown() override
@@ -290,7 +291,10 @@ TEST_F(BreakerModelTest, SimulationWithNominalCurrent)
     EXPECT_EQ(result.tripTime, 0.0);
     EXPECT_GT(result.timePoints.size(), 0);
     EXPECT_EQ(result.timePoints.size(), result.currentValues.size());
-    EXPECT_EQ(result.timePoints.size(), result.stateHistory.size());
+    EXPECT_EQ(result.size(), result.timePoints.size());
+    ASSERT_FALSE(result.stateTransitions.empty());
+    EXPECT_EQ(result.stateTransitions.front().step, 0u);
+    EXPECT_EQ(result.stateAt(result.size() - 1), breaker->getState());
 }
 
 TEST_F(BreakerModelTest, SimulationWithFault)
@@ -415,3 +419,102 @@ TEST_F(BreakerModelTest, ConcurrentStateAccess)
 
     EXPECT_EQ(readCount, iterations * 2);
 }
+
+TEST(SimulatedBreakerTest, AdvancesOnlyWhenStepped)
+{
+    using namespace std::chrono_literals;
+    const auto breaker = BreakerModel::create(BreakerDefinition(), BreakerClock::SIMULATED);
+    EXPECT_EQ(breaker->getClock(), BreakerClock::SIMULATED);
+
+    ASSERT_TRUE(breaker->close());
+    std::this_thread::sleep_for(20ms);
+    EXPECT_TRUE(breaker->isClosing());
+
+    breaker->step(99ms);
+    EXPECT_TRUE(breaker->isClosing());
+    EXPECT_GT(breaker->getResistance(), breaker->getDefinition().resistanceOhm);
+    breaker->step(1ms);
+    EXPECT_TRUE(breaker->isClosed());
+    EXPECT_EQ(breaker->getTime(), 100ms);
+
+    // Arc current decays by I / arcDuration per second of simulated time
+    breaker->setCurrent(500.0);
+    ASSERT_TRUE(breaker->open());
+    EXPECT_GT(breaker->getArcVoltage(), 0.0);
+    breaker->step(1ms);
+    EXPECT_DOUBLE_EQ(breaker->getCurrent(), 475.0);
+    breaker->step(48ms);
+    EXPECT_TRUE(breaker->isOpening());
+    EXPECT_DOUBLE_EQ(breaker->getArcVoltage(), 0.0);
+    breaker->step(1ms);
+    EXPECT_TRUE(breaker->isOpen());
+    EXPECT_DOUBLE_EQ(breaker->getCurrent(), 0.0);
+
+    EXPECT_THROW(breaker->step(-1ms), std::invalid_argument);
+    EXPECT_THROW(BreakerModel::create(BreakerDefinition(), BreakerClock::REAL_TIME)->step(1ms), std::logic_error);
+}
+
+TEST(SimulatedBreakerTest, RunsFasterThanRealTimeAndDeterministic)
+{
+    const BreakerDefinition definition;
+    const auto run = [&definition]()
+    {
+        const auto breaker = BreakerModel::create(definition, BreakerClock::SIMULATED);
+        return breaker->runSimulation(400.0, 100.0, definition.maxCurrentA * 1.5, 4.0, 10.0, 0.0001);
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto first = run();
+    const auto wallTime = std::chrono::steady_clock::now() - start;
+    const auto second = run();
+
+    // 10 s of simulated time at 100 us steps
+    EXPECT_LT(wallTime, std::chrono::seconds(2));
+    EXPECT_NEAR(static_cast<double>(first.timePoints.size()), 100000.0, 1.0);
+    EXPECT_TRUE(first.tripOccurred);
+    EXPECT_NEAR(first.tripTime, 4.0, 0.0002);
+    EXPECT_FALSE(first.summary.empty());
+
+    EXPECT_EQ(first.timePoints, second.timePoints);
+    EXPECT_EQ(first.currentValues, second.currentValues);
+    EXPECT_EQ(first.stateTransitions, second.stateTransitions);
+    EXPECT_EQ(first.tripTime, second.tripTime);
+    EXPECT_EQ(first.summary, second.summary);
+}
+
+TEST(SimulationResultTest, StoresStateTransitionsAndExportsBinary)
+{
+    const BreakerDefinition definition;
+    const auto breaker = BreakerModel::create(definition);
+    const auto result = breaker->runSimulation(400.0, 100.0, definition.maxCurrentA * 2.0, 0.5, 2.0, 0.0001);
+
+    ASSERT_NEAR(static_cast<double>(result.size()), 20000.0, 1.0);
+    EXPECT_GE(result.timePoints.capacity(), result.size());
+    EXPECT_LE(result.timePoints.capacity(), result.size() + 1);
+
+    // Closed until the fault trips the breaker: two runs instead of 20000 states
+    ASSERT_EQ(result.stateTransitions.size(), 2u);
+    EXPECT_EQ(result.stateTransitions[0].state, BreakerState::CLOSED);
+    EXPECT_EQ(result.stateTransitions[1].state, BreakerState::OPEN);
+    EXPECT_EQ(result.stateTransitions[1].time, result.tripTime);
+    const size_t tripStep = result.stateTransitions[1].step;
+    EXPECT_EQ(result.stateAt(tripStep - 1), BreakerState::CLOSED);
+    EXPECT_EQ(result.stateAt(tripStep), BreakerState::OPEN);
+    EXPECT_EQ(result.stateAt(result.size() - 1), BreakerState::OPEN);
+    EXPECT_THROW(static_cast<void>(result.stateAt(result.size())), std::out_of_range);
+
+    const auto path = (std::filesystem::temp_directory_path() / "sv_breaker_result.bin").string();
+    result.exportBinary(path);
+    EXPECT_EQ(std::filesystem::file_size(path), 40u + 2 * 8 * result.size() + 2 * 24);
+    const auto loaded = SimulationResult::importBinary(path);
+    EXPECT_EQ(loaded.timePoints, result.timePoints);
+    EXPECT_EQ(loaded.currentValues, result.currentValues);
+    EXPECT_EQ(loaded.stateTransitions, result.stateTransitions);
+    EXPECT_EQ(loaded.tripOccurred, result.tripOccurred);
+    EXPECT_EQ(loaded.tripTime, result.tripTime);
+
+    std::filesystem::resize_file(path, 100);
+    EXPECT_THROW(static_cast<void>(SimulationResult::importBinary(path)), std::runtime_error);
+    std::filesystem::remove(path);
+    EXPECT_THROW(static_cast<void>(SimulationResult::importBinary(path)), std::runtime_error);
+}
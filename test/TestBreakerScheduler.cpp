@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "sv/sim/BreakerScheduler.h"
+
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sv::sim;
+using namespace std::chrono_literals;
+
+namespace
+{
+    /// @brief Reads the number of threads of this process from /proc
+    int threadCount()
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            if (line.starts_with("Threads:"))
+            {
+                return std::stoi(line.substr(8));
+            }
+        }
+        return -1;
+    }
+}
+
+TEST(BreakerSchedulerTest, BreakersArePassiveByDefault)
+{
+    const auto breaker = BreakerModel::create();
+    EXPECT_FALSE(breaker->isScheduled());
+
+    ASSERT_TRUE(breaker->close());
+    std::this_thread::sleep_for(20ms);
+    EXPECT_TRUE(breaker->isClosing());
+
+    breaker->step(100ms);
+    EXPECT_TRUE(breaker->isClosed());
+}
+
+TEST(BreakerSchedulerTest, SharedClockDrivesManyBreakers)
+{
+    const auto scheduler = BreakerScheduler::create(1ms);
+    std::vector<BreakerModel::BreakerPtr> breakers;
+    for (int n = 0; n < 500; ++n)
+    {
+        breakers.push_back(BreakerModel::create());
+        scheduler->attach(breakers.back());
+    }
+    EXPECT_EQ(scheduler->getBreakerCount(), 500u);
+    EXPECT_THROW(breakers[0]->step(1ms), std::logic_error);
+
+    // Only the commanded breakers are on the wheel
+    scheduler->advance(7500us);
+    for (size_t n = 0; n < breakers.size(); n += 2)
+    {
+        ASSERT_TRUE(breakers[n]->close());
+    }
+    EXPECT_EQ(scheduler->getPendingCount(), 250u);
+
+    // Transitions complete on the first tick at or after their end time: 107.5 ms -> 108 ms
+    scheduler->advance(100ms);
+    EXPECT_TRUE(breakers[0]->isClosing());
+    scheduler->advance(500us);
+    for (size_t n = 0; n < breakers.size(); ++n)
+    {
+        EXPECT_EQ(breakers[n]->isClosed(), n % 2 == 0) << n;
+    }
+    EXPECT_EQ(scheduler->getPendingCount(), 0u);
+    EXPECT_EQ(scheduler->now(), 108ms);
+
+    // A destroyed breaker leaves the scheduler
+    breakers.pop_back();
+    EXPECT_EQ(scheduler->getBreakerCount(), 499u);
+}
+
+TEST(BreakerSchedulerTest, MatchesExplicitStepping)
+{
+    const auto scheduler = BreakerScheduler::create(1ms);
+    const auto scheduled = BreakerModel::create();
+    const auto stepped = BreakerModel::create();
+    scheduler->attach(scheduled);
+
+    scheduled->close();
+    stepped->close();
+    scheduler->advance(100ms);
+    stepped->step(100ms);
+    ASSERT_TRUE(scheduled->isClosed());
+
+    scheduled->setCurrent(500.0);
+    stepped->setCurrent(500.0);
+    scheduled->open();
+    stepped->open();
+    for (int n = 0; n < 10; ++n)
+    {
+        scheduler->advance(1ms);
+        stepped->step(1ms);
+        EXPECT_EQ(scheduled->getCurrent(), stepped->getCurrent()) << n;
+    }
+    EXPECT_LT(scheduled->getCurrent(), 500.0);
+
+    // Detached, the breaker continues passive from the scheduler time
+    scheduler->detach(scheduled);
+    EXPECT_FALSE(scheduled->isScheduled());
+    scheduled->step(40ms);
+    EXPECT_TRUE(scheduled->isOpen());
+
+    stepped->close();
+    EXPECT_THROW(scheduler->attach(stepped), std::logic_error);
+    EXPECT_THROW(BreakerScheduler::create(0ns), std::invalid_argument);
+}
+
+TEST(BreakerSchedulerTest, OneThreadForAllRealTimeBreakers)
+{
+    // The shared scheduler thread may already exist from earlier tests
+    static_cast<void>(BreakerScheduler::shared());
+    const int before = threadCount();
+
+    std::vector<BreakerModel::BreakerPtr> breakers;
+    for (int n = 0; n < 200; ++n)
+    {
+        breakers.push_back(BreakerModel::create(BreakerDefinition(), BreakerClock::REAL_TIME));
+        breakers.back()->close();
+    }
+    EXPECT_EQ(threadCount(), before);
+    EXPECT_THROW(BreakerScheduler::shared().advance(1ms), std::logic_error);
+
+    std::this_thread::sleep_for(150ms);
+    for (const auto& breaker : breakers)
+    {
+        EXPECT_TRUE(breaker->isClosed());
+    }
+}
@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include "sv/capture/CaptureReader.h"
+#include "sv/capture/CaptureReplayer.h"
+#include "sv/capture/PcapngWriter.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/model/SampledValueControlBlock.h"
+
+#include <bit>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    std::string tempPath(const std::string& name, const std::string& extension)
+    {
+        return "/tmp/iec61850_" + name + "_" + std::to_string(getpid()) + extension;
+    }
+
+    std::vector<uint8_t> encodeFrame(const uint16_t smpCnt)
+    {
+        auto svcb = sv::SampledValueControlBlock::create("SV01");
+        svcb->setAppId(0x4001);
+        svcb->setMulticastAddress("01:0C:CD:04:00:01");
+
+        sv::ASDU asdu;
+        asdu.svID = "SV01";
+        asdu.smpCnt = smpCnt;
+        asdu.confRev = 1;
+        asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+        for (size_t i = 0; i < asdu.dataSet.size(); ++i)
+        {
+            asdu.dataSet[i].value = static_cast<int32_t>(smpCnt * 10 + i);
+        }
+        asdu.timestamp = sv::Timestamp(std::chrono::nanoseconds(1'000'000));
+
+        sv::BufferWriter writer;
+        sv::FrameCodec::encode(writer, *svcb, asdu, sv::MacAddress::parse("01:0C:CD:04:00:01").bytes(),
+                               sv::FrameCodec::LOCAL_SRC_MAC);
+        const auto span = writer.span();
+        return {span.begin(), span.end()};
+    }
+
+    /// Writes a capture of SV frames spaced 250 us apart.
+    std::string writeSvCapture(const std::string& name, const int frames)
+    {
+        const std::string path = tempPath(name, ".pcapng");
+        const auto writer = sv::PcapngWriter::create(path);
+        for (int i = 0; i < frames; ++i)
+        {
+            writer->capture(encodeFrame(static_cast<uint16_t>(i)), 5'000'000'000ULL + static_cast<uint64_t>(i) * 250'000ULL);
+        }
+        writer->close();
+        return path;
+    }
+
+    template<typename T>
+    void putBigEndian(std::ofstream& out, const T value)
+    {
+        const T swapped = std::byteswap(value);
+        out.write(reinterpret_cast<const char*>(&swapped), sizeof(T));
+    }
+}
+
+TEST(CaptureReaderTest, ReadsPcapngWrittenByCaptureTap)
+{
+    const std::string path = writeSvCapture("reader", 3);
+    const auto reader = sv::CaptureReader::open(path);
+    EXPECT_EQ(reader->getFormat(), sv::CaptureFormat::Pcapng);
+
+    const auto frames = reader->readAll();
+    ASSERT_EQ(frames.size(), 3u);
+    EXPECT_EQ(frames[2].timestampNs, 5'000'500'000ULL);
+    EXPECT_EQ(frames[1].data.size(), frames[1].originalLength);
+
+    const auto asdu = sv::FrameCodec::decode(frames[1].data);
+    ASSERT_TRUE(asdu.has_value());
+    EXPECT_EQ(asdu->smpCnt, 1);
+
+    reader->rewind();
+    EXPECT_TRUE(reader->next().has_value());
+
+    unlink(path.c_str());
+}
+
+TEST(CaptureReaderTest, ReadsBigEndianNanosecondPcap)
+{
+    const std::string path = tempPath("bigendian", ".pcap");
+    const std::vector<uint8_t> frame = {0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01, 0xAA};
+    {
+        std::ofstream out(path, std::ios::binary);
+        putBigEndian<uint32_t>(out, 0xA1B23C4D);
+        putBigEndian<uint16_t>(out, 2);
+        putBigEndian<uint16_t>(out, 4);
+        putBigEndian<uint32_t>(out, 0);
+        putBigEndian<uint32_t>(out, 0);
+        putBigEndian<uint32_t>(out, 65535);
+        putBigEndian<uint32_t>(out, 1);
+
+        putBigEndian<uint32_t>(out, 12);
+        putBigEndian<uint32_t>(out, 345);
+        putBigEndian<uint32_t>(out, static_cast<uint32_t>(frame.size()));
+        putBigEndian<uint32_t>(out, 60);
+        out.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+    }
+
+    const auto reader = sv::CaptureReader::open(path);
+    EXPECT_EQ(reader->getFormat(), sv::CaptureFormat::Pcap);
+
+    const auto captured = reader->next();
+    ASSERT_TRUE(captured.has_value());
+    EXPECT_EQ(captured->timestampNs, 12'000'000'345ULL);
+    EXPECT_EQ(captured->originalLength, 60u);
+    EXPECT_EQ(std::vector<uint8_t>(captured->data.begin(), captured->data.end()), frame);
+    EXPECT_FALSE(reader->next().has_value());
+
+    unlink(path.c_str());
+}
+
+TEST(CaptureReplayerTest, ReplaysThroughParserAndLoopbackSender)
+{
+    const std::string path = writeSvCapture("replay", 50);
+    const auto replayer = sv::CaptureReplayer::create(path);
+    ASSERT_EQ(replayer->getFrameCount(), 50u);
+    EXPECT_EQ(replayer->getCaptureDurationNs(), 49u * 250'000ULL);
+
+    sv::ReplayOptions options;
+    options.timing = sv::ReplayTiming::AsFastAsPossible;
+    options.loops = 2;
+
+    int parsed = 0;
+    const auto parseStats = replayer->replayToParser([&parsed](const sv::ASDU&) { ++parsed; }, options);
+    EXPECT_EQ(parsed, 100);
+    EXPECT_EQ(parseStats.frames, 100u);
+    EXPECT_EQ(parseStats.rejected, 0u);
+    EXPECT_GT(parseStats.framesPerSecond(), 0.0);
+
+    const auto transport = sv::LoopbackTransport::create(64);
+    const auto sender = transport->createSender();
+    options.loops = 1;
+    const auto sendStats = replayer->replayTo(*sender, options);
+    EXPECT_EQ(sendStats.frames, 50u);
+    EXPECT_EQ(transport->getDroppedFrames(), 0u);
+
+    unlink(path.c_str());
+}
+
+TEST(CaptureReplayerTest, ScaledTimingFollowsCaptureClock)
+{
+    const std::string path = writeSvCapture("scaled", 41);
+    const auto replayer = sv::CaptureReplayer::create(path);
+
+    sv::ReplayOptions options;
+    options.timing = sv::ReplayTiming::Scaled;
+    options.speed = 2.0;
+
+    const auto stats = replayer->replay(options, [](const sv::CapturedFrame&) { return true; });
+    EXPECT_EQ(stats.frames, 41u);
+    // 10 ms of capture at 2x speed
+    EXPECT_GE(stats.elapsedSeconds, 0.005);
+    EXPECT_LT(stats.elapsedSeconds, 0.5);
+
+    options.speed = 0.0;
+    EXPECT_THROW(replayer->replay(options, [](const sv::CapturedFrame&) { return true; }), std::invalid_argument);
+
+    unlink(path.c_str());
+}
@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include "sv/model/IedClient.h"
+#include "sv/model/IedModel.h"
+#include "sv/model/IedServer.h"
+#include "sv/model/LogicalNode.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/sim/Feeder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+using namespace sv::sim;
+
+namespace
+{
+    constexpr size_t SAMPLES_PER_CYCLE = 80;
+
+    /// @brief Steps a feeder over whole cycles and returns the RMS of every dataset channel
+    std::array<double, 8> measureRms(FeederSimulator& feeder, const size_t cycles)
+    {
+        std::array<double, 8> sums{};
+        const size_t samples = cycles * SAMPLES_PER_CYCLE;
+        for (size_t n = 0; n < samples; ++n)
+        {
+            const auto& sample = feeder.step();
+            for (size_t channel = 0; channel < 4; ++channel)
+            {
+                sums[channel] += sample.currentsA[channel] * sample.currentsA[channel];
+                sums[4 + channel] += sample.voltagesV[channel] * sample.voltagesV[channel];
+            }
+        }
+        for (auto& sum : sums)
+        {
+            sum = std::sqrt(sum / static_cast<double>(samples));
+        }
+        return sums;
+    }
+}
+
+TEST(FeederSimulatorTest, BalancedLoadFlowBeforeTheFault)
+{
+    FeederDefinition definition;
+    const auto feeder = FeederSimulator::create(definition);
+    EXPECT_TRUE(feeder->getBreaker()->isClosed());
+
+    const std::complex<double> source = definition.sourceVoltageV / std::numbers::sqrt3;
+    const auto load = source / (definition.sourceImpedanceOhm + definition.lineImpedanceOhmPerKm * definition.lineLengthKm +
+                                definition.loadImpedanceOhm);
+    const double voltage = std::abs(source - definition.sourceImpedanceOhm * load);
+
+    const auto rms = measureRms(*feeder, 5);
+    for (size_t phase = 0; phase < 3; ++phase)
+    {
+        EXPECT_NEAR(rms[phase], std::abs(load), 1e-6) << phase;
+        EXPECT_NEAR(rms[4 + phase], voltage, 1e-6) << phase;
+    }
+    EXPECT_NEAR(rms[3], 0.0, 1e-6);
+    EXPECT_NEAR(rms[7], 0.0, 1e-6);
+    EXPECT_EQ(feeder->getSample().index, 5 * SAMPLES_PER_CYCLE - 1);
+    EXPECT_EQ(feeder->getSample().time, std::chrono::microseconds(250 * (5 * SAMPLES_PER_CYCLE - 1)));
+
+    definition.lineLengthKm = 0.0;
+    EXPECT_THROW(static_cast<void>(FeederSimulator::create(definition)), std::invalid_argument);
+}
+
+TEST(FeederSimulatorTest, FaultTypeAndLocationShapeTheCurrents)
+{
+    FeederDefinition definition;
+    definition.fault = {.type = FaultType::A_GROUND, .location = 0.25, .inceptionS = 0.0};
+    const auto earth = FeederSimulator::create(definition);
+    const auto earthFault = earth->getFaultCurrents();
+
+    // Once the DC offset has decayed, Ia carries load plus fault current and In the residual
+    static_cast<void>(measureRms(*earth, 10));
+    const auto rms = measureRms(*earth, 5);
+    EXPECT_TRUE(earth->isFaulted());
+    EXPECT_GT(rms[0], 5.0 * rms[1]);
+    EXPECT_NEAR(rms[3], std::abs(earthFault[0]), 0.01 * std::abs(earthFault[0]));
+    EXPECT_LT(rms[4], 0.7 * rms[5]);
+    EXPECT_NEAR(std::abs(earthFault[1]), 0.0, 1e-9);
+
+    // A fault further down the line draws less current
+    definition.fault.location = 0.75;
+    const auto remote = FeederSimulator::create(definition);
+    EXPECT_LT(std::abs(remote->getFaultCurrents()[0]), std::abs(earthFault[0]));
+
+    // Phase to phase faults have no residual current and opposite phase currents
+    definition.fault.type = FaultType::B_C;
+    const auto phases = FeederSimulator::create(definition);
+    const auto phaseFault = phases->getFaultCurrents();
+    EXPECT_NEAR(std::abs(phaseFault[1] + phaseFault[2]), 0.0, 1e-9);
+    const auto phaseRms = measureRms(*phases, 20);
+    EXPECT_LT(phaseRms[3], 1e-6);
+    EXPECT_GT(phaseRms[1], 5.0 * phaseRms[0]);
+
+    // The three phase fault current is the largest of all
+    definition.fault.type = FaultType::THREE_PHASE;
+    EXPECT_GT(std::abs(FeederSimulator::create(definition)->getFaultCurrents()[0]), std::abs(phaseFault[1]));
+}
+
+TEST(FeederSimulatorTest, FaultInceptionKeepsCurrentContinuous)
+{
+    FeederDefinition definition;
+    definition.fault = {.type = FaultType::THREE_PHASE, .location = 0.1, .inceptionS = 0.02};
+    const auto feeder = FeederSimulator::create(definition);
+
+    // 0.02 s is sample 80; the asymmetric first peak exceeds the symmetrical peak
+    std::array<double, 3> before{};
+    double peak = 0.0;
+    for (size_t n = 0; n < 2 * SAMPLES_PER_CYCLE; ++n)
+    {
+        const auto& sample = feeder->step();
+        if (n == SAMPLES_PER_CYCLE - 1)
+        {
+            before = {sample.currentsA[0], sample.currentsA[1], sample.currentsA[2]};
+        }
+        if (n == SAMPLES_PER_CYCLE)
+        {
+            EXPECT_TRUE(feeder->isFaulted());
+            for (size_t phase = 0; phase < 3; ++phase)
+            {
+                EXPECT_NEAR(sample.currentsA[phase], before[phase], 100.0) << phase;
+            }
+        }
+        peak = std::max(peak, std::abs(sample.currentsA[0]));
+    }
+    EXPECT_GT(peak, std::numbers::sqrt2 * std::abs(feeder->getFaultCurrents()[0]));
+}
+
+TEST(FeederSimulatorTest, BreakerArcAndOpeningClearTheFault)
+{
+    FeederDefinition definition;
+    definition.fault = {.type = FaultType::A_GROUND, .inceptionS = 0.0};
+    const auto feeder = FeederSimulator::create(definition);
+    static_cast<void>(measureRms(*feeder, 2));
+
+    // A 50 ms breaker clears after 200 samples; the arc current decays meanwhile
+    ASSERT_TRUE(feeder->getBreaker()->open());
+    const auto arcing = measureRms(*feeder, 1);
+    EXPECT_TRUE(feeder->getBreaker()->isOpening());
+    static_cast<void>(measureRms(*feeder, 1));
+    EXPECT_LT(measureRms(*feeder, 1)[0], arcing[0]);
+
+    static_cast<void>(measureRms(*feeder, 1));
+    const auto open = measureRms(*feeder, 1);
+    EXPECT_TRUE(feeder->getBreaker()->isOpen());
+    for (const double value : open)
+    {
+        EXPECT_EQ(value, 0.0);
+    }
+
+    // Above its rating the breaker trips open at once
+    definition.breaker.maxCurrentA = 500.0;
+    const auto overloaded = FeederSimulator::create(definition);
+    EXPECT_NE(overloaded->step().currentsA[0], 0.0);
+    EXPECT_TRUE(overloaded->getBreaker()->isOpen());
+    EXPECT_EQ(overloaded->step().currentsA[0], 0.0);
+}
+
+TEST(FeederSimulatorTest, PublishesThroughIedServer)
+{
+    const auto model = sv::IedModel::create("FeederModel");
+    const auto ln = sv::LogicalNode::create("MU01");
+    const auto svcb = sv::SampledValueControlBlock::create("Feeder01");
+    svcb->setAppId(0x4001);
+    svcb->setMulticastAddress("01:0C:CD:04:00:01");
+    ln->addSampledValueControlBlock(svcb);
+    model->addLogicalNode(ln);
+
+    const auto transport = sv::LoopbackTransport::create(64);
+    const auto server = sv::IedServer::create(model, transport);
+    const auto client = sv::IedClient::create(model, transport);
+
+    constexpr size_t FRAMES = 4;
+    std::mutex mutex;
+    std::vector<sv::ASDU> received;
+    client->start([&](const sv::ASDU& asdu)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(asdu);
+    });
+    server->start();
+
+    const auto feeder = FeederSimulator::create(FeederDefinition(), *svcb);
+    for (size_t n = 0; n < FRAMES; ++n)
+    {
+        feeder->publish(*server, svcb);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (received.size() == FRAMES) break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    server->stop();
+    client->stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(received.size(), FRAMES);
+    std::vector<sv::AnalogValue> expected;
+    feeder->toAnalogValues(feeder->getSample(), expected);
+    EXPECT_EQ(received.back().svID, "Feeder01");
+    for (size_t n = 0; n < sv::VALUES_PER_ASDU; ++n)
+    {
+        EXPECT_EQ(received.back().dataSet[n].getScaledInt(), expected[n].getScaledInt()) << n;
+    }
+}
+
+TEST(FeederBankTest, ParallelFeedersMatchSerialAndRunFasterThanRealTime)
+{
+    constexpr size_t FEEDERS = 16;
+    constexpr size_t SAMPLES = 4000;
+
+    const auto bank = FeederBank::create(4);
+    std::vector<FeederSimulator::Ptr> serial;
+    for (size_t n = 0; n < FEEDERS; ++n)
+    {
+        FeederDefinition definition;
+        definition.fault = {.type = static_cast<FaultType>(1 + n % 4), .location = 0.05 * static_cast<double>(n + 1),
+                            .inceptionS = 0.5};
+        bank->add(FeederSimulator::create(definition));
+        serial.push_back(FeederSimulator::create(definition));
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    bank->generate(SAMPLES);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // 16 feeders times one second of samples
+    EXPECT_LT(elapsed, std::chrono::seconds(1));
+    ASSERT_EQ(bank->getFeederCount(), FEEDERS);
+
+    std::vector<int32_t> expected(SAMPLES * sv::VALUES_PER_ASDU);
+    for (size_t n = 0; n < FEEDERS; ++n)
+    {
+        serial[n]->generate(expected);
+        const auto samples = bank->getSamples(n);
+        ASSERT_EQ(samples.size(), expected.size());
+        EXPECT_TRUE(std::equal(samples.begin(), samples.end(), expected.begin())) << n;
+    }
+
+    std::vector<int32_t> partial(5);
+    EXPECT_THROW(serial[0]->generate(partial), std::invalid_argument);
+}
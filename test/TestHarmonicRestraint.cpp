@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include "sv/protection/HarmonicRestraint.h"
+#include "sv/protection/Protection.h"
+
+#include <array>
+#include <cmath>
+#include <functional>
+#include <numbers>
+
+namespace
+{
+    /// @brief Feeds one sample per phase of i1(phase, n) and i2(phase, n) for the given number of samples
+    void feed(sv::HarmonicRestraint& restraint, const size_t samples, const size_t offset,
+              const std::function<double(size_t, size_t)>& side1, const std::function<double(size_t, size_t)>& side2)
+    {
+        for (size_t n = offset; n < offset + samples; ++n)
+        {
+            std::array<double, 3> current1{};
+            std::array<double, 3> current2{};
+            for (size_t p = 0; p < 3; ++p)
+            {
+                current1[p] = side1(p, n);
+                current2[p] = side2(p, n);
+            }
+            static_cast<void>(restraint.update(current1, current2));
+        }
+    }
+
+    double wave(const double amplitude, const double harmonic, const size_t phase, const size_t n, const size_t spp)
+    {
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(n) / static_cast<double>(spp);
+        return amplitude * std::cos(harmonic * (angle - 2.0 * std::numbers::pi * static_cast<double>(phase) / 3.0));
+    }
+
+    double zero(size_t, size_t)
+    {
+        return 0.0;
+    }
+}
+
+TEST(HarmonicRestraintTest, MeasuresHarmonicsAtBothSampleRates)
+{
+    for (const auto spp : {sv::SamplesPerPeriod::SPP_80, sv::SamplesPerPeriod::SPP_256})
+    {
+        const auto restraint = sv::HarmonicRestraint::create(spp);
+        const size_t n = restraint->getSamplesPerPeriod();
+
+        // 10 A peak fundamental, 2 A peak 2nd and 1 A peak 5th harmonic into side 1 only
+        feed(*restraint, n - 1, 0, [n](const size_t p, const size_t k)
+        {
+            return wave(10.0, 1.0, p, k, n) + wave(2.0, 2.0, p, k, n) + wave(1.0, 5.0, p, k, n);
+        }, zero);
+        EXPECT_FALSE(restraint->isValid());
+        feed(*restraint, 1, n - 1, [n](const size_t p, const size_t k)
+        {
+            return wave(10.0, 1.0, p, k, n) + wave(2.0, 2.0, p, k, n) + wave(1.0, 5.0, p, k, n);
+        }, zero);
+        ASSERT_TRUE(restraint->isValid());
+
+        for (size_t p = 0; p < 3; ++p)
+        {
+            EXPECT_NEAR(restraint->getFundamental(p), 10.0 / std::numbers::sqrt2, 1e-9);
+            EXPECT_NEAR(restraint->getSecondHarmonic(p), 2.0 / std::numbers::sqrt2, 1e-9);
+            EXPECT_NEAR(restraint->getFifthHarmonic(p), 1.0 / std::numbers::sqrt2, 1e-9);
+            EXPECT_NEAR(restraint->getRestraint(p), 5.0 / std::numbers::sqrt2, 1e-9);
+            EXPECT_TRUE(restraint->getResult().secondHarmonicBlocked[p]);
+            EXPECT_FALSE(restraint->getResult().fifthHarmonicBlocked[p]);
+        }
+    }
+}
+
+TEST(HarmonicRestraintTest, StaysExactOverManyResyncs)
+{
+    const auto restraint = sv::HarmonicRestraint::create(sv::SamplesPerPeriod::SPP_80);
+    const size_t n = 80;
+    const size_t samples = (sv::HarmonicRestraint::RESYNC_CYCLES * 3 + 1) * n + 17;
+    feed(*restraint, samples, 0, [n](const size_t p, const size_t k) { return wave(100.0, 1.0, p, k, n); },
+         [n](const size_t p, const size_t k) { return wave(40.0, 1.0, p, k, n); });
+
+    EXPECT_NEAR(restraint->getFundamental(0), 60.0 / std::numbers::sqrt2, 1e-9);
+    EXPECT_NEAR(restraint->getRestraint(0), 70.0 / std::numbers::sqrt2, 1e-9);
+    EXPECT_LT(restraint->getSecondHarmonic(0), 1e-9);
+    EXPECT_FALSE(restraint->isBlocked(0));
+}
+
+TEST(HarmonicRestraintTest, BlocksInrushButNotFault)
+{
+    const size_t n = 80;
+
+    // Energizing a transformer: offset, unidirectional magnetizing current rich in 2nd harmonic
+    const auto inrush = sv::HarmonicRestraint::create();
+    feed(*inrush, 2 * n, 0, [n](const size_t p, const size_t k)
+    {
+        const double x = wave(1.0, 1.0, p, k, n);
+        return x > 0.5 ? 60.0 * (x - 0.5) : 0.0;
+    }, zero);
+    for (size_t p = 0; p < 3; ++p)
+    {
+        EXPECT_TRUE(inrush->getResult().secondHarmonicBlocked[p]) << p;
+        EXPECT_TRUE(inrush->isBlocked(p)) << p;
+    }
+
+    // Internal fault: sinusoidal differential current
+    const auto fault = sv::HarmonicRestraint::create();
+    feed(*fault, 2 * n, 0, [n](const size_t p, const size_t k) { return wave(30.0, 1.0, p, k, n); }, zero);
+    for (size_t p = 0; p < 3; ++p)
+    {
+        EXPECT_FALSE(fault->isBlocked(p)) << p;
+    }
+    EXPECT_FALSE(fault->getResult().saturationDetected);
+}
+
+TEST(HarmonicRestraintTest, CrossBlockingAndFifthHarmonic)
+{
+    const size_t n = 80;
+    const auto phaseA = [n](const size_t p, const size_t k)
+    {
+        return wave(10.0, 1.0, p, k, n) + (p == 0 ? wave(5.0, 5.0, p, k, n) : 0.0);
+    };
+
+    const auto cross = sv::HarmonicRestraint::create();
+    feed(*cross, n, 0, phaseA, zero);
+    EXPECT_TRUE(cross->getResult().fifthHarmonicBlocked[0]);
+    EXPECT_FALSE(cross->getResult().fifthHarmonicBlocked[1]);
+    EXPECT_TRUE(cross->isBlocked(1));
+
+    sv::HarmonicRestraintSettings settings;
+    settings.crossBlocking = false;
+    const auto perPhase = sv::HarmonicRestraint::create(sv::SamplesPerPeriod::SPP_80, settings);
+    feed(*perPhase, n, 0, phaseA, zero);
+    EXPECT_TRUE(perPhase->isBlocked(0));
+    EXPECT_FALSE(perPhase->isBlocked(1));
+
+    settings.fifthHarmonicEnabled = false;
+    const auto disabled = sv::HarmonicRestraint::create(sv::SamplesPerPeriod::SPP_80, settings);
+    feed(*disabled, n, 0, phaseA, zero);
+    EXPECT_FALSE(disabled->isBlocked(0));
+}
+
+TEST(HarmonicRestraintTest, DetectsCtSaturationOnExternalFault)
+{
+    const size_t n = 80;
+    const auto restraint = sv::HarmonicRestraint::create();
+
+    // Through fault: 20 A peak flows in at side 1 and out at side 2
+    const auto through = [n](const size_t p, const size_t k) { return wave(20.0, 1.0, p, k, n); };
+    feed(*restraint, n, 0, through, through);
+    EXPECT_TRUE(restraint->getResult().saturationDetected);
+
+    // Side 2 CT saturates and delivers only half the current: a false differential current appears
+    const auto saturated = [n](const size_t p, const size_t k) { return wave(10.0, 1.0, p, k, n); };
+    feed(*restraint, n, n, through, saturated);
+    EXPECT_GT(restraint->getFundamental(0), 5.0);
+    EXPECT_TRUE(restraint->getResult().saturationDetected);
+    EXPECT_TRUE(restraint->isBlocked(0));
+
+    // The block is released saturationBlockCycles after the external fault condition ended
+    feed(*restraint, 6 * n, 2 * n, through, saturated);
+    EXPECT_FALSE(restraint->getResult().saturationDetected);
+
+    restraint->reset();
+    EXPECT_FALSE(restraint->isValid());
+    EXPECT_FALSE(restraint->isBlocked(0));
+    EXPECT_THROW(static_cast<void>(sv::HarmonicRestraint::create(sv::SamplesPerPeriod::SPP_80,
+                                                                 sv::HarmonicRestraintSettings{.secondHarmonicPercent = 0.0})),
+                 std::invalid_argument);
+}
+
+TEST(HarmonicRestraintTest, RestrainsDifferentialSlopeElement)
+{
+    const auto differential = sv::DifferentialProtection::create();
+
+    const auto restrained = differential->update({5.0, 0.0}, {0.0, 0.0}, true);
+    EXPECT_FALSE(restrained.trip);
+    EXPECT_TRUE(restrained.restrained);
+
+    const auto free = differential->update({5.0, 0.0}, {0.0, 0.0}, false);
+    EXPECT_TRUE(free.trip);
+    EXPECT_FALSE(free.restrained);
+
+    // The unrestrained instantaneous element is not blocked
+    const auto instantaneous = differential->update({20.0, 0.0}, {0.0, 0.0}, true);
+    EXPECT_TRUE(instantaneous.trip);
+    EXPECT_TRUE(instantaneous.instantaneous);
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+#include "sv/network/FrameCodec.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/sim/LoadGenerator.h"
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace sv::sim;
+
+namespace
+{
+    /// @brief Sender keeping every frame, failing once a limit is reached
+    class RecordingSender : public sv::NetworkSender
+    {
+    public:
+        RecordingSender(std::vector<std::vector<uint8_t>>& frames, std::mutex& mutex, const size_t limit)
+            : frames_(frames), mutex_(mutex), limit_(limit)
+        {
+        }
+
+        void sendASDU(std::shared_ptr<sv::SampledValueControlBlock>, const sv::ASDU&) override {}
+
+        bool sendRawFrame(const std::span<const uint8_t> frame) override
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (frames_.size() >= limit_)
+            {
+                return false;
+            }
+            frames_.emplace_back(frame.begin(), frame.end());
+            return true;
+        }
+
+    private:
+        std::vector<std::vector<uint8_t>>& frames_;
+        std::mutex& mutex_;
+        size_t limit_;
+    };
+
+    /// @brief Transport handing out RecordingSenders over one frame list
+    class RecordingTransport : public sv::TransportFactory
+    {
+    public:
+        explicit RecordingTransport(const size_t limit = SIZE_MAX) : limit_(limit) {}
+
+        std::unique_ptr<sv::NetworkSender> createSender() override
+        {
+            return std::make_unique<RecordingSender>(frames, mutex, limit_);
+        }
+
+        std::unique_ptr<sv::NetworkReceiver> createReceiver() override { return nullptr; }
+
+        std::string describe() const override { return "recording"; }
+
+        std::vector<std::vector<uint8_t>> frames;
+        std::mutex mutex;
+
+    private:
+        size_t limit_;
+    };
+}
+
+TEST(LoadGeneratorTest, EveryStreamHasItsOwnIdentity)
+{
+    LoadGeneratorOptions options;
+    options.streams = 6;
+    options.threads = 3;
+    options.durationS = 0.01;
+
+    const auto transport = std::make_shared<RecordingTransport>();
+    const auto report = LoadGenerator::create(transport, options)->run();
+
+    // 40 samples of 6 streams at 4000 Hz
+    ASSERT_EQ(report.streams.size(), options.streams);
+    EXPECT_EQ(report.frames, 240u);
+    EXPECT_EQ(report.failed, 0u);
+    ASSERT_EQ(transport->frames.size(), 240u);
+
+    std::map<std::string, std::set<uint16_t>> appIds;
+    std::map<std::string, std::set<uint16_t>> counts;
+    for (const auto& frame : transport->frames)
+    {
+        sv::SVMessage header{};
+        const auto asdu = sv::FrameCodec::decode(frame, &header);
+        ASSERT_TRUE(asdu.has_value());
+        appIds[asdu->svID].insert(header.appID);
+        counts[asdu->svID].insert(asdu->smpCnt);
+
+        const auto identity = LoadGenerator::getIdentity(options, header.appID - options.firstAppId);
+        EXPECT_EQ(asdu->svID, identity.svId);
+        EXPECT_EQ(header.destMac, identity.destinationMac);
+        EXPECT_EQ(header.srcMac, identity.sourceMac);
+    }
+
+    ASSERT_EQ(appIds.size(), options.streams);
+    for (size_t n = 0; n < options.streams; ++n)
+    {
+        const auto identity = LoadGenerator::getIdentity(options, n);
+        EXPECT_EQ(report.streams[n].identity.svId, identity.svId);
+        EXPECT_EQ(report.streams[n].frames, 40u);
+        EXPECT_EQ(appIds[identity.svId], std::set<uint16_t>{static_cast<uint16_t>(0x4000 + n)});
+        EXPECT_EQ(counts[identity.svId].size(), 40u);
+    }
+    EXPECT_EQ(LoadGenerator::getIdentity(options, 0).svId, "MU0001");
+    EXPECT_EQ(LoadGenerator::getIdentity(options, 0x1234).destinationMac,
+              (std::array<uint8_t, 6>{0x01, 0x0C, 0xCD, 0x04, 0x12, 0x34}));
+}
+
+TEST(LoadGeneratorTest, PacesLoopbackStreamsAtTheSampleRate)
+{
+    const auto transport = sv::LoopbackTransport::create();
+    const auto receiver = transport->createReceiver();
+
+    std::mutex mutex;
+    std::map<std::string, size_t> received;
+    receiver->start([&](const sv::ASDU& asdu)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++received[asdu.svID];
+    });
+
+    // 4 merging units at 4000 Hz and one at 14400 Hz
+    LoadGeneratorOptions options;
+    options.streams = 4;
+    options.threads = 2;
+    options.durationS = 0.2;
+    const auto report = LoadGenerator::create(transport, options)->run();
+
+    options.streams = 1;
+    options.threads = 1;
+    options.sampleRate = 14400;
+    options.durationS = 0.05;
+    options.svIdPrefix = "FAST";
+    const auto fast = LoadGenerator::create(transport, options)->run();
+
+    const size_t expected = 4 * 800 + 720;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            size_t total = 0;
+            for (const auto& [svId, frames] : received) total += frames;
+            if (total == expected) break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    receiver->stop();
+
+    EXPECT_EQ(report.frames, 3200u);
+    EXPECT_EQ(report.failed, 0u);
+    EXPECT_GE(report.elapsedSeconds, 0.19);
+    for (const auto& stream : report.streams)
+    {
+        EXPECT_EQ(stream.frames, 800u);
+        EXPECT_NEAR(stream.framesPerSecond, 4000.0, 400.0);
+    }
+    ASSERT_EQ(report.threads.size(), 2u);
+    EXPECT_EQ(report.threads[1].firstStream, 2u);
+    for (const auto& thread : report.threads)
+    {
+        EXPECT_EQ(thread.streams, 2u);
+        EXPECT_EQ(thread.batches, 800u);
+        EXPECT_GE(static_cast<double>(thread.maxLatenessNs), thread.meanLatenessNs);
+        EXPECT_GE(thread.jitterNs, 0.0);
+        EXPECT_GT(thread.cpuPercent, 0.0);
+    }
+    EXPECT_EQ(fast.frames, 720u);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(received["MU0001"], 800u);
+    EXPECT_EQ(received["MU0004"], 800u);
+    EXPECT_EQ(received["FAST0001"], 720u);
+}
+
+TEST(LoadGeneratorTest, RejectsInvalidOptionsAndCountsFailedFrames)
+{
+    const auto transport = std::make_shared<RecordingTransport>(5);
+
+    LoadGeneratorOptions options;
+    options.sampleRate = 4010;
+    EXPECT_THROW(static_cast<void>(LoadGenerator::create(transport, options)), std::invalid_argument);
+    options.sampleRate = 4800;
+    options.threads = 2;
+    EXPECT_THROW(static_cast<void>(LoadGenerator::create(transport, options)), std::invalid_argument);
+    options.threads = 1;
+    options.firstAppId = sv::APP_ID_MAX;
+    options.streams = 2;
+    EXPECT_THROW(static_cast<void>(LoadGenerator::create(transport, options)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(LoadGenerator::create(nullptr, LoadGeneratorOptions{})), std::invalid_argument);
+
+    // The batch stops at the first frame the sender refuses
+    options = {};
+    options.streams = 2;
+    options.durationS = 0.001;
+    const auto report = LoadGenerator::create(transport, options)->run();
+    EXPECT_EQ(report.frames, 5u);
+    EXPECT_EQ(report.failed, 3u);
+    EXPECT_EQ(report.streams[0].frames, 3u);
+    EXPECT_EQ(report.streams[1].frames, 2u);
+}
@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include "sv/model/IedModel.h"
+#include "sv/model/IedServer.h"
+#include "sv/model/IedClient.h"
+#include "sv/model/LogicalNode.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/FrameCodec.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/network/UnixSocketTransport.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+    sv::SampledValueControlBlock::Ptr makeSvcb()
+    {
+        auto svcb = sv::SampledValueControlBlock::create("SV01");
+        svcb->setAppId(0x4001);
+        svcb->setMulticastAddress("01:0C:CD:04:00:01");
+        svcb->setConfRev(7);
+        svcb->setSmpSynch(sv::SmpSynch::Local);
+        return svcb;
+    }
+
+    std::vector<sv::AnalogValue> makeValues(const int32_t base)
+    {
+        std::vector<sv::AnalogValue> values(sv::VALUES_PER_ASDU);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i].value = base + static_cast<int32_t>(i);
+        }
+        return values;
+    }
+}
+
+TEST(LockFreeRingTest, CapacityRoundsToPowerOfTwo)
+{
+    const sv::LockFreeRing<int> ring(5);
+    EXPECT_EQ(ring.capacity(), 8u);
+}
+
+TEST(LockFreeRingTest, PushPopPreservesOrderAndReportsFull)
+{
+    sv::LockFreeRing<int> ring(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(ring.tryPush(i));
+    }
+    EXPECT_FALSE(ring.tryPush(99));
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(ring.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.tryPop(value));
+}
+
+TEST(LockFreeRingTest, ConcurrentProducersDeliverEveryValue)
+{
+    constexpr int PER_PRODUCER = 10000;
+    sv::LockFreeRing<int> ring(256);
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+
+    std::thread consumer([&]()
+    {
+        int value = 0;
+        while (received.load() < 2 * PER_PRODUCER)
+        {
+            if (ring.tryPop(value))
+            {
+                sum += value;
+                ++received;
+            }
+        }
+    });
+
+    auto produce = [&ring]()
+    {
+        for (int i = 1; i <= PER_PRODUCER; ++i)
+        {
+            while (!ring.tryPush(i)) { std::this_thread::yield(); }
+        }
+    };
+    std::thread p1(produce);
+    std::thread p2(produce);
+    p1.join();
+    p2.join();
+    consumer.join();
+
+    constexpr long long expected = 2LL * PER_PRODUCER * (PER_PRODUCER + 1) / 2;
+    EXPECT_EQ(sum.load(), expected);
+}
+
+TEST(FrameCodecTest, EncodeDecodeRoundTrip)
+{
+    const auto svcb = makeSvcb();
+    svcb->setVlanId(5);
+    svcb->setSimulate(true);
+
+    sv::ASDU asdu;
+    asdu.svID = "SV01";
+    asdu.smpCnt = 1234;
+    asdu.confRev = 7;
+    asdu.smpSynch = sv::SmpSynch::Local;
+    asdu.dataSet = makeValues(-100);
+    asdu.timestamp = sv::Timestamp(std::chrono::nanoseconds(123456789));
+
+    sv::BufferWriter writer;
+    sv::FrameCodec::encode(writer, *svcb, asdu, sv::MacAddress::parse("01:0C:CD:04:00:01").bytes(),
+                           sv::FrameCodec::LOCAL_SRC_MAC);
+
+    sv::SVMessage header{};
+    const auto decoded = sv::FrameCodec::decode(writer.span(), &header);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->svID, "SV01");
+    EXPECT_EQ(decoded->smpCnt, 1234);
+    EXPECT_EQ(decoded->confRev, 7u);
+    EXPECT_EQ(decoded->dataSet[3].getScaledInt(), -97);
+    EXPECT_EQ(decoded->timestamp, asdu.timestamp);
+    EXPECT_EQ(header.appID, 0x4001);
+    EXPECT_EQ(header.vlanID, 5);
+    EXPECT_TRUE(header.simulate);
+}
+
+TEST(FrameCodecTest, RejectsShortFrame)
+{
+    const std::vector<uint8_t> frame(10, 0);
+    EXPECT_FALSE(sv::FrameCodec::decode(frame).has_value());
+}
+
+TEST(LoopbackTransportTest, ServerToClientDelivery)
+{
+    const auto model = sv::IedModel::create("LoopbackModel");
+    const auto ln = sv::LogicalNode::create("MU01");
+    const auto svcb = makeSvcb();
+    ln->addSampledValueControlBlock(svcb);
+    model->addLogicalNode(ln);
+
+    const auto transport = sv::LoopbackTransport::create(64);
+    const auto server = sv::IedServer::create(model, transport);
+    const auto client = sv::IedClient::create(model, transport);
+    ASSERT_NE(server, nullptr);
+    ASSERT_NE(client, nullptr);
+
+    constexpr int FRAMES = 20;
+    std::mutex mutex;
+    std::vector<sv::ASDU> received;
+
+    client->start([&](const sv::ASDU& asdu)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(asdu);
+    });
+    server->start();
+
+    for (int i = 0; i < FRAMES; ++i)
+    {
+        server->updateSampledValue(svcb, makeValues(i * 10));
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (received.size() == FRAMES) break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    server->stop();
+    client->stop();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(received.size(), static_cast<size_t>(FRAMES));
+    for (int i = 0; i < FRAMES; ++i)
+    {
+        EXPECT_EQ(received[i].svID, "SV01");
+        EXPECT_EQ(received[i].dataSet[0].getScaledInt(), i * 10);
+    }
+    EXPECT_EQ(transport->getDroppedFrames(), 0u);
+}
+
+TEST(LoopbackTransportTest, FullRingCountsDrops)
+{
+    const auto svcb = makeSvcb();
+    const auto transport = sv::LoopbackTransport::create(2);
+    const auto sender = transport->createSender();
+
+    sv::ASDU asdu;
+    asdu.svID = "SV01";
+    asdu.smpCnt = 0;
+    asdu.confRev = 1;
+    asdu.smpSynch = sv::SmpSynch::None;
+    asdu.dataSet = makeValues(0);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        sender->sendASDU(svcb, asdu);
+    }
+    EXPECT_EQ(transport->getDroppedFrames(), 3u);
+}
+
+TEST(UnixSocketTransportTest, CrossSocketDelivery)
+{
+    const std::string path = "/tmp/iec61850_test_" + std::to_string(getpid()) + ".sock";
+    const auto transport = sv::UnixSocketTransportFactory::create(path);
+    const auto svcb = makeSvcb();
+
+    const auto sender = transport->createSender();
+    const auto receiver = transport->createReceiver();
+
+    std::atomic<int> count{0};
+    std::atomic<int32_t> lastValue{-1};
+    receiver->start([&](const sv::ASDU& asdu)
+    {
+        lastValue = asdu.dataSet[0].getScaledInt();
+        ++count;
+    });
+
+    sv::ASDU asdu;
+    asdu.svID = "SV01";
+    asdu.smpCnt = 0;
+    asdu.confRev = 7;
+    asdu.smpSynch = sv::SmpSynch::Local;
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(3);
+    int32_t sent = 0;
+    while (count.load() < 5 && std::chrono::steady_clock::now() < deadline)
+    {
+        asdu.dataSet = makeValues(++sent);
+        sender->sendASDU(svcb, asdu);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    receiver->stop();
+
+    EXPECT_GE(count.load(), 5);
+    EXPECT_GT(lastValue.load(), 0);
+    EXPECT_LE(lastValue.load(), sent);
+}
+
+TEST(TransportSpecTest, ParsesKnownForms)
+{
+    const auto unixTransport = sv::createTransport("unix:/tmp/sv_spec.sock");
+    ASSERT_NE(unixTransport, nullptr);
+    EXPECT_EQ(unixTransport->describe(), "unix:/tmp/sv_spec.sock");
+
+    const auto loopback = sv::createTransport("loopback");
+    ASSERT_NE(loopback, nullptr);
+    EXPECT_EQ(loopback->describe().rfind("loopback:", 0), 0u);
+
+    const auto eth = sv::createTransport("eth:lo");
+    ASSERT_NE(eth, nullptr);
+    EXPECT_EQ(eth->describe(), "ethernet:lo");
+
+    EXPECT_EQ(sv::createTransport("unix:"), nullptr);
+}
@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "sv/protection/MultiLoopDistance.h"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <thread>
+
+namespace
+{
+    constexpr double kThird = 2.0 * std::numbers::pi / 3.0;
+    constexpr double kLineAngle = 75.0 * std::numbers::pi / 180.0;
+    constexpr double kPhaseVoltage = 6350.0;
+
+    const std::complex<double> kLineImpedance = std::polar(4.0, kLineAngle);
+
+    sv::MultiLoopDistanceSettings instantaneousSettings()
+    {
+        sv::MultiLoopDistanceSettings settings;
+        settings.zone2.delay = std::chrono::microseconds(0);
+        settings.zone3.delay = std::chrono::microseconds(0);
+        return settings;
+    }
+
+    /// Single-phase-to-earth fault on phase A at the impedance z, healthy phases carry no current.
+    void earthFault(const std::complex<double> z, const std::complex<double> k0,
+                    std::array<std::complex<double>, 3>& voltages, std::array<std::complex<double>, 3>& currents)
+    {
+        currents = {std::polar(200.0, -kLineAngle), 0.0, 0.0};
+        voltages = {z * (currents[0] + k0 * currents[0]), std::polar(kPhaseVoltage, -kThird), std::polar(kPhaseVoltage, kThird)};
+    }
+}
+
+TEST(MultiLoopDistanceTest, EarthFaultSelectsCompensatedLoop)
+{
+    const auto settings = instantaneousSettings();
+    const auto protection = sv::MultiLoopDistanceProtection::create(settings);
+
+    std::array<std::complex<double>, 3> voltages;
+    std::array<std::complex<double>, 3> currents;
+    earthFault(kLineImpedance, settings.residualCompensation, voltages, currents);
+
+    const auto result = protection->update(voltages, currents);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::AG);
+    EXPECT_STREQ(sv::toString(result.faultedLoop), "AG");
+    EXPECT_NEAR(std::abs(result.faultImpedance() - kLineImpedance), 0.0, 1e-9);
+    EXPECT_TRUE(result.zone1Trip);
+    EXPECT_EQ(result.loopZones[static_cast<size_t>(sv::FaultLoop::AG)], 0b111);
+    EXPECT_EQ(result.loopZones[static_cast<size_t>(sv::FaultLoop::BG)], 0);
+    EXPECT_EQ(result.loopZones[static_cast<size_t>(sv::FaultLoop::CG)], 0);
+}
+
+TEST(MultiLoopDistanceTest, PhaseToPhaseFaultInZoneTwo)
+{
+    const auto protection = sv::MultiLoopDistanceProtection::create(instantaneousSettings());
+
+    // B-C fault at 10 ohm: Vb - Vc = Z (Ib - Ic) with Ic = -Ib
+    const std::complex<double> z = std::polar(10.0, kLineAngle);
+    const std::complex<double> ib = std::polar(300.0, -kThird - kLineAngle);
+    const std::complex<double> va = std::polar(kPhaseVoltage, 0.0);
+    const std::array<std::complex<double>, 3> voltages = {va, -0.5 * va + z * ib, -0.5 * va - z * ib};
+    const std::array<std::complex<double>, 3> currents = {0.0, ib, -ib};
+
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(currents, voltages);
+    const auto result = protection->update(measurement);
+
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::BC);
+    EXPECT_NEAR(std::abs(result.faultImpedance() - z), 0.0, 1e-9);
+    EXPECT_FALSE(result.zone1Trip);
+    EXPECT_TRUE(result.zone2Trip);
+    EXPECT_EQ(result.loopZones[static_cast<size_t>(sv::FaultLoop::BC)], 0b110);
+}
+
+TEST(MultiLoopDistanceTest, LoadAndReverseFaultsDoNotPickUp)
+{
+    const auto settings = instantaneousSettings();
+    const auto protection = sv::MultiLoopDistanceProtection::create(settings);
+
+    const std::array<std::complex<double>, 3> voltages = {std::polar(kPhaseVoltage, 0.0), std::polar(kPhaseVoltage, -kThird),
+                                                          std::polar(kPhaseVoltage, kThird)};
+    const double loadAngle = std::numbers::pi / 6.0;
+    const std::array<std::complex<double>, 3> load = {std::polar(200.0, -loadAngle), std::polar(200.0, -kThird - loadAngle),
+                                                      std::polar(200.0, kThird - loadAngle)};
+    auto result = protection->update(voltages, load);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::NONE);
+    EXPECT_FALSE(result.zone3Trip);
+    EXPECT_NEAR(std::abs(result.loopImpedanceOhm[static_cast<size_t>(sv::FaultLoop::AG)]), kPhaseVoltage / 200.0, 1e-9);
+
+    std::array<std::complex<double>, 3> faultVoltages;
+    std::array<std::complex<double>, 3> faultCurrents;
+    earthFault(-kLineImpedance, settings.residualCompensation, faultVoltages, faultCurrents);
+    result = protection->update(faultVoltages, faultCurrents);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::NONE);
+
+    // The same fault is in zone 1 of a reverse-looking relay
+    auto reverse = settings;
+    reverse.directionForward = false;
+    protection->setSettings(reverse);
+    result = protection->update(faultVoltages, faultCurrents);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::AG);
+    EXPECT_TRUE(result.zone1Trip);
+}
+
+TEST(MultiLoopDistanceTest, QuadrilateralCoversResistiveFaults)
+{
+    auto settings = instantaneousSettings();
+    settings.zone1.lineAngleRad = 70.0 * std::numbers::pi / 180.0;
+    settings.zone2.enabled = false;
+    settings.zone3.enabled = false;
+    const auto mho = sv::MultiLoopDistanceProtection::create(settings);
+
+    settings.zone1.characteristic = sv::ZoneCharacteristic::QUADRILATERAL;
+    settings.zone1.resistiveReachOhm = 6.0;
+    const auto quad = sv::MultiLoopDistanceProtection::create(settings);
+
+    // 6 ohm of fault resistance pushes the impedance out of the mho circle but not out of the quadrilateral
+    const std::complex<double> z = kLineImpedance + 6.0;
+    std::array<std::complex<double>, 3> voltages;
+    std::array<std::complex<double>, 3> currents;
+    earthFault(z, settings.residualCompensation, voltages, currents);
+
+    EXPECT_FALSE(mho->update(voltages, currents).zone1Trip);
+    const auto result = quad->update(voltages, currents);
+    EXPECT_TRUE(result.zone1Trip);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::AG);
+
+    // Beyond the reactance reach
+    earthFault(std::complex<double>(1.0, 9.0), settings.residualCompensation, voltages, currents);
+    EXPECT_FALSE(quad->update(voltages, currents).zone1Trip);
+}
+
+TEST(MultiLoopDistanceTest, ZoneDelayAndSettingsValidation)
+{
+    auto settings = instantaneousSettings();
+    settings.zone1.enabled = false;
+    settings.zone2.delay = std::chrono::milliseconds(20);
+    settings.zone3.enabled = false;
+    const auto protection = sv::MultiLoopDistanceProtection::create(settings);
+
+    int trips = 0;
+    protection->onTrip([&trips](const sv::MultiLoopDistanceResult&) { ++trips; });
+
+    std::array<std::complex<double>, 3> voltages;
+    std::array<std::complex<double>, 3> currents;
+    earthFault(std::polar(10.0, kLineAngle), settings.residualCompensation, voltages, currents);
+
+    auto result = protection->update(voltages, currents);
+    EXPECT_FALSE(result.zone2Trip);
+    EXPECT_EQ(result.faultedLoop, sv::FaultLoop::AG);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    result = protection->update(voltages, currents);
+    EXPECT_TRUE(result.zone2Trip);
+    EXPECT_EQ(trips, 1);
+
+    settings.zone3.lineAngleRad = 0.0;
+    EXPECT_THROW(protection->setSettings(settings), std::invalid_argument);
+    settings = sv::MultiLoopDistanceSettings();
+    settings.currentThresholdA = 0.0;
+    EXPECT_THROW(static_cast<void>(sv::MultiLoopDistanceProtection::create(settings)), std::invalid_argument);
+}
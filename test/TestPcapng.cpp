@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "sv/capture/PcapngWriter.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    std::string tempPath(const std::string& name)
+    {
+        return "/tmp/iec61850_" + name + "_" + std::to_string(getpid()) + ".pcapng";
+    }
+
+    std::vector<uint8_t> readFile(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+    }
+
+    uint32_t readU32(const std::vector<uint8_t>& data, const size_t offset)
+    {
+        uint32_t value = 0;
+        std::memcpy(&value, data.data() + offset, sizeof(value));
+        return value;
+    }
+}
+
+TEST(PcapngWriterTest, WritesHeadersAndPackets)
+{
+    const std::string path = tempPath("writer");
+    const std::vector<uint8_t> frame = {0x01, 0x0C, 0xCD, 0x04, 0x00, 0x01, 0xAA, 0xBB, 0xCC};
+    {
+        const auto writer = sv::PcapngWriter::create(path);
+        EXPECT_TRUE(writer->capture(frame, 1'700'000'000'123'456'789ULL));
+        EXPECT_TRUE(writer->capture(frame, 1'700'000'000'223'456'789ULL));
+        writer->close();
+
+        const auto stats = writer->getStats();
+        EXPECT_EQ(stats.capturedFrames, 2u);
+        EXPECT_EQ(stats.droppedFrames, 0u);
+    }
+
+    const auto data = readFile(path);
+    constexpr size_t headerSize = 28 + 32;
+    constexpr size_t epbSize = 32 + 12;
+    ASSERT_EQ(data.size(), headerSize + 2 * epbSize);
+
+    EXPECT_EQ(readU32(data, 0), sv::pcapng::SECTION_HEADER_BLOCK);
+    EXPECT_EQ(readU32(data, 8), sv::pcapng::BYTE_ORDER_MAGIC);
+    EXPECT_EQ(readU32(data, 28), sv::pcapng::INTERFACE_DESCRIPTION_BLOCK);
+
+    EXPECT_EQ(readU32(data, headerSize), sv::pcapng::ENHANCED_PACKET_BLOCK);
+    EXPECT_EQ(readU32(data, headerSize + 4), epbSize);
+    const uint64_t ts = (static_cast<uint64_t>(readU32(data, headerSize + 12)) << 32) | readU32(data, headerSize + 16);
+    EXPECT_EQ(ts, 1'700'000'000'123'456'789ULL);
+    EXPECT_EQ(readU32(data, headerSize + 20), frame.size());
+    EXPECT_EQ(std::memcmp(data.data() + headerSize + 28, frame.data(), frame.size()), 0);
+
+    unlink(path.c_str());
+}
+
+TEST(PcapngWriterTest, SmallBuffersSpillToDiskWithoutLoss)
+{
+    const std::string path = tempPath("spill");
+    const std::vector<uint8_t> frame(200, 0x5A);
+    constexpr int FRAMES = 5000;
+
+    const auto writer = sv::PcapngWriter::create(path, 1);
+    uint64_t dropped = 0;
+    for (int i = 0; i < FRAMES; ++i)
+    {
+        if (!writer->capture(frame, 1'000'000'000ULL + i))
+        {
+            ++dropped;
+        }
+    }
+    writer->close();
+
+    const auto stats = writer->getStats();
+    EXPECT_EQ(stats.capturedFrames + stats.droppedFrames, static_cast<uint64_t>(FRAMES));
+    EXPECT_EQ(stats.droppedFrames, dropped);
+    EXPECT_EQ(stats.bytesWritten, 60 + stats.capturedFrames * (32 + 200));
+
+    unlink(path.c_str());
+}
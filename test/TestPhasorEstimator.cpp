@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "sv/protection/PhasorEstimator.h"
+#include "sv/protection/Protection.h"
+#include "sv/model/SampledValueControlBlock.h"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+
+namespace
+{
+    /// Feeds cycles of Ia = iPeak*cos(wt + iPhase), Va = vPeak*cos(wt) plus an optional 3rd harmonic.
+    void feed(sv::PhasorEstimator& estimator, const size_t samples, const double iPeak, const double iPhase,
+              const double vPeak, const double harmonic = 0.0)
+    {
+        const auto n = static_cast<double>(estimator.getSamplesPerPeriod());
+        for (size_t k = 0; k < samples; ++k)
+        {
+            const double theta = 2.0 * std::numbers::pi * static_cast<double>(k) / n;
+            std::array<double, sv::PhasorEstimator::CHANNELS> values{};
+            values[0] = iPeak * std::cos(theta + iPhase) + harmonic * std::cos(3.0 * theta);
+            values[4] = vPeak * std::cos(theta);
+            estimator.update(values);
+        }
+    }
+}
+
+TEST(PhasorEstimatorTest, EstimatesRmsMagnitudeAndAngle)
+{
+    const auto partial = sv::PhasorEstimator::create();
+    feed(*partial, 79, 100.0, -0.5, 325.0);
+    EXPECT_FALSE(partial->isValid());
+
+    const auto estimator = sv::PhasorEstimator::create();
+    feed(*estimator, 80, 100.0, -0.5, 325.0);
+    ASSERT_TRUE(estimator->isValid());
+
+    const auto current = estimator->getCurrent(0);
+    EXPECT_NEAR(std::abs(current), 100.0 / std::numbers::sqrt2, 1e-9);
+    EXPECT_NEAR(std::arg(current), -0.5, 1e-9);
+    EXPECT_NEAR(std::abs(estimator->getVoltage(0)), 325.0 / std::numbers::sqrt2, 1e-9);
+    EXPECT_NEAR(std::abs(estimator->getPhasor(1)), 0.0, 1e-12);
+}
+
+TEST(PhasorEstimatorTest, RejectsHarmonicsAndTracksManyCycles)
+{
+    const auto estimator = sv::PhasorEstimator::create(sv::SamplesPerPeriod::SPP_256, sv::SignalFrequency::FREQ_60_HZ);
+    EXPECT_DOUBLE_EQ(estimator->getFrequencyHz(), 60.0);
+
+    feed(*estimator, 256 * 500 + 17, 50.0, 0.0, 0.0, 20.0);
+
+    // The window now starts mid-cycle, so compare magnitudes only
+    EXPECT_NEAR(std::abs(estimator->getCurrent(0)), 50.0 / std::numbers::sqrt2, 1e-6);
+}
+
+TEST(PhasorEstimatorTest, ScalesAsduFromControlBlock)
+{
+    const auto svcb = sv::SampledValueControlBlock::create("SV01");
+    svcb->setCurrentScaling(10);
+    const auto estimator = sv::PhasorEstimator::create(*svcb);
+
+    sv::ASDU asdu;
+    asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+    for (size_t k = 0; k < estimator->getSamplesPerPeriod(); ++k)
+    {
+        const double theta = 2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(estimator->getSamplesPerPeriod());
+        asdu.dataSet[0].value = static_cast<int32_t>(std::lround(1000.0 * std::cos(theta)));
+        asdu.dataSet[4].value = static_cast<int32_t>(std::lround(23000.0 * std::cos(theta)));
+        estimator->update(asdu);
+    }
+
+    EXPECT_NEAR(std::abs(estimator->getCurrent(0)), 100.0 / std::numbers::sqrt2, 0.05);
+    EXPECT_NEAR(std::abs(estimator->getVoltage(0)), 230.0 / std::numbers::sqrt2, 0.05);
+
+    estimator->reset();
+    EXPECT_FALSE(estimator->isValid());
+    EXPECT_EQ(estimator->getCurrent(0), std::complex<double>{});
+}
+
+TEST(PhasorEstimatorTest, FeedsDistanceProtectionWithFundamentalImpedance)
+{
+    const auto estimator = sv::PhasorEstimator::create();
+    // 230 V over 450 A lagging by 50 degrees: |Z| = 0.511 Ohm inside the 60 degree zone angle
+    const double lag = 50.0 * std::numbers::pi / 180.0;
+    feed(*estimator, 80, 450.0, -lag, 230.0);
+
+    sv::DistanceProtectionSettings settings;
+    settings.zone1.reachOhm = 0.8;
+    const auto protection = sv::DistanceProtection::create(settings);
+
+    const auto result = protection->update(estimator->getVoltage(0), estimator->getCurrent(0));
+    EXPECT_NEAR(result.measuredImpedanceOhm, 230.0 / 450.0, 1e-9);
+    EXPECT_NEAR(result.measuredAngleRad, lag, 1e-9);
+    EXPECT_TRUE(result.zone1Trip);
+}
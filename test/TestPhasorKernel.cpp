@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "sv/protection/PhasorKernel.h"
+#include "sv/protection/PhasorEstimator.h"
+#include "sv/model/SampledValueControlBlock.h"
+
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Builds interleaved 8-channel datasets: 50 A / 230 V peak fundamentals plus a 3rd harmonic and noise.
+    std::vector<int32_t> makeDatasets(const size_t samplesPerPeriod, const size_t samples)
+    {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<int32_t> noise(-20, 20);
+
+        std::vector<int32_t> data(samples * sv::PhasorKernel::CHANNELS);
+        for (size_t k = 0; k < samples; ++k)
+        {
+            const double theta = 2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(samplesPerPeriod);
+            for (size_t ch = 0; ch < sv::PhasorKernel::CHANNELS; ++ch)
+            {
+                const double shift = 2.0 * std::numbers::pi / 3.0 * static_cast<double>(ch % 4);
+                const bool voltage = ch >= sv::PhasorKernel::FIRST_VOLTAGE_CHANNEL;
+                const double value = voltage
+                    ? 230.0 * sv::ScalingFactors::VOLTAGE_DEFAULT * std::cos(theta - shift)
+                    : 50.0 * sv::ScalingFactors::CURRENT_DEFAULT * (std::cos(theta - shift) + 0.2 * std::cos(3.0 * theta));
+                data[k * sv::PhasorKernel::CHANNELS + ch] = static_cast<int32_t>(std::lround(value)) + noise(rng);
+            }
+        }
+        return data;
+    }
+
+    std::vector<sv::PhasorKernel::Isa> supportedIsas()
+    {
+        std::vector<sv::PhasorKernel::Isa> isas;
+        for (const auto isa : {sv::PhasorKernel::Isa::Scalar, sv::PhasorKernel::Isa::Avx2, sv::PhasorKernel::Isa::Avx512})
+        {
+            if (sv::PhasorKernel::isSupported(isa))
+            {
+                isas.push_back(isa);
+            }
+        }
+        return isas;
+    }
+}
+
+TEST(PhasorKernelTest, AllInstructionSetsMatchReferenceEstimator)
+{
+    constexpr size_t samples = 80 * 200 + 33;
+    const auto data = makeDatasets(80, samples);
+
+    const auto reference = sv::PhasorEstimator::create();
+    sv::ASDU asdu;
+    asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+    for (size_t k = 0; k < samples; ++k)
+    {
+        for (size_t ch = 0; ch < sv::VALUES_PER_ASDU; ++ch)
+        {
+            asdu.dataSet[ch].value = data[k * sv::VALUES_PER_ASDU + ch];
+        }
+        reference->update(asdu);
+    }
+
+    for (const auto isa : supportedIsas())
+    {
+        const auto kernel = sv::PhasorKernel::create(sv::SamplesPerPeriod::SPP_80, sv::ScalingFactors::CURRENT_DEFAULT,
+                                                     sv::ScalingFactors::VOLTAGE_DEFAULT, isa);
+        EXPECT_EQ(kernel->getIsa(), isa);
+
+        // Mix single updates and block processing
+        kernel->update(std::span<const int32_t, sv::PhasorKernel::CHANNELS>(data.data(), sv::PhasorKernel::CHANNELS));
+        kernel->process(std::span<const int32_t>(data).subspan(sv::PhasorKernel::CHANNELS));
+        ASSERT_TRUE(kernel->isValid());
+
+        for (size_t ch = 0; ch < sv::PhasorKernel::CHANNELS; ++ch)
+        {
+            EXPECT_NEAR(std::abs(kernel->getPhasor(ch) - reference->getPhasor(ch)), 0.0, 1e-6)
+                << "isa=" << static_cast<int>(isa) << " ch=" << ch;
+        }
+    }
+}
+
+TEST(PhasorKernelTest, ComputesTrueRmsIncludingHarmonics)
+{
+    const auto data = makeDatasets(256, 256 * 3);
+
+    for (const auto isa : supportedIsas())
+    {
+        const auto kernel = sv::PhasorKernel::create(sv::SamplesPerPeriod::SPP_256, sv::ScalingFactors::CURRENT_DEFAULT,
+                                                     sv::ScalingFactors::VOLTAGE_DEFAULT, isa);
+        kernel->process(data);
+
+        // Current: 50 A fundamental with 20 % third harmonic; voltage: pure 230 V peak
+        const double currentRms = 50.0 / std::numbers::sqrt2 * std::sqrt(1.0 + 0.2 * 0.2);
+        EXPECT_NEAR(kernel->getRms(0), currentRms, 0.05);
+        EXPECT_NEAR(std::abs(kernel->getPhasor(0)), 50.0 / std::numbers::sqrt2, 0.05);
+        EXPECT_NEAR(kernel->getRms(4), 230.0 / std::numbers::sqrt2, 0.05);
+        EXPECT_NEAR(std::arg(kernel->getPhasor(5)), -2.0 * std::numbers::pi / 3.0, 1e-3);
+
+        kernel->reset();
+        EXPECT_FALSE(kernel->isValid());
+        EXPECT_DOUBLE_EQ(kernel->getRms(0), 0.0);
+    }
+}
+
+TEST(PhasorKernelTest, UsesControlBlockScaling)
+{
+    const auto svcb = sv::SampledValueControlBlock::create("SV01");
+    svcb->setCurrentScaling(1);
+    svcb->setVoltageScaling(1);
+    const auto kernel = sv::PhasorKernel::create(*svcb);
+    EXPECT_EQ(kernel->getSamplesPerPeriod(), 80u);
+
+    std::vector<int32_t> data(80 * sv::PhasorKernel::CHANNELS, 7);
+    kernel->process(data);
+    EXPECT_NEAR(kernel->getRms(0), 7.0, 1e-9);
+    EXPECT_NEAR(std::abs(kernel->getPhasor(0)), 0.0, 1e-9);
+
+    EXPECT_THROW(static_cast<void>(sv::PhasorKernel::create(sv::SamplesPerPeriod::SPP_80, 0)), std::invalid_argument);
+}
@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+#include "sv/core/pipeline.h"
+#include "sv/model/SampledValueControlBlock.h"
+#include "sv/network/LoopbackTransport.h"
+#include "sv/network/UnixSocketTransport.h"
+#include "sv/protection/Protection.h"
+#include "sv/protection/TripEvents.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace
+{
+    template <typename Predicate>
+    bool waitUntil(Predicate predicate)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!predicate())
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+TEST(PipelineLatencyTest, ThreadShardsMergeIntoOneHistogram)
+{
+    sv::LatencyHistogram first;
+    sv::LatencyHistogram second;
+    for (uint64_t ns = 1; ns <= 100; ++ns)
+    {
+        first.recordExclusive(ns * 1000);
+    }
+    second.recordExclusive(1'000'000);
+
+    sv::LatencyHistogram merged;
+    merged.merge(first);
+    merged.merge(second);
+    EXPECT_EQ(merged.count(), 101u);
+    EXPECT_EQ(merged.maxNs(), 1'000'000u);
+    EXPECT_NEAR(merged.meanNs(), (5050.0 * 1000.0 + 1'000'000.0) / 101.0, 1e-6);
+    EXPECT_NEAR(static_cast<double>(merged.percentileNs(50.0)), 50'000.0, 50'000.0 * 0.125);
+
+    // Records from threads that have exited stay in the snapshot
+    sv::PipelineLatency::reset();
+    std::vector<std::thread> threads;
+    for (int n = 0; n < 4; ++n)
+    {
+        threads.emplace_back([]
+        {
+            for (int k = 0; k < 1000; ++k)
+            {
+                sv::PipelineLatency::record(sv::PipelineStage::PARSED, 2000);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto snapshot = sv::PipelineLatency::snapshot();
+    EXPECT_EQ(snapshot[sv::PipelineStage::PARSED].count, 4000u);
+    EXPECT_EQ(snapshot[sv::PipelineStage::PARSED].maxNs, 2000u);
+    EXPECT_EQ(snapshot[sv::PipelineStage::TRIP].count, 0u);
+    EXPECT_GE(snapshot.threads, 1u);
+
+    sv::LatencyHistogram parsed;
+    sv::PipelineLatency::merge(sv::PipelineStage::PARSED, parsed);
+    EXPECT_EQ(parsed.count(), 4000u);
+}
+
+TEST(PipelineLatencyTest, FrameOriginFollowsTheCallingThread)
+{
+    sv::PipelineLatency::reset();
+    EXPECT_EQ(sv::PipelineLatency::frameOrigin(), 0);
+
+    const int64_t origin = sv::PipelineLatency::nowNs() - 5000;
+    {
+        const sv::PipelineFrame frame(origin);
+        EXPECT_EQ(sv::PipelineLatency::frameOrigin(), origin);
+        std::thread([] { EXPECT_EQ(sv::PipelineLatency::frameOrigin(), 0); }).join();
+        {
+            const sv::PipelineFrame inner(origin + 1);
+            EXPECT_EQ(sv::PipelineLatency::frameOrigin(), origin + 1);
+        }
+        EXPECT_EQ(sv::PipelineLatency::frameOrigin(), origin);
+        sv::PipelineLatency::mark(sv::PipelineStage::CALLBACK);
+    }
+    EXPECT_EQ(sv::PipelineLatency::frameOrigin(), 0);
+
+    // Without a frame, and while disabled, nothing is recorded
+    sv::PipelineLatency::mark(sv::PipelineStage::CALLBACK);
+    sv::PipelineLatency::setEnabled(false);
+    sv::PipelineLatency::record(sv::PipelineStage::CALLBACK, 1);
+    sv::PipelineLatency::setEnabled(true);
+
+    const auto callback = sv::PipelineLatency::snapshot()[sv::PipelineStage::CALLBACK];
+    EXPECT_EQ(callback.count, 1u);
+    EXPECT_GE(callback.maxNs, 5000u);
+}
+
+TEST(PipelineLatencyTest, RecordsEveryStageFromReceiveToTrip)
+{
+    sv::PipelineLatency::reset();
+
+    const auto dispatcher = sv::TripEventDispatcher::create();
+    std::atomic<size_t> trips{0};
+    dispatcher->subscribe([&trips](const sv::TripEvent& event)
+    {
+        EXPECT_GT(event.originNs, 0);
+        trips.fetch_add(1);
+    });
+    dispatcher->start();
+
+    const auto differential = sv::DifferentialProtection::create(sv::DifferentialProtectionSettings{});
+    differential->setTripDispatcher(dispatcher, 7);
+
+    const auto transport = sv::LoopbackTransport::create();
+    const auto sender = transport->createSender();
+    const auto receiver = transport->createReceiver();
+    std::atomic<size_t> received{0};
+    receiver->start([&](const sv::ASDU& asdu)
+    {
+        // Even frames are far above the instantaneous threshold, odd frames are healthy, so every
+        // even frame is a rising trip edge
+        const double differentialA = asdu.smpCnt % 2 == 0 ? 1000.0 : 0.0;
+        static_cast<void>(differential->update({differentialA, 0.0}, {0.0, 0.0}));
+        received.fetch_add(1);
+    });
+
+    constexpr size_t FRAMES = 50;
+    constexpr size_t TRIPS = FRAMES / 2;
+    auto svcb = sv::SampledValueControlBlock::create("SV01");
+    svcb->setMulticastAddress("01:0C:CD:04:00:01");
+    sv::ASDU asdu{};
+    asdu.svID = "MU01";
+    asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+    for (size_t n = 0; n < FRAMES; ++n)
+    {
+        asdu.smpCnt = static_cast<uint16_t>(n);
+        sender->sendASDU(svcb, asdu);
+    }
+
+    ASSERT_TRUE(waitUntil([&] { return received.load() == FRAMES && trips.load() == TRIPS; }));
+    receiver->stop();
+    dispatcher->stop();
+
+    const auto snapshot = sv::PipelineLatency::snapshot();
+    double previousMean = 0.0;
+    for (size_t n = 0; n < sv::PIPELINE_STAGES; ++n)
+    {
+        const auto stage = static_cast<sv::PipelineStage>(n);
+        SCOPED_TRACE(sv::toString(stage));
+        EXPECT_EQ(snapshot[stage].count, stage == sv::PipelineStage::TRIP ? TRIPS : FRAMES);
+
+        // Every stage is measured from the same origin, so they can only grow along the pipeline
+        EXPECT_GE(snapshot[stage].meanNs, previousMean);
+        EXPECT_LE(snapshot[stage].p50Ns, snapshot[stage].maxNs);
+        previousMean = snapshot[stage].meanNs;
+    }
+    EXPECT_NE(snapshot.toString().find("TRIP"), std::string::npos);
+}
+
+TEST(PipelineLatencyTest, UnixReceiverRecordsKernelReceiveTime)
+{
+    sv::PipelineLatency::reset();
+
+    const std::string path = "/tmp/iec61850_latency_" + std::to_string(getpid()) + ".sock";
+    const auto transport = sv::UnixSocketTransportFactory::create(path);
+    const auto sender = transport->createSender();
+    const auto receiver = transport->createReceiver();
+    std::atomic<size_t> received{0};
+    receiver->start([&received](const sv::ASDU&) { received.fetch_add(1); });
+
+    auto svcb = sv::SampledValueControlBlock::create("SV01");
+    svcb->setMulticastAddress("01:0C:CD:04:00:01");
+    sv::ASDU asdu{};
+    asdu.svID = "MU01";
+    asdu.dataSet.resize(sv::VALUES_PER_ASDU);
+
+    // The receiver connects asynchronously, so keep publishing until frames arrive
+    constexpr size_t FRAMES = 5;
+    ASSERT_TRUE(waitUntil([&]
+    {
+        sender->sendASDU(svcb, asdu);
+        ++asdu.smpCnt;
+        return received.load() >= FRAMES;
+    }));
+    receiver->stop();
+
+    // Every decoded frame carries its SO_TIMESTAMPNS receive time
+    const auto snapshot = sv::PipelineLatency::snapshot();
+    EXPECT_GE(snapshot[sv::PipelineStage::PARSED].count, FRAMES);
+    EXPECT_EQ(snapshot[sv::PipelineStage::KERNEL_RX].count, snapshot[sv::PipelineStage::PARSED].count);
+}
+
+TEST(PipelineLatencyTest, ReporterDumpsPeriodically)
+{
+    EXPECT_THROW(static_cast<void>(sv::PipelineLatencyReporter::create(std::chrono::milliseconds(0))), std::invalid_argument);
+
+    sv::PipelineLatency::reset();
+    sv::PipelineLatency::record(sv::PipelineStage::DECISION, 1234);
+
+    std::mutex mutex;
+    std::vector<sv::PipelineSnapshot> snapshots;
+    const auto reporter = sv::PipelineLatencyReporter::create(std::chrono::milliseconds(5), [&](const sv::PipelineSnapshot& snapshot)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        snapshots.push_back(snapshot);
+    });
+
+    reporter->start();
+    EXPECT_TRUE(reporter->isRunning());
+    ASSERT_TRUE(waitUntil([&] { return reporter->getReports() >= 2; }));
+    reporter->stop();
+    EXPECT_FALSE(reporter->isRunning());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_GE(snapshots.size(), 2u);
+    EXPECT_EQ(snapshots.front()[sv::PipelineStage::DECISION].count, 1u);
+    EXPECT_EQ(snapshots.front()[sv::PipelineStage::DECISION].maxNs, 1234u);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "sv/protection/Protection.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<std::complex<double>> randomPhasors(std::mt19937& rng, const size_t count, const double maxMagnitude)
+    {
+        std::uniform_real_distribution<double> magnitude(0.0, maxMagnitude);
+        std::uniform_real_distribution<double> angle(-std::numbers::pi, std::numbers::pi);
+        std::vector<std::complex<double>> phasors(count);
+        for (auto& phasor : phasors)
+        {
+            phasor = std::polar(magnitude(rng), angle(rng));
+        }
+        return phasors;
+    }
+}
+
+TEST(ProtectionBlockTest, DistanceBlockMatchesPerSampleUpdate)
+{
+    // 150 samples spans more than two internal chunks
+    std::mt19937 rng(7);
+    const auto voltages = randomPhasors(rng, 150, 300.0);
+    const auto currents = randomPhasors(rng, 150, 40.0);
+
+    const auto single = sv::DistanceProtection::create();
+    const auto block = sv::DistanceProtection::create();
+
+    int blockTrips = 0;
+    block->onTrip([&blockTrips](const sv::DistanceProtectionResult&) { ++blockTrips; });
+
+    std::vector<sv::DistanceProtectionResult> results(voltages.size());
+    block->updateBlock(voltages, currents, results);
+
+    int expectedTrips = 0;
+    for (size_t k = 0; k < voltages.size(); ++k)
+    {
+        const auto expected = single->update(voltages[k], currents[k]);
+        EXPECT_NEAR(results[k].measuredImpedanceOhm, expected.measuredImpedanceOhm, 1e-9) << k;
+        EXPECT_NEAR(results[k].measuredAngleRad, expected.measuredAngleRad, 1e-9) << k;
+        EXPECT_EQ(results[k].zone1Trip, expected.zone1Trip) << k;
+        expectedTrips += results[k].zone1Trip || results[k].zone2Trip || results[k].zone3Trip;
+    }
+    EXPECT_GT(expectedTrips, 0);
+    EXPECT_EQ(blockTrips, expectedTrips);
+}
+
+TEST(ProtectionBlockTest, DifferentialBlockMatchesPerSampleUpdate)
+{
+    std::mt19937 rng(11);
+    const auto side1 = randomPhasors(rng, 200, 20.0);
+    const auto side2 = randomPhasors(rng, 200, 20.0);
+
+    const auto single = sv::DifferentialProtection::create();
+    const auto block = sv::DifferentialProtection::create();
+
+    std::vector<sv::DifferentialProtectionResult> results(side1.size());
+    block->updateBlock(side1, side2, results);
+
+    for (size_t k = 0; k < side1.size(); ++k)
+    {
+        const auto expected = single->update(side1[k], side2[k]);
+        EXPECT_NEAR(results[k].operatingCurrentA, expected.operatingCurrentA, 1e-9) << k;
+        EXPECT_NEAR(results[k].restraintCurrentA, expected.restraintCurrentA, 1e-9) << k;
+        EXPECT_EQ(results[k].trip, expected.trip) << k;
+        EXPECT_EQ(results[k].instantaneous, expected.instantaneous) << k;
+    }
+}
+
+TEST(ProtectionBlockTest, DifferentialBlockHonoursRestraint)
+{
+    std::mt19937 rng(13);
+    const auto side1 = randomPhasors(rng, 200, 20.0);
+    const auto side2 = randomPhasors(rng, 200, 20.0);
+    std::vector<uint8_t> restrained(side1.size());
+    for (size_t k = 0; k < restrained.size(); k += 2)
+    {
+        restrained[k] = 1;
+    }
+
+    const auto single = sv::DifferentialProtection::create();
+    const auto block = sv::DifferentialProtection::create();
+
+    std::vector<sv::DifferentialProtectionResult> results(side1.size());
+    block->updateBlock(side1, side2, restrained, results);
+
+    int blocked = 0;
+    for (size_t k = 0; k < side1.size(); ++k)
+    {
+        const auto expected = single->update(side1[k], side2[k], restrained[k] != 0);
+        EXPECT_EQ(results[k].trip, expected.trip) << k;
+        EXPECT_EQ(results[k].instantaneous, expected.instantaneous) << k;
+        EXPECT_EQ(results[k].restrained, expected.restrained) << k;
+        EXPECT_FALSE(results[k].trip && results[k].restrained) << k;
+        blocked += results[k].restrained;
+    }
+    EXPECT_GT(blocked, 0);
+
+    const std::vector<uint8_t> tooShort(side1.size() - 1, 1);
+    EXPECT_THROW(block->updateBlock(side1, side2, tooShort, results), std::invalid_argument);
+}
+
+TEST(ProtectionBlockTest, RejectsMismatchedSpansAndHonoursEnable)
+{
+    const auto differential = sv::DifferentialProtection::create();
+    const std::vector<std::complex<double>> side1(4, {20.0, 0.0});
+    const std::vector<std::complex<double>> side2(3);
+    std::vector<sv::DifferentialProtectionResult> results(4);
+    EXPECT_THROW(differential->updateBlock(side1, side2, results), std::invalid_argument);
+
+    differential->setEnabled(false);
+    results[0].trip = true;
+    differential->updateBlock(side1, side1, results);
+    EXPECT_FALSE(results[0].trip);
+
+    const auto distance = sv::DistanceProtection::create();
+    std::vector<sv::DistanceProtectionResult> tooShort(1);
+    EXPECT_THROW(distance->updateBlock(side1, side1, tooShort), std::invalid_argument);
+}
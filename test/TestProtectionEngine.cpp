@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "sv/protection/ProtectionEngine.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    std::vector<std::complex<double>> randomPhasors(std::mt19937& rng, const size_t count, const double maxMagnitude)
+    {
+        std::uniform_real_distribution<double> magnitude(0.0, maxMagnitude);
+        std::uniform_real_distribution<double> angle(-std::numbers::pi, std::numbers::pi);
+        std::vector<std::complex<double>> phasors(count);
+        for (auto& phasor : phasors)
+        {
+            phasor = std::polar(magnitude(rng), angle(rng));
+        }
+        return phasors;
+    }
+
+    sv::RelaySettings relaySettings(const uint32_t id)
+    {
+        sv::RelaySettings settings;
+        settings.elementId = id;
+        settings.distance.zone1.reachOhm = 5.0 + static_cast<double>(id % 7);
+        settings.distance.zone2.delay = std::chrono::milliseconds(300);
+        settings.distance.zone3.delay = std::chrono::milliseconds(600);
+        settings.distance.directionForward = id % 5 != 0;
+        settings.differential.enabled = id % 2 == 0;
+        settings.differential.slopePercent = 20.0 + static_cast<double>(id % 3) * 10.0;
+        return settings;
+    }
+}
+
+TEST(ProtectionEngineTest, MatchesIndividualElements)
+{
+    constexpr size_t relays = 203;
+    std::mt19937 rng(11);
+    const auto voltages = randomPhasors(rng, relays, 300.0);
+    const auto currents = randomPhasors(rng, relays, 40.0);
+    const auto remote = randomPhasors(rng, relays, 40.0);
+
+    const auto engine = sv::ProtectionEngine::create(3);
+    for (uint32_t id = 0; id < relays; ++id)
+    {
+        EXPECT_EQ(engine->addRelay(relaySettings(id)), id);
+    }
+    engine->start();
+    engine->evaluate(voltages, currents, remote, 0);
+    engine->stop();
+
+    const auto trips = engine->getTrips();
+    ASSERT_EQ(trips.size(), relays);
+
+    size_t distanceTrips = 0;
+    size_t differentialTrips = 0;
+    for (uint32_t id = 0; id < relays; ++id)
+    {
+        const auto settings = relaySettings(id);
+
+        // Only zone 1 has no delay, so it is the only zone that can trip on the first sample
+        const auto distance = sv::DistanceProtection::create(settings.distance)->update(voltages[id], currents[id]);
+        EXPECT_EQ((trips[id] & sv::ProtectionEngine::TRIP_ZONE1) != 0, distance.zone1Trip) << id;
+        EXPECT_EQ(trips[id] & (sv::ProtectionEngine::TRIP_ZONE2 | sv::ProtectionEngine::TRIP_ZONE3), 0) << id;
+
+        auto expected = sv::DifferentialProtection::create(settings.differential)->update(currents[id], remote[id]);
+        if (!settings.differential.enabled)
+        {
+            expected = sv::DifferentialProtectionResult{};
+        }
+        EXPECT_EQ((trips[id] & sv::ProtectionEngine::TRIP_DIFFERENTIAL) != 0, expected.trip) << id;
+        EXPECT_EQ((trips[id] & sv::ProtectionEngine::TRIP_INSTANTANEOUS) != 0, expected.instantaneous) << id;
+
+        distanceTrips += distance.zone1Trip;
+        differentialTrips += expected.trip;
+    }
+    EXPECT_GT(distanceTrips, 0u);
+    EXPECT_GT(differentialTrips, 0u);
+
+    size_t partitioned = 0;
+    for (size_t w = 0; w < engine->getWorkerCount(); ++w)
+    {
+        const auto stats = engine->getWorkerStats(w);
+        EXPECT_EQ(stats.sweeps, 1u);
+        EXPECT_GE(stats.cpu, 0);
+        partitioned += stats.relays;
+    }
+    EXPECT_EQ(partitioned, relays);
+}
+
+TEST(ProtectionEngineTest, ZoneTimersRunOnSampleTimestamps)
+{
+    const auto engine = sv::ProtectionEngine::create();
+    sv::RelaySettings settings;
+    settings.elementId = 42;
+    settings.distance.zone1.enabled = false;
+    settings.distance.zone2.delay = std::chrono::milliseconds(300);
+    settings.distance.zone3.enabled = false;
+    static_cast<void>(engine->addRelay(settings));
+
+    const auto dispatcher = sv::TripEventDispatcher::create();
+    std::vector<sv::TripEvent> events;
+    dispatcher->subscribe([&events](const sv::TripEvent& event) { events.push_back(event); });
+    engine->setTripDispatcher(dispatcher);
+
+    // 15 ohm at the line angle lies inside zone 2 only; 4000 samples per second
+    const std::vector<std::complex<double>> voltage{std::polar(150.0, 1.0)};
+    const std::vector<std::complex<double>> current{{10.0, 0.0}};
+    const std::vector<std::complex<double>> remote{{10.0, 0.0}};
+    constexpr int64_t samplePeriodNs = 1'000'000'000 / 4000;
+
+    int64_t firstTrip = -1;
+    for (int64_t sample = 0; sample < 4000 && firstTrip < 0; ++sample)
+    {
+        engine->evaluate(voltage, current, remote, sample * samplePeriodNs);
+        if (engine->getTrips()[0] & sv::ProtectionEngine::TRIP_ZONE2)
+        {
+            firstTrip = sample;
+        }
+    }
+    EXPECT_EQ(firstTrip, 1200);
+
+    for (int64_t sample = 1201; sample < 1500; ++sample)
+    {
+        engine->evaluate(voltage, current, remote, sample * samplePeriodNs);
+    }
+    ASSERT_EQ(dispatcher->drain(), 1u);
+    EXPECT_EQ(events[0].source, sv::TripSource::DISTANCE);
+    EXPECT_EQ(events[0].elementId, 42u);
+    EXPECT_EQ(events[0].flags, sv::TripEvent::FLAG_ZONE2);
+    EXPECT_NEAR(events[0].value, 15.0, 1e-9);
+
+    engine->reset();
+    engine->evaluate(voltage, current, remote, 1500 * samplePeriodNs);
+    EXPECT_EQ(engine->getTrips()[0], 0);
+}
+
+TEST(ProtectionEngineTest, RejectsInvalidUse)
+{
+    EXPECT_THROW(static_cast<void>(sv::ProtectionEngine::create(0)), std::invalid_argument);
+
+    const auto engine = sv::ProtectionEngine::create(2);
+    sv::RelaySettings invalid;
+    invalid.distance.currentThresholdA = 0.0;
+    EXPECT_THROW(static_cast<void>(engine->addRelay(invalid)), std::invalid_argument);
+
+    static_cast<void>(engine->addRelay(sv::RelaySettings{}));
+    const std::vector<std::complex<double>> one(1);
+    const std::vector<std::complex<double>> two(2);
+    EXPECT_THROW(engine->evaluate(two, one, one, 0), std::invalid_argument);
+
+    engine->start();
+    EXPECT_THROW(static_cast<void>(engine->addRelay(sv::RelaySettings{})), std::logic_error);
+    engine->stop();
+    EXPECT_NO_THROW(static_cast<void>(engine->addRelay(sv::RelaySettings{})));
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "sv/core/rcu.h"
+#include "sv/protection/Protection.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct Triple
+    {
+        uint64_t a{0};
+        uint64_t b{0};
+        uint64_t c{0};
+    };
+}
+
+TEST(RcuCellTest, ReadersAlwaysSeeCompleteSnapshots)
+{
+    sv::RcuCell<Triple> cell(Triple{});
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> reads{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r)
+    {
+        readers.emplace_back([&]
+        {
+            uint64_t last = 0;
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                const auto snapshot = cell.read();
+                if (snapshot->a != snapshot->b || snapshot->b != snapshot->c || snapshot->a < last)
+                {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+                last = snapshot->a;
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    while (reads.load() == 0)
+    {
+        std::this_thread::yield();
+    }
+    for (uint64_t i = 1; i <= 2000; ++i)
+    {
+        cell.store(Triple{i, i, i});
+    }
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_EQ(cell.load().c, 2000u);
+}
+
+TEST(RcuCellTest, WriterInsideReaderDoesNotDeadlock)
+{
+    sv::RcuCell<Triple> cell(Triple{1, 1, 1});
+    {
+        const auto pinned = cell.read();
+        cell.store(Triple{2, 2, 2});
+        EXPECT_EQ(pinned->a, 1u);
+        EXPECT_EQ(cell.load().a, 2u);
+    }
+    cell.store(Triple{3, 3, 3});
+    EXPECT_EQ(cell.load().b, 3u);
+}
+
+TEST(RcuCellTest, FullRetiredBacklogMakesTheWriterWaitForReaders)
+{
+    constexpr uint64_t STORES = 200;
+    sv::RcuCell<Triple> cell(Triple{});
+    std::atomic<bool> pinned{false};
+    std::atomic<uint64_t> stores{0};
+    uint64_t storesWhilePinned = 0;
+
+    std::thread reader([&]
+    {
+        const auto guard = cell.read();
+        pinned.store(true);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        storesWhilePinned = stores.load();
+    });
+    while (!pinned.load())
+    {
+        std::this_thread::yield();
+    }
+
+    // Bounded waits time out against the pinned reader until the backlog is full; then a store blocks
+    for (uint64_t n = 1; n <= STORES; ++n)
+    {
+        cell.store(Triple{n, n, n});
+        stores.fetch_add(1);
+    }
+    reader.join();
+
+    EXPECT_GT(storesWhilePinned, 0u);
+    EXPECT_LT(storesWhilePinned, STORES);
+    EXPECT_EQ(cell.load().c, STORES);
+}
+
+TEST(RcuCellTest, ProtectionSettingsChangeWhileEvaluating)
+{
+    const auto protection = sv::DifferentialProtection::create();
+
+    // Changing settings from the trip callback runs on the evaluating thread
+    protection->onTrip([&protection](const sv::DifferentialProtectionResult&)
+    {
+        auto settings = protection->getSettings();
+        settings.instantaneousThresholdA += 1.0;
+        protection->setSettings(settings);
+    });
+
+    std::atomic<bool> stop{false};
+    std::thread writer([&]
+    {
+        sv::DifferentialProtectionSettings settings;
+        while (!stop.load(std::memory_order_relaxed))
+        {
+            settings.slopePercent = settings.slopePercent >= 50.0 ? 20.0 : settings.slopePercent + 1.0;
+            protection->setSettings(settings);
+        }
+    });
+
+    size_t trips = 0;
+    for (int i = 0; i < 5000; ++i)
+    {
+        trips += protection->update({20.0, 0.0}, {5.0, 0.0}).trip;
+    }
+    stop.store(true);
+    writer.join();
+
+    EXPECT_EQ(trips, 5000u);
+    EXPECT_TRUE(protection->getSettings().isValid());
+}
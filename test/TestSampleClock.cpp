@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "sv/core/sampleclock.h"
+#include "sv/protection/Protection.h"
+#include "sv/protection/SequenceProtection.h"
+
+#include <complex>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(SampleClockTest, UnwrapsSampleCounter)
+{
+    sv::SampleClock clock(sv::SamplesPerPeriod::SPP_80, sv::SignalFrequency::FREQ_50_HZ);
+    EXPECT_EQ(clock.getSamplesPerSecond(), 4000u);
+
+    EXPECT_EQ(clock.update(3990), 0ns);
+    EXPECT_EQ(clock.update(3991), 250us);
+
+    // Wrap from 3999 to 0 and a lost sample
+    EXPECT_EQ(clock.update(3999), 9 * 250us);
+    EXPECT_EQ(clock.update(0), 10 * 250us);
+    EXPECT_EQ(clock.update(2), 12 * 250us);
+
+    // A repeated counter does not advance the clock
+    EXPECT_EQ(clock.update(2), 12 * 250us);
+    EXPECT_EQ(clock.getSampleCount(), 12u);
+
+    clock.reset();
+    EXPECT_EQ(clock.update(100), 0ns);
+    EXPECT_EQ(clock.advance(4000), 1s);
+}
+
+TEST(SampleClockTest, ConvertsWithoutAccumulatingRoundingErrors)
+{
+    // 256 samples at 60 Hz: 15360 samples per second, 65104.1666 ns per sample
+    const sv::SampleClock clock(sv::SamplesPerPeriod::SPP_256, sv::SignalFrequency::FREQ_60_HZ);
+    EXPECT_EQ(clock.getSamplesPerSecond(), 15360u);
+    EXPECT_EQ(clock.toTime(15360), 1s);
+    EXPECT_EQ(clock.toTime(15360ull * 3600 * 24 * 365), std::chrono::nanoseconds(365 * 24h));
+    EXPECT_EQ(clock.toTime(1), 65104ns);
+}
+
+TEST(SampleTimeProtectionTest, ZoneDelayResolvesBelowOneMillisecond)
+{
+    // 15 ohm at 1 rad lies in zone 2 (20 ohm, 300 us) but not in zone 1 (10 ohm)
+    const auto protection = sv::DistanceProtection::create();
+    const std::complex<double> voltage = std::polar(150.0, 1.0);
+    const std::complex<double> current{10.0, 0.0};
+
+    sv::SampleClock clock;
+    std::vector<bool> trips;
+    for (uint16_t smpCnt = 0; smpCnt < 4; ++smpCnt)
+    {
+        const auto result = protection->update(voltage, current, clock.update(smpCnt));
+        EXPECT_EQ(result.sampleTime, smpCnt * 250us);
+        trips.push_back(result.zone2Trip);
+    }
+
+    // Picked up at 0 us; 250 us is still inside the delay, 500 us is past it
+    EXPECT_EQ(trips, (std::vector<bool>{false, false, true, true}));
+}
+
+TEST(SampleTimeProtectionTest, BlockMatchesPerSampleAndIsDeterministic)
+{
+    sv::DistanceProtectionSettings settings;
+    settings.zone2.delay = 10ms;
+    settings.zone3.delay = 20ms;
+
+    // Load, then a zone 3 fault, then a zone 2 fault
+    std::vector<std::complex<double>> voltages;
+    std::vector<std::complex<double>> currents;
+    for (int n = 0; n < 400; ++n)
+    {
+        const double impedance = n < 50 ? 100.0 : (n < 150 ? 25.0 : 15.0);
+        voltages.push_back(std::polar(10.0 * impedance, 1.0));
+        currents.emplace_back(10.0, 0.0);
+    }
+
+    constexpr auto period = 250us;
+    const auto reference = sv::DistanceProtection::create(settings);
+    std::vector<sv::DistanceProtectionResult> expected;
+    for (size_t n = 0; n < voltages.size(); ++n)
+    {
+        expected.push_back(reference->update(voltages[n], currents[n], period * static_cast<int64_t>(n)));
+    }
+
+    for (int run = 0; run < 2; ++run)
+    {
+        const auto block = sv::DistanceProtection::create(settings);
+        std::vector<sv::DistanceProtectionResult> results(voltages.size());
+        block->updateBlock(voltages, currents, results, 0ns, period);
+
+        for (size_t n = 0; n < voltages.size(); ++n)
+        {
+            EXPECT_EQ(results[n].sampleTime, expected[n].sampleTime) << n;
+            EXPECT_EQ(results[n].zone1Trip, expected[n].zone1Trip) << n;
+            EXPECT_EQ(results[n].zone2Trip, expected[n].zone2Trip) << n;
+            EXPECT_EQ(results[n].zone3Trip, expected[n].zone3Trip) << n;
+        }
+    }
+
+    // Zone 3 picks up at sample 50 and trips 20 ms = 80 samples later; zone 2 trips 40 samples after 150
+    EXPECT_FALSE(expected[129].zone3Trip);
+    EXPECT_TRUE(expected[130].zone3Trip);
+    EXPECT_FALSE(expected[189].zone2Trip);
+    EXPECT_TRUE(expected[190].zone2Trip);
+}
+
+TEST(SampleTimeProtectionTest, SequenceElementsRunOnSampleTime)
+{
+    sv::SequenceProtectionSettings settings;
+    settings.earthFault.delay = 100ms;
+    const auto protection = sv::SequenceProtection::create(settings);
+
+    const std::array<std::complex<double>, 3> currents = {std::complex<double>{5.0, 0.0}, {}, {}};
+    const std::array<std::complex<double>, 3> voltages = {std::complex<double>{230.0, 0.0}, std::polar(230.0, -2.0944),
+                                                          std::polar(230.0, 2.0944)};
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(currents, voltages);
+
+    EXPECT_FALSE(protection->update(measurement, 0ms).earthFaultTrip);
+    EXPECT_FALSE(protection->update(measurement, 99ms).earthFaultTrip);
+    const auto result = protection->update(measurement, 100ms);
+    EXPECT_TRUE(result.earthFaultTrip);
+    EXPECT_EQ(result.sampleTime, 100ms);
+}
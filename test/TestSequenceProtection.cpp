@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+#include "sv/protection/SequenceProtection.h"
+#include "sv/protection/PhasorEstimator.h"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <thread>
+
+namespace
+{
+    constexpr double kThird = 2.0 * std::numbers::pi / 3.0;
+
+    std::array<std::complex<double>, 3> balanced(const double magnitude)
+    {
+        return {std::polar(magnitude, 0.0), std::polar(magnitude, -kThird), std::polar(magnitude, kThird)};
+    }
+}
+
+TEST(SymmetricalComponentsTest, BalancedSetIsPurePositiveSequence)
+{
+    const auto phases = balanced(100.0);
+    const auto seq = sv::SequenceComponents::fromPhases(phases[0], phases[1], phases[2]);
+
+    EXPECT_NEAR(std::abs(seq.positive - phases[0]), 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(seq.negative), 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(seq.zero), 0.0, 1e-9);
+
+    // Swapping B and C gives a pure negative-sequence set
+    const auto reversed = sv::SequenceComponents::fromPhases(phases[0], phases[2], phases[1]);
+    EXPECT_NEAR(std::abs(reversed.negative - phases[0]), 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(reversed.positive), 0.0, 1e-9);
+}
+
+TEST(SymmetricalComponentsTest, SinglePhaseFaultSplitsEqually)
+{
+    // Only phase A carries current: I0 = I1 = I2 = Ia / 3
+    const std::complex<double> ia(90.0, 0.0);
+    const auto seq = sv::SequenceComponents::fromPhases(ia, 0.0, 0.0);
+
+    EXPECT_NEAR(std::abs(seq.zero - ia / 3.0), 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(seq.positive - ia / 3.0), 0.0, 1e-9);
+    EXPECT_NEAR(std::abs(seq.negative - ia / 3.0), 0.0, 1e-9);
+    EXPECT_NEAR(seq.residual(), 90.0, 1e-9);
+}
+
+TEST(SymmetricalComponentsTest, MeasurementFollowsEstimator)
+{
+    const auto estimator = sv::PhasorEstimator::create();
+    std::array<double, sv::PhasorEstimator::CHANNELS> sample{};
+    for (size_t k = 0; k < 80; ++k)
+    {
+        const double theta = 2.0 * std::numbers::pi * static_cast<double>(k) / 80.0;
+        for (size_t phase = 0; phase < 3; ++phase)
+        {
+            sample[phase] = 10.0 * std::numbers::sqrt2 * std::cos(theta - kThird * static_cast<double>(phase));
+            sample[phase + 4] = 230.0 * std::numbers::sqrt2 * std::cos(theta - kThird * static_cast<double>(phase));
+        }
+        estimator->update(sample);
+    }
+
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(*estimator);
+
+    EXPECT_NEAR(std::abs(measurement.getCurrentSequence().positive), 10.0, 1e-6);
+    EXPECT_NEAR(std::abs(measurement.getCurrentSequence().negative), 0.0, 1e-6);
+    EXPECT_NEAR(std::abs(measurement.getVoltageSequence().positive), 230.0, 1e-6);
+    EXPECT_NEAR(std::abs(measurement.getPhaseVoltage(1)), 230.0, 1e-6);
+    EXPECT_EQ(measurement.getPhaseCurrent(3), std::complex<double>{});
+}
+
+TEST(SequenceProtectionTest, BalancedLoadDoesNotTrip)
+{
+    sv::SequenceProtectionSettings settings;
+    settings.negativeSequence.delay = std::chrono::microseconds(0);
+    settings.earthFault.delay = std::chrono::microseconds(0);
+    const auto protection = sv::SequenceProtection::create(settings);
+
+    const auto currents = balanced(400.0);
+    const auto voltages = balanced(230.0);
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(currents, voltages);
+
+    const auto result = protection->update(measurement);
+    EXPECT_FALSE(result.negativeSequenceTrip);
+    EXPECT_FALSE(result.earthFaultTrip);
+    EXPECT_NEAR(result.negativeSequenceA, 0.0, 1e-9);
+}
+
+TEST(SequenceProtectionTest, UnbalanceTripsNegativeSequenceAfterDelay)
+{
+    sv::SequenceProtectionSettings settings;
+    settings.negativeSequence = {5.0, std::chrono::milliseconds(20), true};
+    settings.earthFault.enabled = false;
+    settings.minNegativeToPositiveRatio = 0.1;
+    const auto protection = sv::SequenceProtection::create(settings);
+
+    int trips = 0;
+    protection->onTrip([&trips](const sv::SequenceProtectionResult& result) {
+        EXPECT_TRUE(result.negativeSequenceTrip);
+        ++trips;
+    });
+
+    // Open phase C: I2 = |Ia - a^2 Ib| / 3 with zero residual (phase-to-phase)
+    const std::array<std::complex<double>, 3> currents = {std::polar(50.0, 0.0), std::polar(50.0, std::numbers::pi), 0.0};
+    const auto voltages = balanced(230.0);
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(currents, voltages);
+
+    auto result = protection->update(measurement);
+    EXPECT_FALSE(result.negativeSequenceTrip);
+    EXPECT_FALSE(result.earthFaultTrip);
+    EXPECT_GT(result.negativeSequenceA, 5.0);
+    EXPECT_NEAR(result.residualA, 0.0, 1e-9);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    result = protection->update(measurement);
+    EXPECT_TRUE(result.negativeSequenceTrip);
+    EXPECT_EQ(trips, 1);
+
+    // Ratio supervision blocks when the unbalance is small compared to the load
+    settings.minNegativeToPositiveRatio = 0.5;
+    settings.negativeSequence.delay = std::chrono::microseconds(0);
+    protection->setSettings(settings);
+    const std::array<std::complex<double>, 3> loaded = {std::polar(1000.0, 0.0), std::polar(1000.0, -kThird),
+                                                        std::polar(960.0, kThird)};
+    measurement.update(loaded, voltages);
+    result = protection->update(measurement);
+    EXPECT_GT(result.negativeSequenceA, 5.0);
+    EXPECT_FALSE(result.negativeSequenceTrip);
+}
+
+TEST(SequenceProtectionTest, ResidualCurrentTripsEarthFault)
+{
+    sv::SequenceProtectionSettings settings;
+    settings.earthFault = {20.0, std::chrono::microseconds(0), true};
+    settings.negativeSequence.enabled = false;
+    const auto protection = sv::SequenceProtection::create(settings);
+
+    auto currents = balanced(100.0);
+    currents[0] += std::complex<double>(30.0, 0.0);
+    const auto voltages = balanced(230.0);
+    sv::ThreePhaseMeasurement measurement;
+    measurement.update(currents, voltages);
+
+    const auto result = protection->update(measurement);
+    EXPECT_TRUE(result.earthFaultTrip);
+    EXPECT_FALSE(result.negativeSequenceTrip);
+    EXPECT_NEAR(result.residualA, 30.0, 1e-9);
+
+    protection->setEnabled(false);
+    EXPECT_FALSE(protection->update(measurement).earthFaultTrip);
+}
+
+TEST(SequenceProtectionTest, RejectsInvalidSettings)
+{
+    sv::SequenceProtectionSettings settings;
+    settings.earthFault.pickupA = 0.0;
+    EXPECT_THROW(static_cast<void>(sv::SequenceProtection::create(settings)), std::invalid_argument);
+
+    const auto protection = sv::SequenceProtection::create();
+    settings = protection->getSettings();
+    settings.minNegativeToPositiveRatio = 2.0;
+    EXPECT_THROW(protection->setSettings(settings), std::invalid_argument);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "sv/sim/Study.h"
+
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+
+using namespace sv::sim;
+
+TEST(WorkStealingPoolTest, RunsAllTasksAndRethrows)
+{
+    sv::WorkStealingPool pool(4);
+    EXPECT_EQ(pool.getWorkerCount(), 4u);
+
+    std::atomic<int> sum{0};
+    for (int n = 1; n <= 1000; ++n)
+    {
+        pool.submit([&sum, n] { sum += n; });
+    }
+    pool.wait();
+    EXPECT_EQ(sum.load(), 500500);
+
+    // Tasks spawned by a task land in the worker's own queue and are stolen by the others
+    pool.submit([&pool, &sum]
+    {
+        for (int n = 0; n < 100; ++n)
+        {
+            pool.submit([&sum] { ++sum; });
+        }
+    });
+    pool.wait();
+    EXPECT_EQ(sum.load(), 500600);
+
+    pool.submit([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    EXPECT_NO_THROW(pool.wait());
+}
+
+TEST(StudyTest, ExpandsGridAndReproducibleSamples)
+{
+    StudySpec spec;
+    spec.grid = {{StudyParameter::FAULT_CURRENT_A, {2000.0, 4000.0, 8000.0}},
+                 {StudyParameter::BREAKER_OPEN_TIME_S, {0.03, 0.05}}};
+    spec.random = {{StudyParameter::FAULT_TIME_S, 0.05, 0.15}};
+    spec.samples = 10;
+    spec.seed = 42;
+
+    const auto scenarios = StudyRunner::expand(spec);
+    ASSERT_EQ(scenarios.size(), 60u);
+    EXPECT_DOUBLE_EQ(scenarios[0].faultCurrentA, 2000.0);
+    EXPECT_DOUBLE_EQ(scenarios[0].breaker.openTimeSec, 0.03);
+    EXPECT_DOUBLE_EQ(scenarios[10].breaker.openTimeSec, 0.05);
+    EXPECT_DOUBLE_EQ(scenarios[59].faultCurrentA, 8000.0);
+    for (const auto& scenario : scenarios)
+    {
+        EXPECT_GE(scenario.faultTimeS, 0.05);
+        EXPECT_LE(scenario.faultTimeS, 0.15);
+    }
+    EXPECT_NE(scenarios[0].faultTimeS, scenarios[1].faultTimeS);
+
+    const auto again = StudyRunner::expand(spec);
+    for (size_t n = 0; n < scenarios.size(); ++n)
+    {
+        EXPECT_EQ(scenarios[n].faultTimeS, again[n].faultTimeS);
+    }
+
+    spec.grid[1].values.clear();
+    EXPECT_THROW(static_cast<void>(StudyRunner::expand(spec)), std::invalid_argument);
+}
+
+TEST(StudyTest, SimulatesRelayAndBreakerOnSampleTime)
+{
+    // Zone 1 operates at once, the breaker clears after its opening time
+    StudyScenario scenario;
+    const auto zone1 = StudyRunner::simulate(scenario);
+    EXPECT_TRUE(zone1.relayOperated);
+    EXPECT_EQ(zone1.zone, 1);
+    EXPECT_FALSE(zone1.overloadTrip);
+    EXPECT_DOUBLE_EQ(zone1.relayTimeS, 0.0);
+    EXPECT_NEAR(zone1.clearingTimeS, 0.05, 1e-12);
+
+    // 15 ohm is in zone 2; 300 us delay at 250 us samples operates on the third sample
+    scenario.faultImpedanceOhm = 15.0;
+    const auto zone2 = StudyRunner::simulate(scenario);
+    EXPECT_EQ(zone2.zone, 2);
+    EXPECT_NEAR(zone2.relayTimeS, 0.0005, 1e-12);
+    EXPECT_NEAR(zone2.clearingTimeS, 0.0505, 1e-12);
+
+    // A fault current above the breaker rating trips it directly
+    scenario.breaker.maxCurrentA = 4000.0;
+    const auto overload = StudyRunner::simulate(scenario);
+    EXPECT_TRUE(overload.overloadTrip);
+    EXPECT_TRUE(overload.cleared);
+    EXPECT_DOUBLE_EQ(overload.clearingTimeS, 0.0);
+
+    // Load alone stays outside all zones
+    scenario.faultTimeS = 1.0;
+    const auto load = StudyRunner::simulate(scenario);
+    EXPECT_FALSE(load.relayOperated);
+    EXPECT_FALSE(load.cleared);
+
+    scenario.timeStepS = 0.0;
+    EXPECT_THROW(static_cast<void>(StudyRunner::simulate(scenario)), std::invalid_argument);
+}
+
+TEST(StudyTest, ParallelRunMatchesSerialAndWritesColumns)
+{
+    StudySpec spec;
+    spec.grid = {{StudyParameter::FAULT_IMPEDANCE_OHM, {1.0, 15.0, 25.0}}};
+    spec.random = {{StudyParameter::BREAKER_OPEN_TIME_S, 0.02, 0.08},
+                   {StudyParameter::ZONE2_DELAY_S, 0.1, 0.3}};
+    spec.base.protection.zone3.delay = std::chrono::milliseconds(600);
+    spec.base.durationS = 1.0;
+    spec.samples = 100;
+
+    const auto parallel = StudyRunner::create(4)->run(spec);
+    const auto serial = StudyRunner::create(1)->run(spec);
+    ASSERT_EQ(parallel.outcomes.size(), 300u);
+
+    for (size_t n = 0; n < parallel.outcomes.size(); ++n)
+    {
+        EXPECT_EQ(parallel.outcomes[n].zone, serial.outcomes[n].zone) << n;
+        EXPECT_EQ(parallel.outcomes[n].clearingTimeS, serial.outcomes[n].clearingTimeS) << n;
+    }
+    EXPECT_EQ(parallel.notCleared, 0u);
+    EXPECT_EQ(parallel.clearingTime.count, 300u);
+    EXPECT_EQ(parallel.relayTime.count, 300u);
+    EXPECT_GE(parallel.clearingTime.minS, 0.02);
+    EXPECT_LE(parallel.clearingTime.maxS, 0.6 + 0.08 + 0.001);
+    EXPECT_LE(parallel.clearingTime.p50S, parallel.clearingTime.p90S);
+    EXPECT_LE(parallel.clearingTime.p90S, parallel.clearingTime.p99S);
+    EXPECT_EQ(parallel.clearingTime.p50S, serial.clearingTime.p50S);
+
+    const auto path = (std::filesystem::temp_directory_path() / "sv_study_test.bin").string();
+    parallel.writeColumnar(path);
+    const auto columns = StudyResult::readColumnar(path);
+    std::remove(path.c_str());
+
+    ASSERT_EQ(columns.size(), std::size(STUDY_PARAMETERS) + 6);
+    const auto& impedance = columns.at("fault_impedance_ohm");
+    const auto& zone = columns.at("zone");
+    const auto& clearing = columns.at("clearing_time_s");
+    ASSERT_EQ(impedance.size(), 300u);
+    EXPECT_EQ(impedance[0], 1.0);
+    EXPECT_EQ(zone[0], 1.0);
+    EXPECT_EQ(impedance[299], 25.0);
+    EXPECT_EQ(zone[299], 3.0);
+    EXPECT_EQ(clearing[150], parallel.outcomes[150].clearingTimeS);
+
+    EXPECT_THROW(static_cast<void>(StudyResult::readColumnar(path)), std::runtime_error);
+}
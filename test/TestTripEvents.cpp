@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+#include "sv/protection/TripEvents.h"
+#include "sv/protection/Protection.h"
+#include "sv/core/latency.h"
+
+#include <atomic>
+#include <chrono>
+#include <complex>
+#include <thread>
+#include <vector>
+
+TEST(LatencyHistogramTest, BucketsCoverRangeWithBoundedError)
+{
+    for (const uint64_t value : {0ull, 1ull, 7ull, 8ull, 9ull, 15ull, 16ull, 1000ull, 123456789ull, ~0ull})
+    {
+        const size_t bucket = sv::LatencyHistogram::bucketFor(value);
+        ASSERT_LT(bucket, sv::LatencyHistogram::BUCKETS);
+        EXPECT_LE(sv::LatencyHistogram::bucketLowerBound(bucket), value);
+        EXPECT_GE(sv::LatencyHistogram::bucketUpperBound(bucket), value);
+        const auto width = sv::LatencyHistogram::bucketUpperBound(bucket) - sv::LatencyHistogram::bucketLowerBound(bucket);
+        EXPECT_LE(static_cast<double>(width), static_cast<double>(value) / 8.0 + 1.0) << value;
+    }
+
+    sv::LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.record(i * 1000);
+    }
+    EXPECT_EQ(histogram.count(), 1000u);
+    EXPECT_EQ(histogram.maxNs(), 1000000u);
+    EXPECT_NEAR(histogram.meanNs(), 500500.0, 1e-6);
+    EXPECT_NEAR(static_cast<double>(histogram.percentileNs(50.0)), 500000.0, 500000.0 / 8.0);
+    EXPECT_NEAR(static_cast<double>(histogram.percentileNs(99.0)), 990000.0, 990000.0 / 8.0);
+    EXPECT_EQ(histogram.percentileNs(100.0), 1000000u);
+
+    histogram.reset();
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.percentileNs(50.0), 0u);
+}
+
+TEST(TripEventDispatcherTest, FansOutEventsFromManyProducers)
+{
+    const auto dispatcher = sv::TripEventDispatcher::create(4096);
+
+    std::atomic<uint64_t> delivered{0};
+    std::atomic<uint64_t> idSum{0};
+    dispatcher->subscribe([&](const sv::TripEvent& event)
+    {
+        delivered.fetch_add(1);
+        idSum.fetch_add(event.elementId);
+        EXPECT_GE(event.enqueueNs, event.decisionNs);
+    });
+    dispatcher->start();
+    EXPECT_TRUE(dispatcher->isRunning());
+
+    constexpr uint32_t producers = 4;
+    constexpr uint32_t perProducer = 500;
+    std::vector<std::thread> threads;
+    for (uint32_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&dispatcher, p]
+        {
+            for (uint32_t i = 0; i < perProducer; ++i)
+            {
+                sv::TripEvent event;
+                event.elementId = p + 1;
+                event.decisionNs = sv::TripEvent::toNs(std::chrono::steady_clock::now());
+                while (!dispatcher->publish(event))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    dispatcher->stop();
+
+    EXPECT_EQ(delivered.load(), producers * perProducer);
+    EXPECT_EQ(idSum.load(), perProducer * (1 + 2 + 3 + 4));
+    EXPECT_EQ(dispatcher->getEnqueueLatency().count(), dispatcher->getPublished());
+    EXPECT_EQ(dispatcher->getDispatchLatency().count(), producers * perProducer);
+}
+
+TEST(TripEventDispatcherTest, DropsWhenFullAndDrainsSynchronously)
+{
+    const auto dispatcher = sv::TripEventDispatcher::create(4);
+
+    size_t delivered = 0;
+    dispatcher->subscribe([&delivered](const sv::TripEvent&) { ++delivered; });
+
+    for (int i = 0; i < 6; ++i)
+    {
+        static_cast<void>(dispatcher->publish(sv::TripEvent{}));
+    }
+    EXPECT_EQ(dispatcher->getDropped(), 2u);
+    EXPECT_EQ(dispatcher->getPublished(), 4u);
+    EXPECT_EQ(dispatcher->drain(), 4u);
+    EXPECT_EQ(delivered, 4u);
+    EXPECT_THROW(static_cast<void>(sv::TripEventDispatcher::create(0)), std::invalid_argument);
+}
+
+TEST(TripEventDispatcherTest, ProtectionElementsPublishTrips)
+{
+    const auto dispatcher = sv::TripEventDispatcher::create();
+    std::vector<sv::TripEvent> events;
+    dispatcher->subscribe([&events](const sv::TripEvent& event) { events.push_back(event); });
+
+    const auto differential = sv::DifferentialProtection::create();
+    differential->setTripDispatcher(dispatcher, 7);
+    const auto result = differential->update({20.0, 0.0}, {0.0, 0.0});
+    ASSERT_TRUE(result.trip);
+
+    ASSERT_EQ(dispatcher->drain(), 1u);
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].source, sv::TripSource::DIFFERENTIAL);
+    EXPECT_STREQ(sv::toString(events[0].source), "DIFFERENTIAL");
+    EXPECT_EQ(events[0].elementId, 7u);
+    EXPECT_EQ(events[0].flags, sv::TripEvent::FLAG_INSTANTANEOUS);
+    EXPECT_DOUBLE_EQ(events[0].value, 20.0);
+    EXPECT_EQ(events[0].decisionNs, sv::TripEvent::toNs(result.tripTime));
+
+    differential->setTripDispatcher(nullptr);
+    static_cast<void>(differential->update({20.0, 0.0}, {0.0, 0.0}));
+    EXPECT_EQ(dispatcher->drain(), 0u);
+}
+
+TEST(TripEventDispatcherTest, StandingFaultPublishesOnlyTheRisingEdge)
+{
+    using namespace std::chrono_literals;
+
+    const auto dispatcher = sv::TripEventDispatcher::create();
+    std::vector<sv::TripEvent> events;
+    dispatcher->subscribe([&events](const sv::TripEvent& event) { events.push_back(event); });
+
+    // 2 ohm is inside all three zones; zone 1 trips at once, zones 2 and 3 after 300 and 600 us
+    const std::vector<std::complex<double>> voltages(4, {100.0, 0.0});
+    const std::vector<std::complex<double>> currents = {{50.0, 0.0}, {50.0, 0.0}, {0.1, 0.0}, {50.0, 0.0}};
+
+    const auto single = sv::DistanceProtection::create();
+    single->setTripDispatcher(dispatcher, 1);
+    int callbacks = 0;
+    single->onTrip([&callbacks](const sv::DistanceProtectionResult&) { ++callbacks; });
+    for (size_t k = 0; k < voltages.size(); ++k)
+    {
+        static_cast<void>(single->update(voltages[k], currents[k], std::chrono::nanoseconds(k * 1ms)));
+    }
+    ASSERT_EQ(dispatcher->drain(), 2u);
+    const std::vector<sv::TripEvent> fromUpdate = events;
+
+    // The second sample trips all three zones but continues the standing fault: one callback, no event
+    EXPECT_EQ(callbacks, 3);
+    EXPECT_EQ(fromUpdate[0].flags, sv::TripEvent::FLAG_ZONE1);
+    EXPECT_EQ(fromUpdate[1].flags, sv::TripEvent::FLAG_ZONE1);
+
+    events.clear();
+    const auto block = sv::DistanceProtection::create();
+    block->setTripDispatcher(dispatcher, 1);
+    std::vector<sv::DistanceProtectionResult> results(voltages.size());
+    block->updateBlock(voltages, currents, results, 0ns, 1ms);
+    ASSERT_EQ(dispatcher->drain(), 2u);
+    EXPECT_TRUE(results[1].zone1Trip && results[1].zone2Trip && results[1].zone3Trip);
+    for (size_t n = 0; n < events.size(); ++n)
+    {
+        EXPECT_EQ(events[n].flags, fromUpdate[n].flags) << n;
+    }
+
+    // Differential: a fault held for many samples is one event; clearing and re-faulting is another
+    events.clear();
+    const auto differential = sv::DifferentialProtection::create();
+    differential->setTripDispatcher(dispatcher, 2);
+    for (int n = 0; n < 100; ++n)
+    {
+        static_cast<void>(differential->update({20.0, 0.0}, {0.0, 0.0}));
+    }
+    static_cast<void>(differential->update({1.0, 0.0}, {1.0, 0.0}));
+    static_cast<void>(differential->update({20.0, 0.0}, {0.0, 0.0}));
+    EXPECT_EQ(dispatcher->drain(), 2u);
+    EXPECT_EQ(dispatcher->getDropped(), 0u);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "sv/sim/Waveform.h"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+using namespace sv::sim;
+
+TEST(WaveformGeneratorTest, OscillatorsMatchDirectEvaluationWithoutDrift)
+{
+    const auto generator = WaveformGenerator::create(sv::SamplesPerPeriod::SPP_80, sv::SignalFrequency::FREQ_50_HZ);
+    auto definition = WaveformDefinition::balanced(100.0, 6350.0, -0.3);
+    definition.channels[0].harmonics = {{.order = 3, .rms = 20.0, .phaseRad = 0.5}, {.order = 39, .rms = 1.0}};
+    EXPECT_EQ(generator->addStream(definition), 0u);
+
+    // Ten seconds of samples stay within one count of cos() evaluated per sample
+    for (size_t n = 0; n < 40000; ++n)
+    {
+        const auto sample = generator->step();
+        const double angle = 2.0 * std::numbers::pi * static_cast<double>(n % 80) / 80.0;
+        const double ia = std::numbers::sqrt2 * (100.0 * std::cos(angle - 0.3) + 20.0 * std::cos(3.0 * angle + 0.5) +
+                                                 std::cos(39.0 * angle));
+        const double vc = std::numbers::sqrt2 * 6350.0 * std::cos(angle + 2.0 * std::numbers::pi / 3.0);
+        ASSERT_NEAR(sample[0], ia * sv::ScalingFactors::CURRENT_DEFAULT, 1.0) << n;
+        ASSERT_NEAR(sample[6], vc * sv::ScalingFactors::VOLTAGE_DEFAULT, 1.0) << n;
+        ASSERT_EQ(sample[3], 0);
+    }
+    EXPECT_EQ(generator->getSampleCount(), 40000u);
+
+    definition.channels[1].harmonics = {{.order = 40}};
+    EXPECT_THROW(generator->addStream(definition), std::invalid_argument);
+    definition.channels[1].harmonics.clear();
+    definition.voltageScaling = 0;
+    EXPECT_THROW(generator->addStream(definition), std::invalid_argument);
+}
+
+TEST(WaveformGeneratorTest, DecayingOffsetAndNoise)
+{
+    const auto generator = WaveformGenerator::create(sv::SamplesPerPeriod::SPP_80, sv::SignalFrequency::FREQ_50_HZ, 7);
+    WaveformDefinition definition;
+    definition.currentScaling = 1;
+    definition.channels[0].dcOffset = 1000000.0;
+    definition.channels[0].dcTimeConstantS = 0.04;
+    definition.channels[1].dcOffset = 500.0;
+    definition.channels[4].noiseRms = 1000.0;
+    generator->addStream(definition);
+
+    std::vector<int32_t> samples(800 * sv::VALUES_PER_ASDU);
+    generator->generate(samples);
+
+    // 160 samples of 250 us are one time constant
+    EXPECT_EQ(samples[0], 1000000);
+    EXPECT_NEAR(samples[160 * sv::VALUES_PER_ASDU], 1000000.0 / std::numbers::e, 1.0);
+    EXPECT_EQ(samples[799 * sv::VALUES_PER_ASDU + 1], 500);
+
+    double sum = 0.0;
+    double squares = 0.0;
+    for (size_t n = 0; n < 800; ++n)
+    {
+        const double value = samples[n * sv::VALUES_PER_ASDU + 4] / 100.0;
+        sum += value;
+        squares += value * value;
+    }
+    EXPECT_NEAR(sum / 800.0, 0.0, 150.0);
+    EXPECT_NEAR(std::sqrt(squares / 800.0), 1000.0, 100.0);
+
+    // The same seed gives the same noise
+    const auto again = WaveformGenerator::create(sv::SamplesPerPeriod::SPP_80, sv::SignalFrequency::FREQ_50_HZ, 7);
+    again->addStream(definition);
+    EXPECT_EQ(again->step()[4], samples[4]);
+
+    std::vector<int32_t> partial(5);
+    EXPECT_THROW(generator->generate(partial), std::invalid_argument);
+}
+
+TEST(WaveformGeneratorTest, StreamsShareTheSampleClock)
+{
+    const auto generator = WaveformGenerator::create(sv::SamplesPerPeriod::SPP_256, sv::SignalFrequency::FREQ_60_HZ);
+    generator->addStream(WaveformDefinition::balanced(10.0, 100.0));
+    for (int n = 0; n < 100; ++n)
+    {
+        generator->step();
+    }
+
+    // A stream added later is in phase with the first one
+    EXPECT_EQ(generator->addStream(WaveformDefinition::balanced(10.0, 100.0)), 1u);
+    ASSERT_EQ(generator->getStreamCount(), 2u);
+    for (int n = 0; n < 300; ++n)
+    {
+        const auto sample = generator->step();
+        for (size_t channel = 0; channel < sv::VALUES_PER_ASDU; ++channel)
+        {
+            ASSERT_EQ(sample[channel], sample[sv::VALUES_PER_ASDU + channel]) << n;
+        }
+    }
+
+    const int32_t va = generator->step()[sv::VALUES_PER_ASDU + 4];
+    std::vector<sv::AnalogValue> values;
+    generator->toAnalogValues(1, values);
+    ASSERT_EQ(values.size(), sv::VALUES_PER_ASDU);
+    EXPECT_EQ(values[4].getScaledInt(), va);
+    EXPECT_THROW(generator->toAnalogValues(2, values), std::out_of_range);
+}